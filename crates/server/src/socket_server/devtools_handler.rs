@@ -1,5 +1,6 @@
 // DevTools connection handler / DevTools 연결 핸들러
 use super::message::CDPMessage;
+use super::message_processor::devtools_session_message;
 use super::{Client, DevTools};
 use crate::logging::{LogType, Logger};
 use crate::react_native::ReactNativeInspectorConnectionManager;
@@ -44,10 +45,16 @@ pub async fn handle_devtools_connection(
         sender: tx.clone(),
     });
 
-    {
+    // Counted under the write lock so concurrent attaches agree on who was first / 동시 연결이 첫 연결에 합의하도록 쓰기 락 안에서 계산
+    let first_for_client = {
         let mut devtools = devtools.write().await;
+        let first = client_id.is_some()
+            && !devtools
+                .values()
+                .any(|dt| dt.client_id.is_some() && dt.client_id == client_id);
         devtools.insert(id.clone(), devtool.clone());
-    }
+        first
+    };
 
     // Auto-send Runtime.executionContextCreated for Reactotron clients / Reactotron 클라이언트에 대해 Runtime.executionContextCreated 자동 전송
     // This is needed for DevTools to enable console / 이것은 DevTools가 콘솔을 활성화하는 데 필요합니다
@@ -169,10 +176,23 @@ pub async fn handle_devtools_connection(
     // If connected to React Native Inspector, send cached Redux stores / React Native Inspector에 연결된 경우 캐시된 Redux stores 전송
     if let Some(client_id) = &client_id {
         let rn_connection = rn_manager.get_connection(client_id).await;
-        if rn_connection.is_some() {
+        if let Some(connection) = rn_connection {
             // Associate DevTools with React Native Inspector / DevTools를 React Native Inspector와 연결
             rn_manager.associate_with_client(client_id, client_id).await;
 
+            // Start capture in the app; it forgets domains enabled by an earlier client / 앱에서 캡처 시작, 이전 클라이언트가 활성화한 도메인은 잊음
+            if first_for_client {
+                let sender = connection.sender.read().await;
+                if let Err(e) = sender.send(devtools_session_message(true, false)) {
+                    logger.log_error(
+                        LogType::DevTools,
+                        &id,
+                        &format!("failed to notify RN inspector {} of attach", client_id),
+                        Some(&e.to_string()),
+                    );
+                }
+            }
+
             // Send cached Redux stores after a delay / 지연 후 캐시된 Redux stores 전송
             let stores = rn_manager.get_redux_stores(client_id).await;
             let devtools_id = id.clone();
@@ -274,6 +294,7 @@ pub async fn handle_devtools_connection(
     let rn_manager_for_msg = rn_manager.clone();
     let logger_for_msg = logger.clone();
     let devtools_id_for_msg = id.clone();
+    let client_id_for_msg = client_id.clone();
     tokio::spawn(async move {
         while let Some(msg) = receiver.next().await {
             match msg {
@@ -737,8 +758,6 @@ pub async fn handle_devtools_connection(
                         None,
                         None,
                     );
-                    let mut devtools = devtools_for_msg.write().await;
-                    devtools.remove(&devtools_id_for_msg);
                     break;
                 }
                 Err(e) => {
@@ -753,5 +772,30 @@ pub async fn handle_devtools_connection(
                 _ => {}
             }
         }
+
+        // Socket is gone however it ended / 종료 방식과 관계없이 소켓이 사라짐
+        let last_for_client = {
+            let mut devtools = devtools_for_msg.write().await;
+            devtools.remove(&devtools_id_for_msg);
+            client_id_for_msg.is_some()
+                && !devtools
+                    .values()
+                    .any(|dt| dt.client_id.is_some() && dt.client_id == client_id_for_msg)
+        };
+
+        // Stop capture in the app once nobody is looking / 아무도 보고 있지 않으면 앱에서 캡처 중지
+        if let Some(client_id) = client_id_for_msg.filter(|_| last_for_client) {
+            if let Some(connection) = rn_manager_for_msg.get_connection(&client_id).await {
+                let sender = connection.sender.read().await;
+                if let Err(e) = sender.send(devtools_session_message(false, false)) {
+                    logger_for_msg.log_error(
+                        LogType::DevTools,
+                        &devtools_id_for_msg,
+                        &format!("failed to notify RN inspector {} of detach", client_id),
+                        Some(&e.to_string()),
+                    );
+                }
+            }
+        }
     });
 }
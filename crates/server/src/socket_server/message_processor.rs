@@ -72,6 +72,50 @@ pub fn process_client_message(message: &str, client_id: &str, logger: &Logger) -
     }
 }
 
+/// Unpack batched frame from React Native Inspector / React Native Inspector의 배치 프레임 풀기
+/// The native sender packs several CDP messages into one JSON array (`[msg1,msg2,...]`) / 네이티브 전송기는 여러 CDP 메시지를 하나의 JSON 배열(`[msg1,msg2,...]`)로 묶음
+/// Returns each message separately; non-array or invalid frames are returned as-is / 각 메시지를 개별로 반환하며, 배열이 아니거나 잘못된 프레임은 그대로 반환
+/// Messages are split without being parsed, so their bytes are forwarded unchanged / 메시지를 파싱하지 않고 분리하므로 바이트가 그대로 전달됨
+pub fn unpack_batch_frame(frame: String) -> Vec<String> {
+    // CDP messages are always JSON objects, so an array can only be a batch frame / CDP 메시지는 항상 JSON 객체이므로 배열은 배치 프레임뿐임
+    if !frame.trim_start().starts_with('[') {
+        return vec![frame];
+    }
+
+    match serde_json::from_str::<Vec<Box<serde_json::value::RawValue>>>(&frame) {
+        Ok(messages) => messages
+            .iter()
+            .map(|message| message.get().to_string())
+            .collect(),
+        Err(_) => vec![frame],
+    }
+}
+
+/// Sent to a React Native app when its first DevTools client attaches / 첫 DevTools 클라이언트가 연결되면 React Native 앱에 전송
+pub const DEVTOOLS_ATTACHED_METHOD: &str = "ChromeRemoteDevTools.devtoolsAttached";
+/// Sent to a React Native app when its last DevTools client detaches / 마지막 DevTools 클라이언트가 분리되면 React Native 앱에 전송
+pub const DEVTOOLS_DETACHED_METHOD: &str = "ChromeRemoteDevTools.devtoolsDetached";
+
+/// Build DevTools session notification for a React Native app / React Native 앱에 보낼 DevTools 세션 알림 생성
+/// The app captures console and network events only while attached, and forgets enabled domains on detach /
+/// 앱은 연결된 동안에만 console, network 이벤트를 캡처하며, 분리되면 활성화된 도메인을 잊음
+/// `resumed` marks an app reconnecting to a client that stayed attached, so it keeps its enabled domains /
+/// `resumed`는 연결이 유지된 클라이언트에 앱이 다시 연결된 경우를 표시하며, 이때 활성화된 도메인을 유지함
+pub fn devtools_session_message(attached: bool, resumed: bool) -> String {
+    let message = if attached {
+        serde_json::json!({
+            "method": DEVTOOLS_ATTACHED_METHOD,
+            "params": { "resumed": resumed },
+        })
+    } else {
+        serde_json::json!({
+            "method": DEVTOOLS_DETACHED_METHOD,
+            "params": {},
+        })
+    };
+    message.to_string()
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -116,4 +160,58 @@ mod tests {
         let result = process_client_message(message, "test-client", &logger);
         assert_eq!(result, message);
     }
+
+    #[test]
+    /// Test unpacking single (unframed) message / 단일(프레임 없는) 메시지 풀기 테스트
+    fn test_unpack_single_message() {
+        let message = r#"{"method":"Runtime.consoleAPICalled","params":{}}"#.to_string();
+        let result = unpack_batch_frame(message.clone());
+        assert_eq!(result, vec![message]);
+    }
+
+    #[test]
+    /// Test unpacking batch frame / 배치 프레임 풀기 테스트
+    fn test_unpack_batch_frame() {
+        let frame =
+            r#"[{"method":"A.a","params":{"x":1}},{"method":"B.b","params":{}}]"#.to_string();
+        let result = unpack_batch_frame(frame);
+        assert_eq!(result.len(), 2);
+        let first: serde_json::Value = serde_json::from_str(&result[0]).unwrap();
+        let second: serde_json::Value = serde_json::from_str(&result[1]).unwrap();
+        assert_eq!(first["method"], "A.a");
+        assert_eq!(first["params"]["x"], 1);
+        assert_eq!(second["method"], "B.b");
+    }
+
+    #[test]
+    /// Test batched messages are forwarded byte for byte / 배치된 메시지가 바이트 그대로 전달되는지 테스트
+    fn test_unpack_batch_frame_preserves_message_text() {
+        let first = r#"{"params":{"z":1,"a":2.50},"method":"A.a"}"#;
+        let second = r#"{"method":"B.b","params":{"text":"\u00e9 한국어"}}"#;
+        let frame = format!("[{},{}]", first, second);
+        let result = unpack_batch_frame(frame);
+        assert_eq!(result, vec![first.to_string(), second.to_string()]);
+    }
+
+    #[test]
+    /// Test invalid batch frame is returned as-is / 잘못된 배치 프레임은 그대로 반환되는지 테스트
+    fn test_unpack_invalid_batch_frame() {
+        let frame = "[not json".to_string();
+        let result = unpack_batch_frame(frame.clone());
+        assert_eq!(result, vec![frame]);
+    }
+
+    #[test]
+    /// Test DevTools session notifications / DevTools 세션 알림 테스트
+    fn test_devtools_session_message() {
+        let attached: serde_json::Value =
+            serde_json::from_str(&devtools_session_message(true, true)).unwrap();
+        assert_eq!(attached["method"], DEVTOOLS_ATTACHED_METHOD);
+        assert_eq!(attached["params"]["resumed"], true);
+        assert!(attached.get("id").is_none());
+
+        let detached: serde_json::Value =
+            serde_json::from_str(&devtools_session_message(false, false)).unwrap();
+        assert_eq!(detached["method"], DEVTOOLS_DETACHED_METHOD);
+    }
 }
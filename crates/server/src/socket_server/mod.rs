@@ -4,6 +4,7 @@ mod devtools_handler;
 mod message;
 mod message_processor;
 mod react_native_handler;
+mod response_body_stream;
 
 use crate::logging::{LogType, Logger};
 use crate::react_native::ReactNativeInspectorConnectionManager;
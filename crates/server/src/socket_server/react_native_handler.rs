@@ -1,5 +1,7 @@
 // React Native Inspector connection handler / React Native Inspector 연결 핸들러
 use super::message::CDPMessage;
+use super::message_processor::{devtools_session_message, unpack_batch_frame};
+use super::response_body_stream::ResponseBodyStreams;
 use super::DevTools;
 use crate::logging::{LogType, Logger};
 use crate::react_native::{
@@ -46,6 +48,23 @@ pub async fn handle_react_native_inspector_websocket(
         .associate_with_client(&inspector_id, &inspector_id)
         .await;
 
+    // Tell the app whether a DevTools client is still attached; a reconnecting app missed any detach /
+    // DevTools 클라이언트가 아직 연결되어 있는지 앱에 알림, 다시 연결된 앱은 분리 알림을 놓쳤을 수 있음
+    let attached = {
+        let devtools = devtools.read().await;
+        devtools
+            .values()
+            .any(|dt| dt.client_id.as_deref() == Some(inspector_id.as_str()))
+    };
+    if let Err(e) = tx.send(devtools_session_message(attached, attached)) {
+        logger.log_error(
+            LogType::RnInspector,
+            &inspector_id,
+            "failed to send DevTools session state",
+            Some(&e.to_string()),
+        );
+    }
+
     logger.log(
         LogType::RnInspector,
         &inspector_id,
@@ -80,48 +99,105 @@ pub async fn handle_react_native_inspector_websocket(
     let rn_manager_for_msg = rn_manager.clone();
     let logger_for_msg = logger.clone();
     let inspector_id_for_msg = inspector_id.clone();
+    let tx_for_msg = tx.clone();
     tokio::spawn(async move {
+        // Large response bodies are pulled from native with IO.read / 큰 응답 본문은 IO.read로 네이티브에서 가져옴
+        let mut body_streams = ResponseBodyStreams::new();
         while let Some(msg) = receiver.next().await {
             match msg {
-                Ok(Message::Text(text)) => {
-                    // Parse message for logging and Redux handling / 로깅 및 Redux 처리를 위해 메시지 파싱
-                    if let Ok(parsed) = serde_json::from_str::<CDPMessage>(&text) {
-                        if let Some(method) = &parsed.method {
-                            logger_for_msg.log(
-                                LogType::RnInspector,
-                                &inspector_id_for_msg,
-                                "received",
-                                Some(&serde_json::json!(parsed)),
-                                Some(method),
-                            );
+                Ok(Message::Text(frame)) => {
+                    // Native sender may batch several messages into one frame / 네이티브 전송기가 여러 메시지를 하나의 프레임으로 묶을 수 있음
+                    for text in unpack_batch_frame(frame) {
+                        let text = match body_streams.handle(&text) {
+                            Some(messages) => {
+                                for command in messages.to_native {
+                                    let _ = tx_for_msg.send(command);
+                                }
+                                match messages.to_devtools {
+                                    Some(response) => response,
+                                    None => continue,
+                                }
+                            }
+                            None => text,
+                        };
 
-                            // Cache Redux store information / Redux store 정보 캐시
-                            if method == "Redux.message" {
-                                if let Some(params) = &parsed.params {
-                                    if let Ok(redux_params) =
-                                        serde_json::from_value::<serde_json::Value>(params.clone())
-                                    {
-                                        if let Some(redux_type) =
-                                            redux_params.get("type").and_then(|v| v.as_str())
+                        // Parse message for logging and Redux handling / 로깅 및 Redux 처리를 위해 메시지 파싱
+                        if let Ok(parsed) = serde_json::from_str::<CDPMessage>(&text) {
+                            if let Some(method) = &parsed.method {
+                                logger_for_msg.log(
+                                    LogType::RnInspector,
+                                    &inspector_id_for_msg,
+                                    "received",
+                                    Some(&serde_json::json!(parsed)),
+                                    Some(method),
+                                );
+
+                                // Cache Redux store information / Redux store 정보 캐시
+                                if method == "Redux.message" {
+                                    if let Some(params) = &parsed.params {
+                                        if let Ok(redux_params) =
+                                            serde_json::from_value::<serde_json::Value>(
+                                                params.clone(),
+                                            )
                                         {
-                                            if redux_type == "INIT" {
-                                                if let Some(instance_id) = redux_params
-                                                    .get("instanceId")
-                                                    .and_then(|v| v.as_str())
-                                                {
-                                                    let store_info = ReduxStoreInstance {
-                                                        instance_id: instance_id.to_string(),
-                                                        name: redux_params
-                                                            .get("name")
-                                                            .and_then(|v| v.as_str())
-                                                            .unwrap_or("Store")
-                                                            .to_string(),
-                                                        payload: redux_params
+                                            if let Some(redux_type) =
+                                                redux_params.get("type").and_then(|v| v.as_str())
+                                            {
+                                                if redux_type == "INIT" {
+                                                    if let Some(instance_id) = redux_params
+                                                        .get("instanceId")
+                                                        .and_then(|v| v.as_str())
+                                                    {
+                                                        let store_info = ReduxStoreInstance {
+                                                            instance_id: instance_id.to_string(),
+                                                            name: redux_params
+                                                                .get("name")
+                                                                .and_then(|v| v.as_str())
+                                                                .unwrap_or("Store")
+                                                                .to_string(),
+                                                            payload: redux_params
+                                                                .get("payload")
+                                                                .and_then(|v| v.as_str())
+                                                                .unwrap_or("{}")
+                                                                .to_string(),
+                                                            timestamp: redux_params
+                                                                .get("timestamp")
+                                                                .and_then(|v| v.as_i64())
+                                                                .unwrap_or_else(|| {
+                                                                    std::time::SystemTime::now()
+                                                                        .duration_since(
+                                                                            std::time::UNIX_EPOCH,
+                                                                        )
+                                                                        .unwrap()
+                                                                        .as_millis()
+                                                                        as i64
+                                                                }),
+                                                        };
+                                                        rn_manager_for_msg
+                                                            .store_redux_instance(
+                                                                &inspector_id_for_msg,
+                                                                store_info,
+                                                            )
+                                                            .await;
+                                                        logger_for_msg.log(
+                                                        LogType::RnInspector,
+                                                        &inspector_id_for_msg,
+                                                        &format!("📦 Cached Redux store INIT for instance {}", instance_id),
+                                                        None,
+                                                        None,
+                                                    );
+                                                    }
+                                                } else if redux_type == "ACTION" {
+                                                    if let Some(instance_id) = redux_params
+                                                        .get("instanceId")
+                                                        .and_then(|v| v.as_str())
+                                                    {
+                                                        let payload = redux_params
                                                             .get("payload")
                                                             .and_then(|v| v.as_str())
                                                             .unwrap_or("{}")
-                                                            .to_string(),
-                                                        timestamp: redux_params
+                                                            .to_string();
+                                                        let timestamp = redux_params
                                                             .get("timestamp")
                                                             .and_then(|v| v.as_i64())
                                                             .unwrap_or_else(|| {
@@ -132,121 +208,88 @@ pub async fn handle_react_native_inspector_websocket(
                                                                     .unwrap()
                                                                     .as_millis()
                                                                     as i64
-                                                            }),
-                                                    };
-                                                    rn_manager_for_msg
-                                                        .store_redux_instance(
-                                                            &inspector_id_for_msg,
-                                                            store_info,
-                                                        )
-                                                        .await;
-                                                    logger_for_msg.log(
-                                                        LogType::RnInspector,
-                                                        &inspector_id_for_msg,
-                                                        &format!("📦 Cached Redux store INIT for instance {}", instance_id),
-                                                        None,
-                                                        None,
-                                                    );
-                                                }
-                                            } else if redux_type == "ACTION" {
-                                                if let Some(instance_id) = redux_params
-                                                    .get("instanceId")
-                                                    .and_then(|v| v.as_str())
-                                                {
-                                                    let payload = redux_params
-                                                        .get("payload")
-                                                        .and_then(|v| v.as_str())
-                                                        .unwrap_or("{}")
-                                                        .to_string();
-                                                    let timestamp = redux_params
-                                                        .get("timestamp")
-                                                        .and_then(|v| v.as_i64())
-                                                        .unwrap_or_else(|| {
-                                                            std::time::SystemTime::now()
-                                                                .duration_since(
-                                                                    std::time::UNIX_EPOCH,
-                                                                )
-                                                                .unwrap()
-                                                                .as_millis()
-                                                                as i64
-                                                        });
-                                                    rn_manager_for_msg
-                                                        .update_redux_state(
-                                                            &inspector_id_for_msg,
-                                                            instance_id,
-                                                            payload,
-                                                            timestamp,
-                                                        )
-                                                        .await;
+                                                            });
+                                                        rn_manager_for_msg
+                                                            .update_redux_state(
+                                                                &inspector_id_for_msg,
+                                                                instance_id,
+                                                                payload,
+                                                                timestamp,
+                                                            )
+                                                            .await;
+                                                    }
                                                 }
                                             }
                                         }
                                     }
                                 }
+                            } else {
+                                logger_for_msg.log(
+                                    LogType::RnInspector,
+                                    &inspector_id_for_msg,
+                                    "received",
+                                    Some(&serde_json::json!(parsed)),
+                                    None,
+                                );
                             }
                         } else {
                             logger_for_msg.log(
                                 LogType::RnInspector,
                                 &inspector_id_for_msg,
-                                "received",
-                                Some(&serde_json::json!(parsed)),
+                                "received (raw)",
+                                Some(&serde_json::json!({ "data": text })),
                                 None,
                             );
                         }
-                    } else {
-                        logger_for_msg.log(
-                            LogType::RnInspector,
-                            &inspector_id_for_msg,
-                            "received (raw)",
-                            Some(&serde_json::json!({ "data": text })),
-                            None,
-                        );
-                    }
 
-                    // Get connection to find associated client / 연결을 가져와 연결된 클라이언트 찾기
-                    let connection = rn_manager_for_msg
-                        .get_connection(&inspector_id_for_msg)
-                        .await;
-                    if let Some(conn) = connection {
-                        let client_id_guard = conn.client_id.read().await;
-                        let client_id = client_id_guard.clone();
-                        drop(client_id_guard);
+                        // Get connection to find associated client / 연결을 가져와 연결된 클라이언트 찾기
+                        let connection = rn_manager_for_msg
+                            .get_connection(&inspector_id_for_msg)
+                            .await;
+                        if let Some(conn) = connection {
+                            let client_id_guard = conn.client_id.read().await;
+                            let client_id = client_id_guard.clone();
+                            drop(client_id_guard);
 
-                        if let Some(client_id) = client_id {
-                            // Forward to DevTools (if connected) / DevTools로 전달 (연결된 경우)
-                            let devtools = devtools_for_msg.read().await;
-                            let mut forwarded = false;
-                            for devtool in devtools.values() {
-                                if devtool.client_id.as_ref() == Some(&client_id) {
-                                    if let Err(e) = devtool.sender.send(text.clone()) {
-                                        logger_for_msg.log_error(
-                                            LogType::RnInspector,
-                                            &inspector_id_for_msg,
-                                            &format!("failed to send to devtools {}", devtool.id),
-                                            Some(&e.to_string()),
-                                        );
-                                    } else {
-                                        forwarded = true;
+                            if let Some(client_id) = client_id {
+                                // Forward to DevTools (if connected) / DevTools로 전달 (연결된 경우)
+                                let devtools = devtools_for_msg.read().await;
+                                let mut forwarded = false;
+                                for devtool in devtools.values() {
+                                    if devtool.client_id.as_ref() == Some(&client_id) {
+                                        if let Err(e) = devtool.sender.send(text.clone()) {
+                                            logger_for_msg.log_error(
+                                                LogType::RnInspector,
+                                                &inspector_id_for_msg,
+                                                &format!(
+                                                    "failed to send to devtools {}",
+                                                    devtool.id
+                                                ),
+                                                Some(&e.to_string()),
+                                            );
+                                        } else {
+                                            forwarded = true;
+                                        }
                                     }
                                 }
-                            }
-                            drop(devtools);
+                                drop(devtools);
 
-                            if !forwarded {
-                                logger_for_msg.log(
-                                    LogType::RnInspector,
-                                    &inspector_id_for_msg,
-                                    &format!(
+                                if !forwarded {
+                                    logger_for_msg.log(
+                                        LogType::RnInspector,
+                                        &inspector_id_for_msg,
+                                        &format!(
                                         "no devtools connected to forward message (clientId: {})",
                                         client_id
                                     ),
-                                    None,
-                                    None,
-                                );
-                            }
+                                        None,
+                                        None,
+                                    );
+                                }
 
-                            // Also forward to regular client if exists (for backward compatibility) / 일반 클라이언트가 있으면 전달 (하위 호환성)
-                            // This is handled by the client message handler / 이것은 클라이언트 메시지 핸들러에서 처리됨
+                                // Also forward to regular client if exists (for backward compatibility) / 일반 클라이언트가 있으면 전달 (하위 호환성)
+                                // This is handled by the client message handler / 이것은 클라이언트 메시지 핸들러에서 처리됨
+                            }
                         }
                     }
                 }
@@ -0,0 +1,271 @@
+// Response body stream drain for React Native Inspector / React Native Inspector용 응답 본문 스트림 수집
+use std::collections::{HashMap, HashSet};
+
+/// Default IO.read chunk size requested from native / 네이티브에 요청하는 기본 IO.read 청크 크기
+const IO_READ_CHUNK_BYTES: u64 = 64 * 1024;
+
+/// CDP server error code used when native gives no error details / 네이티브가 오류 정보를 주지 않을 때 사용하는 CDP 서버 오류 코드
+const SERVER_ERROR_CODE: i64 = -32000;
+
+/// Body being assembled from IO.read chunks / IO.read 청크로 조립 중인 본문
+struct PendingStream {
+    /// Id of the original Network.getResponseBody request / 원본 Network.getResponseBody 요청의 id
+    original_id: serde_json::Value,
+    handle: String,
+    body: String,
+    base64_encoded: bool,
+}
+
+/// Messages produced for one message from native / 네이티브 메시지 하나에 대해 생성된 메시지
+#[derive(Debug, Default, PartialEq)]
+pub struct StreamMessages {
+    /// Commands to send to native / 네이티브로 보낼 명령
+    pub to_native: Vec<String>,
+    /// Message to forward to DevTools / DevTools로 전달할 메시지
+    pub to_devtools: Option<String>,
+}
+
+/// Drains native response body streams into one Network.getResponseBody response /
+/// 네이티브 응답 본문 스트림을 하나의 Network.getResponseBody 응답으로 수집
+/// Large bodies are answered by native with `result.stream` instead of `result.body`, so the app never
+/// serializes them whole. The server pulls the chunks with IO.read and answers DevTools as usual /
+/// 큰 본문은 네이티브가 `result.body` 대신 `result.stream`으로 응답하므로 앱은 본문 전체를 직렬화하지 않음.
+/// 서버가 IO.read로 청크를 가져와 DevTools에 평소처럼 응답함
+/// Server-issued commands use negative ids so they never collide with DevTools ids /
+/// 서버가 보내는 명령은 음수 id를 사용하여 DevTools id와 충돌하지 않음
+#[derive(Default)]
+pub struct ResponseBodyStreams {
+    next_id: i64,
+    pending: HashMap<i64, PendingStream>,
+    closing: HashSet<i64>,
+}
+
+impl ResponseBodyStreams {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Handle message from native / 네이티브 메시지 처리
+    /// Returns None when the message is not part of a stream and should be forwarded as-is /
+    /// 스트림과 관련 없는 메시지는 None을 반환하며 그대로 전달해야 함
+    pub fn handle(&mut self, text: &str) -> Option<StreamMessages> {
+        // Cheap pre-check, most messages are events / 대부분의 메시지는 이벤트이므로 저렴한 사전 확인
+        let maybe_ours = !self.pending.is_empty() || !self.closing.is_empty();
+        if !maybe_ours && !text.contains("\"stream\"") {
+            return None;
+        }
+
+        let message: serde_json::Value = serde_json::from_str(text).ok()?;
+        let id = message.get("id")?;
+
+        if let Some(own_id) = id.as_i64().filter(|id| *id < 0) {
+            if self.closing.remove(&own_id) {
+                return Some(StreamMessages::default());
+            }
+            if let Some(stream) = self.pending.remove(&own_id) {
+                return Some(self.handle_read_response(stream, &message));
+            }
+            return None;
+        }
+
+        // Network.getResponseBody answered with a stream handle / 스트림 핸들로 응답된 Network.getResponseBody
+        let result = message.get("result")?;
+        let handle = result.get("stream")?.as_str()?.to_string();
+        let stream = PendingStream {
+            original_id: id.clone(),
+            handle,
+            body: String::new(),
+            base64_encoded: false,
+        };
+        Some(StreamMessages {
+            to_native: vec![self.read_command(stream)],
+            to_devtools: None,
+        })
+    }
+
+    fn handle_read_response(
+        &mut self,
+        mut stream: PendingStream,
+        message: &serde_json::Value,
+    ) -> StreamMessages {
+        let Some(result) = message.get("result") else {
+            // Body was evicted or handle is gone, fail the request rather than answer with a partial body /
+            // 본문이 제거되었거나 핸들이 없으므로 일부 본문으로 응답하지 않고 요청을 실패시킴
+            let close = self.close_command(&stream.handle);
+            return StreamMessages {
+                to_native: vec![close],
+                to_devtools: Some(Self::error_response(stream, message.get("error"))),
+            };
+        };
+
+        if let Some(data) = result.get("data").and_then(|d| d.as_str()) {
+            stream.body.push_str(data);
+        }
+        if result
+            .get("base64Encoded")
+            .and_then(|b| b.as_bool())
+            .unwrap_or(false)
+        {
+            stream.base64_encoded = true;
+        }
+
+        let eof = result.get("eof").and_then(|e| e.as_bool()).unwrap_or(true);
+        if eof {
+            let close = self.close_command(&stream.handle);
+            StreamMessages {
+                to_native: vec![close],
+                to_devtools: Some(Self::body_response(stream)),
+            }
+        } else {
+            StreamMessages {
+                to_native: vec![self.read_command(stream)],
+                to_devtools: None,
+            }
+        }
+    }
+
+    fn allocate_id(&mut self) -> i64 {
+        self.next_id -= 1;
+        self.next_id
+    }
+
+    fn read_command(&mut self, stream: PendingStream) -> String {
+        let id = self.allocate_id();
+        let command = serde_json::json!({
+            "id": id,
+            "method": "IO.read",
+            "params": { "handle": stream.handle, "size": IO_READ_CHUNK_BYTES }
+        })
+        .to_string();
+        self.pending.insert(id, stream);
+        command
+    }
+
+    fn close_command(&mut self, handle: &str) -> String {
+        let id = self.allocate_id();
+        self.closing.insert(id);
+        serde_json::json!({
+            "id": id,
+            "method": "IO.close",
+            "params": { "handle": handle }
+        })
+        .to_string()
+    }
+
+    fn body_response(stream: PendingStream) -> String {
+        serde_json::json!({
+            "id": stream.original_id,
+            "result": {
+                "body": stream.body,
+                "base64Encoded": stream.base64_encoded
+            }
+        })
+        .to_string()
+    }
+
+    fn error_response(stream: PendingStream, error: Option<&serde_json::Value>) -> String {
+        let code = error
+            .and_then(|e| e.get("code"))
+            .and_then(|c| c.as_i64())
+            .unwrap_or(SERVER_ERROR_CODE);
+        let message = error
+            .and_then(|e| e.get("message"))
+            .and_then(|m| m.as_str())
+            .unwrap_or("Failed to read response body stream");
+        serde_json::json!({
+            "id": stream.original_id,
+            "error": { "code": code, "message": message }
+        })
+        .to_string()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn parse(text: &str) -> serde_json::Value {
+        serde_json::from_str(text).unwrap()
+    }
+
+    #[test]
+    /// Test regular messages are not touched / 일반 메시지는 건드리지 않는지 테스트
+    fn test_passes_through_regular_messages() {
+        let mut streams = ResponseBodyStreams::new();
+        assert!(streams
+            .handle(r#"{"method":"Network.dataReceived","params":{}}"#)
+            .is_none());
+        assert!(streams
+            .handle(r#"{"id":3,"result":{"body":"x","base64Encoded":false}}"#)
+            .is_none());
+    }
+
+    #[test]
+    /// Test stream is drained into one getResponseBody response / 스트림이 하나의 getResponseBody 응답으로 수집되는지 테스트
+    fn test_drains_stream() {
+        let mut streams = ResponseBodyStreams::new();
+        let start = streams
+            .handle(
+                r#"{"id":7,"result":{"body":"","base64Encoded":false,"stream":"response-body-1"}}"#,
+            )
+            .unwrap();
+        assert!(start.to_devtools.is_none());
+        let read = parse(&start.to_native[0]);
+        assert_eq!(read["method"], "IO.read");
+        assert_eq!(read["params"]["handle"], "response-body-1");
+        let read_id = read["id"].as_i64().unwrap();
+        assert!(read_id < 0);
+
+        let next = streams
+            .handle(&format!(
+                r#"{{"id":{},"result":{{"data":"hello ","eof":false,"base64Encoded":false}}}}"#,
+                read_id
+            ))
+            .unwrap();
+        assert!(next.to_devtools.is_none());
+        let read_id = parse(&next.to_native[0])["id"].as_i64().unwrap();
+
+        let last = streams
+            .handle(&format!(
+                r#"{{"id":{},"result":{{"data":"world","eof":true,"base64Encoded":false}}}}"#,
+                read_id
+            ))
+            .unwrap();
+        let close = parse(&last.to_native[0]);
+        assert_eq!(close["method"], "IO.close");
+        let response = parse(last.to_devtools.as_ref().unwrap());
+        assert_eq!(response["id"], 7);
+        assert_eq!(response["result"]["body"], "hello world");
+        assert_eq!(response["result"]["base64Encoded"], false);
+
+        // IO.close response is swallowed / IO.close 응답은 전달되지 않음
+        let closed = streams
+            .handle(&format!(r#"{{"id":{},"result":{{}}}}"#, close["id"]))
+            .unwrap();
+        assert_eq!(closed, StreamMessages::default());
+    }
+
+    #[test]
+    /// Test read error is forwarded to DevTools as an error / 읽기 오류가 DevTools에 오류로 전달되는지 테스트
+    fn test_read_error_answers_devtools() {
+        let mut streams = ResponseBodyStreams::new();
+        let start = streams
+            .handle(r#"{"id":9,"result":{"body":"","stream":"response-body-2"}}"#)
+            .unwrap();
+        let read_id = parse(&start.to_native[0])["id"].as_i64().unwrap();
+        let failed = streams
+            .handle(&format!(
+                r#"{{"id":{},"error":{{"code":-32000,"message":"evicted"}}}}"#,
+                read_id
+            ))
+            .unwrap();
+        let close = parse(&failed.to_native[0]);
+        assert_eq!(close["method"], "IO.close");
+        assert_eq!(close["params"]["handle"], "response-body-2");
+        let response = parse(failed.to_devtools.as_ref().unwrap());
+        assert_eq!(response["id"], 9);
+        assert!(response.get("result").is_none());
+        assert_eq!(response["error"]["code"], -32000);
+        assert_eq!(response["error"]["message"], "evicted");
+    }
+}
@@ -29,6 +29,15 @@
 #include "ConsoleHook.h"
 // Include network hook / 네트워크 훅 포함
 #include "NetworkHook.h"
+// Include profiler hook / 프로파일러 훅 포함
+#include "ProfilerHook.h"
+// Include performance hook and JS thread stall watchdog / 성능 훅과 JS 스레드 멈춤 감시기 포함
+#include "PerformanceHook.h"
+#include "StallWatchdog.h"
+// Include hook metrics (ChromeRemoteDevTools domain) / 훅 메트릭 포함 (ChromeRemoteDevTools 도메인)
+#include "InspectorHook.h"
+// Include deferred hook installation / 지연 훅 설치 포함
+#include "HookInstaller.h"
 // Note: Redux DevTools Extension is handled by JavaScript polyfill, not C++ / 참고: Redux DevTools Extension은 C++가 아닌 JavaScript polyfill로 처리됩니다
 // C++ version was removed because it doesn't fully support Redux Toolkit's .apply() pattern / C++ 버전은 Redux Toolkit의 .apply() 패턴을 완전히 지원하지 않아 제거되었습니다
 
@@ -47,18 +56,36 @@ static facebook::react::RuntimeExecutor g_runtimeExecutor = nullptr;
 static std::mutex g_runtimeExecutorMutex;
 #endif
 
+// Cached class/method for sendCDPMessageFromNative / sendCDPMessageFromNative를 위한 캐시된 클래스/메서드
+// Resolved in JNI_OnLoad because FindClass on a native thread only sees the system class loader /
+// 네이티브 스레드에서의 FindClass는 시스템 클래스 로더만 보므로 JNI_OnLoad에서 확인
+static jclass g_logHookJNIClass = nullptr;
+static jmethodID g_sendCDPMessageFromNativeMethod = nullptr;
+
+// Detaches the sender thread from the JVM when it exits / 전송 스레드가 종료될 때 JVM에서 분리
+struct JNIThreadAttachment {
+  bool attached = false;
+  ~JNIThreadAttachment() {
+    if (attached && g_jvm != nullptr) {
+      g_jvm->DetachCurrentThread();
+    }
+  }
+};
+
 // JNI callback implementation for Android / Android용 JNI 콜백 구현
+// Called from the shared C++ sender thread, which stays attached for its lifetime /
+// 공유 C++ 전송 스레드에서 호출되며, 스레드 수명 동안 연결 상태 유지
 void sendCDPMessageAndroid(const char* serverHost, int serverPort, const char* message) {
-  if (g_jvm == nullptr) {
+  if (g_jvm == nullptr || g_logHookJNIClass == nullptr || g_sendCDPMessageFromNativeMethod == nullptr) {
     __android_log_print(ANDROID_LOG_ERROR, TAG,
                         "JVM not available for sending CDP message / CDP 메시지 전송을 위한 JVM을 사용할 수 없습니다");
     return;
   }
 
+  static thread_local JNIThreadAttachment threadAttachment;
   JNIEnv* env = nullptr;
-  bool attached = false;
 
-  // Attach current thread to JVM if needed / 필요시 현재 스레드를 JVM에 연결
+  // Attach current thread to JVM once / 현재 스레드를 JVM에 한 번만 연결
   int status = g_jvm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6);
   if (status == JNI_EDETACHED) {
     if (g_jvm->AttachCurrentThread(&env, nullptr) != JNI_OK) {
@@ -66,7 +93,7 @@ void sendCDPMessageAndroid(const char* serverHost, int serverPort, const char* m
                           "Failed to attach thread to JVM / 스레드를 JVM에 연결하지 못했습니다");
       return;
     }
-    attached = true;
+    threadAttachment.attached = true;
   } else if (status != JNI_OK) {
     __android_log_print(ANDROID_LOG_ERROR, TAG,
                         "Failed to get JNI environment / JNI 환경을 가져오지 못했습니다");
@@ -74,33 +101,6 @@ void sendCDPMessageAndroid(const char* serverHost, int serverPort, const char* m
   }
 
   try {
-    // Get class reference / 클래스 참조 가져오기
-    jclass clazz = env->FindClass("com/ohah/chromeremotedevtools/ChromeRemoteDevToolsLogHookJNI");
-    if (clazz == nullptr) {
-      __android_log_print(ANDROID_LOG_ERROR, TAG,
-                          "Failed to find ChromeRemoteDevToolsLogHookJNI class / ChromeRemoteDevToolsLogHookJNI 클래스를 찾지 못했습니다");
-      if (attached) {
-        g_jvm->DetachCurrentThread();
-      }
-      return;
-    }
-
-    // Get method ID / 메서드 ID 가져오기
-    jmethodID methodId = env->GetStaticMethodID(
-        clazz,
-        "sendCDPMessageFromNative",
-        "(Ljava/lang/String;ILjava/lang/String;)V");
-
-    if (methodId == nullptr) {
-      __android_log_print(ANDROID_LOG_ERROR, TAG,
-                          "Failed to find sendCDPMessageFromNative method / sendCDPMessageFromNative 메서드를 찾지 못했습니다");
-      env->DeleteLocalRef(clazz);
-      if (attached) {
-        g_jvm->DetachCurrentThread();
-      }
-      return;
-    }
-
     // Convert C++ strings to Java strings / C++ 문자열을 Java 문자열로 변환
     jstring jServerHost = env->NewStringUTF(serverHost);
     jstring jMessage = env->NewStringUTF(message);
@@ -108,17 +108,16 @@ void sendCDPMessageAndroid(const char* serverHost, int serverPort, const char* m
     if (jServerHost == nullptr || jMessage == nullptr) {
       __android_log_print(ANDROID_LOG_ERROR, TAG,
                           "Failed to create Java strings / Java 문자열을 생성하지 못했습니다");
+      if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+      }
       if (jServerHost != nullptr) env->DeleteLocalRef(jServerHost);
       if (jMessage != nullptr) env->DeleteLocalRef(jMessage);
-      env->DeleteLocalRef(clazz);
-      if (attached) {
-        g_jvm->DetachCurrentThread();
-      }
       return;
     }
 
     // Call the Kotlin function / Kotlin 함수 호출
-    env->CallStaticVoidMethod(clazz, methodId, jServerHost, serverPort, jMessage);
+    env->CallStaticVoidMethod(g_logHookJNIClass, g_sendCDPMessageFromNativeMethod, jServerHost, serverPort, jMessage);
 
     // Check for exceptions / 예외 확인
     if (env->ExceptionCheck()) {
@@ -129,10 +128,6 @@ void sendCDPMessageAndroid(const char* serverHost, int serverPort, const char* m
     // Clean up local references / 로컬 참조 정리
     env->DeleteLocalRef(jServerHost);
     env->DeleteLocalRef(jMessage);
-    env->DeleteLocalRef(clazz);
-
-    __android_log_print(ANDROID_LOG_DEBUG, TAG,
-                        "CDP message sent via JNI / JNI를 통해 CDP 메시지 전송됨");
   } catch (const std::exception& e) {
     __android_log_print(ANDROID_LOG_ERROR, TAG,
                         "Exception in sendCDPMessageAndroid: %s", e.what());
@@ -140,23 +135,43 @@ void sendCDPMessageAndroid(const char* serverHost, int serverPort, const char* m
     __android_log_print(ANDROID_LOG_ERROR, TAG,
                         "Unknown exception in sendCDPMessageAndroid / sendCDPMessageAndroid에서 알 수 없는 예외 발생");
   }
-
-  // Detach thread if we attached it / 연결한 경우 스레드 분리
-  if (attached) {
-    g_jvm->DetachCurrentThread();
-  }
 }
 
 // Hook console methods using common C++ code / 공통 C++ 코드를 사용하여 console 메서드 훅
 #ifdef REACT_NATIVE_JSI_AVAILABLE
 static void hookJSILogging(facebook::jsi::Runtime& runtime) {
   try {
+    // Drop handles cached for a reloaded runtime, it may share this runtime's address /
+    // 리로드된 런타임의 캐시 핸들 폐기, 이 런타임과 주소가 같을 수 있음
+    chrome_remote_devtools::attachRuntime(runtime);
+
     // Set platform callback before hooking / 훅하기 전에 플랫폼 콜백 설정
     chrome_remote_devtools::setSendCDPMessageCallback(sendCDPMessageAndroid);
 
+    // Deferred mode: hooks are installed when a DevTools client first enables a domain /
+    // 지연 모드: DevTools 클라이언트가 도메인을 처음 활성화할 때 훅 설치
+    if (chrome_remote_devtools::getHookInstallMode() == chrome_remote_devtools::HookInstallMode::Deferred) {
+      facebook::react::RuntimeExecutor executor = nullptr;
+      {
+        std::lock_guard<std::mutex> lock(g_runtimeExecutorMutex);
+        executor = g_runtimeExecutor;
+      }
+      chrome_remote_devtools::installDeferredHooks(
+          runtime, [executor](std::function<void(facebook::jsi::Runtime&)> task) {
+            if (executor) {
+              executor(std::move(task));
+            }
+          });
+      __android_log_print(ANDROID_LOG_INFO, TAG,
+                          "JSI hooks deferred until a DevTools client enables a domain / DevTools 클라이언트가 도메인을 활성화할 때까지 JSI 훅 지연");
+      return;
+    }
+
     // Use common C++ hook function / 공통 C++ 훅 함수 사용
     bool consoleSuccess = chrome_remote_devtools::hookConsoleMethods(runtime);
     bool networkSuccess = chrome_remote_devtools::hookNetworkMethods(runtime);
+    // Hook cost report for in-app benchmarks / 앱 내 벤치마크를 위한 훅 비용 보고서
+    chrome_remote_devtools::installHookMetricsGetter(runtime);
 
     // Verify flag was updated / 플래그가 업데이트되었는지 확인
     bool consoleFlag = chrome_remote_devtools::isConsoleHookEnabled();
@@ -253,6 +268,11 @@ Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeHookJSIL
       g_runtimeExecutor = executor;
     }
 
+    // Measure JS thread responsiveness through the same executor while a client watches /
+    // 클라이언트가 보고 있는 동안 같은 executor로 JS 스레드 응답성 측정
+    chrome_remote_devtools::startStallWatchdog(
+        [executor](std::function<void(facebook::jsi::Runtime&)> task) { executor(std::move(task)); });
+
     // Call RuntimeExecutor to access JSI runtime and install hook /
     // RuntimeExecutor를 호출하여 JSI 런타임에 접근하고 훅 설치
     __android_log_print(ANDROID_LOG_INFO, TAG,
@@ -627,6 +647,113 @@ Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeIsNetwor
 #endif
 }
 
+// Convert jstring to std::string (empty for null) / jstring을 std::string으로 변환 (null이면 빈 문자열)
+static std::string jstringToStdString(JNIEnv *env, jstring value) {
+  if (!value) {
+    return "";
+  }
+  const char* chars = env->GetStringUTFChars(value, nullptr);
+  if (!chars) {
+    return "";
+  }
+  std::string result(chars);
+  env->ReleaseStringUTFChars(value, chars);
+  return result;
+}
+
+// JNI function to open IO stream for a large response body / 큰 응답 본문에 대한 IO 스트림을 여는 JNI 함수
+extern "C" JNIEXPORT jstring JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeOpenNetworkResponseBodyStream(
+    JNIEnv *env,
+    jobject /* thiz */,
+    jstring requestId) {
+  try {
+    std::string handle = chrome_remote_devtools::openNetworkResponseBodyStream(jstringToStdString(env, requestId));
+    if (handle.empty()) {
+      return nullptr;
+    }
+    return env->NewStringUTF(handle.c_str());
+  } catch (...) {
+    __android_log_print(ANDROID_LOG_ERROR, TAG,
+                        "Unknown exception in nativeOpenNetworkResponseBodyStream");
+    return nullptr;
+  }
+}
+
+// JNI function to handle IO.read / IO.read를 처리하는 JNI 함수
+// Returns the complete CDP response, chunks are bounded so NewStringUTF stays small /
+// 완전한 CDP 응답 반환, 청크 크기가 제한되어 NewStringUTF가 작게 유지됨
+extern "C" JNIEXPORT jstring JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeReadIOStream(
+    JNIEnv *env,
+    jobject /* thiz */,
+    jlong messageId,
+    jstring handle,
+    jlong offset,
+    jint size) {
+  try {
+    std::string response = chrome_remote_devtools::readIOStream(
+        static_cast<int64_t>(messageId), jstringToStdString(env, handle),
+        static_cast<int64_t>(offset), size > 0 ? static_cast<size_t>(size) : 0);
+    return env->NewStringUTF(response.c_str());
+  } catch (...) {
+    __android_log_print(ANDROID_LOG_ERROR, TAG,
+                        "Unknown exception in nativeReadIOStream");
+    return nullptr;
+  }
+}
+
+// JNI function to handle IO.close / IO.close를 처리하는 JNI 함수
+extern "C" JNIEXPORT void JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeCloseIOStream(
+    JNIEnv *env,
+    jobject /* thiz */,
+    jstring handle) {
+  try {
+    chrome_remote_devtools::closeIOStream(jstringToStdString(env, handle));
+  } catch (...) {
+    __android_log_print(ANDROID_LOG_ERROR, TAG,
+                        "Unknown exception in nativeCloseIOStream");
+  }
+}
+
+// JNI function to set directory for spilled response bodies / spill된 응답 본문 디렉토리를 설정하는 JNI 함수
+extern "C" JNIEXPORT void JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeSetResponseBodySpillDirectory(
+    JNIEnv *env,
+    jobject /* thiz */,
+    jstring directory) {
+  try {
+    std::string directoryCpp = jstringToStdString(env, directory);
+    if (directoryCpp.empty()) {
+      return;
+    }
+    chrome_remote_devtools::setResponseBodySpillDirectory(directoryCpp);
+  } catch (...) {
+    __android_log_print(ANDROID_LOG_ERROR, TAG,
+                        "Unknown exception in nativeSetResponseBodySpillDirectory");
+  }
+}
+
+// JNI function to set the response body store budget / 응답 본문 저장소 예산을 설정하는 JNI 함수
+// Applied on the next stored body / 다음에 저장되는 본문부터 적용됨
+extern "C" JNIEXPORT void JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeSetResponseBodyBudget(
+    JNIEnv * /* env */,
+    jobject /* thiz */,
+    jlong maxMemoryBytes,
+    jlong spillThresholdBytes,
+    jlong maxSpillBytes) {
+  if (maxMemoryBytes < 0 || spillThresholdBytes < 0 || maxSpillBytes < 0) {
+    __android_log_print(ANDROID_LOG_WARN, TAG,
+                        "Ignoring negative response body budget / 음수 응답 본문 예산 무시");
+    return;
+  }
+  chrome_remote_devtools::setResponseBodyBudget(static_cast<size_t>(maxMemoryBytes),
+                                                static_cast<size_t>(spillThresholdBytes),
+                                                static_cast<size_t>(maxSpillBytes));
+}
+
 // JNI function to get network response body / 네트워크 응답 본문을 가져오는 JNI 함수
 extern "C" JNIEXPORT jstring JNICALL
 Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeGetNetworkResponseBody(
@@ -679,6 +806,24 @@ Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeGetNetwo
   }
 }
 
+// JNI function to check if a response body is returned base64-encoded / 응답 본문이 base64로 인코딩되어 반환되는지 확인하는 JNI 함수
+extern "C" JNIEXPORT jboolean JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeIsNetworkResponseBodyBase64Encoded(
+    JNIEnv *env,
+    jobject /* thiz */,
+    jstring requestId) {
+  try {
+    if (!requestId) {
+      return JNI_FALSE;
+    }
+    return chrome_remote_devtools::isNetworkResponseBodyBase64Encoded(jstringToStdString(env, requestId)) ? JNI_TRUE : JNI_FALSE;
+  } catch (...) {
+    __android_log_print(ANDROID_LOG_ERROR, TAG,
+                        "Exception in nativeIsNetworkResponseBodyBase64Encoded");
+    return JNI_FALSE;
+  }
+}
+
 // JNI function to get object properties / 객체 속성을 가져오는 JNI 함수
 extern "C" JNIEXPORT jstring JNICALL
 Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeGetObjectProperties(
@@ -782,6 +927,308 @@ Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeGetObjec
   }
 }
 
+// JNI function to release retained objects / 보유 중인 객체를 해제하는 JNI 함수
+// Handles Runtime.releaseObject, Runtime.releaseObjectGroup and Runtime.discardConsoleEntries /
+// Runtime.releaseObject, Runtime.releaseObjectGroup, Runtime.discardConsoleEntries 처리
+// Runs asynchronously on the JS thread; the caller does not wait / JS 스레드에서 비동기로 실행되며 호출자는 대기하지 않음
+extern "C" JNIEXPORT void JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeReleaseRemoteObjects(
+    JNIEnv *env,
+    jobject /* thiz */,
+    jstring method,
+    jstring argument) {
+#ifdef REACT_NATIVE_JSI_AVAILABLE
+  try {
+    if (!method) {
+      return;
+    }
+
+    facebook::react::RuntimeExecutor executor = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(g_runtimeExecutorMutex);
+      executor = g_runtimeExecutor;
+    }
+    if (!executor) {
+      __android_log_print(ANDROID_LOG_WARN, TAG,
+                          "nativeReleaseRemoteObjects: RuntimeExecutor not available / RuntimeExecutor를 사용할 수 없음");
+      return;
+    }
+
+    std::string methodCpp = jstringToStdString(env, method);
+    if (methodCpp.empty()) {
+      return;
+    }
+    std::string argumentCpp = jstringToStdString(env, argument);
+
+    executor([methodCpp, argumentCpp](facebook::jsi::Runtime& runtime) {
+      try {
+        if (methodCpp == "Runtime.releaseObject") {
+          chrome_remote_devtools::releaseObject(runtime, argumentCpp);
+        } else if (methodCpp == "Runtime.releaseObjectGroup") {
+          chrome_remote_devtools::releaseObjectGroup(runtime, argumentCpp);
+        } else if (methodCpp == "Runtime.discardConsoleEntries") {
+          chrome_remote_devtools::discardConsoleEntries(runtime);
+        }
+      } catch (...) {
+        __android_log_print(ANDROID_LOG_ERROR, TAG,
+                            "Exception releasing remote objects / 원격 객체 해제 중 예외");
+      }
+    });
+  } catch (...) {
+    __android_log_print(ANDROID_LOG_ERROR, TAG,
+                        "Unknown exception in nativeReleaseRemoteObjects");
+  }
+#else
+  (void)env;
+  (void)method;
+  (void)argument;
+#endif
+}
+
+// JNI function to handle Profiler and HeapProfiler domain commands / Profiler, HeapProfiler 도메인 명령을 처리하는 JNI 함수
+// Runs asynchronously on the JS thread, the response is sent by C++ through the CDP event sender /
+// JS 스레드에서 비동기로 실행되며, 응답은 C++가 CDP 이벤트 전송기를 통해 전송함
+// Returns false if the command could not be scheduled / 명령을 예약할 수 없으면 false 반환
+extern "C" JNIEXPORT jboolean JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeHandleProfilerCommand(
+    JNIEnv *env,
+    jobject /* thiz */,
+    jstring message) {
+#ifdef REACT_NATIVE_JSI_AVAILABLE
+  try {
+    if (!message) {
+      return JNI_FALSE;
+    }
+
+    facebook::react::RuntimeExecutor executor = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(g_runtimeExecutorMutex);
+      executor = g_runtimeExecutor;
+    }
+    if (!executor) {
+      __android_log_print(ANDROID_LOG_WARN, TAG,
+                          "nativeHandleProfilerCommand: RuntimeExecutor not available / RuntimeExecutor를 사용할 수 없음");
+      return JNI_FALSE;
+    }
+
+    std::string messageCpp = jstringToStdString(env, message);
+    executor([messageCpp](facebook::jsi::Runtime& runtime) {
+      try {
+        chrome_remote_devtools::handleProfilerCommand(runtime, messageCpp);
+      } catch (...) {
+        __android_log_print(ANDROID_LOG_ERROR, TAG,
+                            "Exception handling Profiler command / Profiler 명령 처리 중 예외");
+      }
+    });
+    return JNI_TRUE;
+  } catch (...) {
+    __android_log_print(ANDROID_LOG_ERROR, TAG,
+                        "Unknown exception in nativeHandleProfilerCommand");
+    return JNI_FALSE;
+  }
+#else
+  (void)env;
+  (void)message;
+  return JNI_FALSE;
+#endif
+}
+
+// JNI function to handle Performance domain commands / Performance 도메인 명령을 처리하는 JNI 함수
+// Runs asynchronously on the JS thread, the response is sent by C++ through the CDP event sender /
+// JS 스레드에서 비동기로 실행되며, 응답은 C++가 CDP 이벤트 전송기를 통해 전송함
+// Returns false if the command could not be scheduled / 명령을 예약할 수 없으면 false 반환
+extern "C" JNIEXPORT jboolean JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeHandlePerformanceCommand(
+    JNIEnv *env,
+    jobject /* thiz */,
+    jstring message) {
+#ifdef REACT_NATIVE_JSI_AVAILABLE
+  try {
+    if (!message) {
+      return JNI_FALSE;
+    }
+
+    facebook::react::RuntimeExecutor executor = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(g_runtimeExecutorMutex);
+      executor = g_runtimeExecutor;
+    }
+    if (!executor) {
+      __android_log_print(ANDROID_LOG_WARN, TAG,
+                          "nativeHandlePerformanceCommand: RuntimeExecutor not available / RuntimeExecutor를 사용할 수 없음");
+      return JNI_FALSE;
+    }
+
+    std::string messageCpp = jstringToStdString(env, message);
+    executor([messageCpp](facebook::jsi::Runtime& runtime) {
+      try {
+        chrome_remote_devtools::handlePerformanceCommand(runtime, messageCpp);
+      } catch (...) {
+        __android_log_print(ANDROID_LOG_ERROR, TAG,
+                            "Exception handling Performance command / Performance 명령 처리 중 예외");
+      }
+    });
+    return JNI_TRUE;
+  } catch (...) {
+    __android_log_print(ANDROID_LOG_ERROR, TAG,
+                        "Unknown exception in nativeHandlePerformanceCommand");
+    return JNI_FALSE;
+  }
+#else
+  (void)env;
+  (void)message;
+  return JNI_FALSE;
+#endif
+}
+
+// JNI function to handle ChromeRemoteDevTools domain commands (hook metrics) / ChromeRemoteDevTools 도메인 명령 (훅 메트릭)을 처리하는 JNI 함수
+// Runs asynchronously on the JS thread, the response is sent by C++ through the CDP event sender /
+// JS 스레드에서 비동기로 실행되며, 응답은 C++가 CDP 이벤트 전송기를 통해 전송함
+// Returns false if the command could not be scheduled / 명령을 예약할 수 없으면 false 반환
+extern "C" JNIEXPORT jboolean JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeHandleInspectorCommand(
+    JNIEnv *env,
+    jobject /* thiz */,
+    jstring message) {
+#ifdef REACT_NATIVE_JSI_AVAILABLE
+  try {
+    if (!message) {
+      return JNI_FALSE;
+    }
+
+    facebook::react::RuntimeExecutor executor = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(g_runtimeExecutorMutex);
+      executor = g_runtimeExecutor;
+    }
+    if (!executor) {
+      __android_log_print(ANDROID_LOG_WARN, TAG,
+                          "nativeHandleInspectorCommand: RuntimeExecutor not available / RuntimeExecutor를 사용할 수 없음");
+      return JNI_FALSE;
+    }
+
+    std::string messageCpp = jstringToStdString(env, message);
+    executor([messageCpp](facebook::jsi::Runtime& runtime) {
+      try {
+        chrome_remote_devtools::handleInspectorCommand(runtime, messageCpp);
+      } catch (...) {
+        __android_log_print(ANDROID_LOG_ERROR, TAG,
+                            "Exception handling ChromeRemoteDevTools command / ChromeRemoteDevTools 명령 처리 중 예외");
+      }
+    });
+    return JNI_TRUE;
+  } catch (...) {
+    __android_log_print(ANDROID_LOG_ERROR, TAG,
+                        "Unknown exception in nativeHandleInspectorCommand");
+    return JNI_FALSE;
+  }
+#else
+  (void)env;
+  (void)message;
+  return JNI_FALSE;
+#endif
+}
+
+// JNI function to choose deferred hook installation / 지연 훅 설치를 선택하는 JNI 함수
+// Takes effect for the next nativeHookJSILog / 다음 nativeHookJSILog부터 적용됨
+extern "C" JNIEXPORT void JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeSetDeferredHookInstall(
+    JNIEnv * /* env */,
+    jobject /* thiz */,
+    jboolean deferred) {
+  chrome_remote_devtools::setHookInstallMode(deferred == JNI_TRUE ? chrome_remote_devtools::HookInstallMode::Deferred
+                                                                  : chrome_remote_devtools::HookInstallMode::Eager);
+}
+
+// JNI function to set the retention budget of inspectable objects / 검사 가능 객체의 보유 예산을 설정하는 JNI 함수
+// Applied on the next retained object / 다음에 보유하는 객체부터 적용됨
+extern "C" JNIEXPORT void JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeSetObjectRetentionBudget(
+    JNIEnv * /* env */,
+    jobject /* thiz */,
+    jint maxObjects,
+    jlong maxBytes) {
+  if (maxObjects <= 0 || maxBytes <= 0) {
+    __android_log_print(ANDROID_LOG_WARN, TAG,
+                        "Ignoring non-positive object retention budget / 양수가 아닌 객체 보유 예산 무시");
+    return;
+  }
+  chrome_remote_devtools::setObjectRetentionBudget(static_cast<size_t>(maxObjects), static_cast<size_t>(maxBytes));
+}
+
+// JNI function to release per-runtime state before the React instance is destroyed /
+// React 인스턴스가 파괴되기 전에 런타임별 상태를 해제하는 JNI 함수
+// Runs asynchronously on the JS thread; if the runtime is gone first the state is abandoned on the next hook /
+// JS 스레드에서 비동기로 실행되며, 런타임이 먼저 사라지면 다음 훅 설치 시 상태를 버림
+extern "C" JNIEXPORT void JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeDetachRuntime(
+    JNIEnv * /* env */,
+    jobject /* thiz */) {
+#ifdef REACT_NATIVE_JSI_AVAILABLE
+  try {
+    facebook::react::RuntimeExecutor executor = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(g_runtimeExecutorMutex);
+      executor = g_runtimeExecutor;
+    }
+    if (!executor) {
+      return;
+    }
+    executor([](facebook::jsi::Runtime& runtime) {
+      try {
+        chrome_remote_devtools::detachRuntime(runtime);
+      } catch (...) {
+        __android_log_print(ANDROID_LOG_ERROR, TAG,
+                            "Exception releasing runtime state / 런타임 상태 해제 중 예외");
+      }
+    });
+  } catch (...) {
+    __android_log_print(ANDROID_LOG_ERROR, TAG,
+                        "Unknown exception in nativeDetachRuntime");
+  }
+#endif
+}
+
+// JNI function to report the DevTools connection state / DevTools 연결 상태를 보고하는 JNI 함수
+// Hooks skip all capture work while disconnected / 연결이 없는 동안 훅은 모든 캡처 작업을 건너뜀
+extern "C" JNIEXPORT void JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeSetDevToolsConnected(
+    JNIEnv * /* env */,
+    jobject /* thiz */,
+    jboolean connected) {
+  chrome_remote_devtools::setDevToolsConnected(connected == JNI_TRUE);
+}
+
+// JNI function to report a DevTools client attaching or detaching through the relay server /
+// 릴레이 서버를 통한 DevTools 클라이언트 연결 또는 분리를 보고하는 JNI 함수
+extern "C" JNIEXPORT void JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeSetDevToolsAttached(
+    JNIEnv * /* env */,
+    jobject /* thiz */,
+    jboolean attached,
+    jboolean resumed) {
+  chrome_remote_devtools::setDevToolsAttached(attached == JNI_TRUE, resumed == JNI_TRUE);
+}
+
+// JNI function to track Runtime/Console/Log/Network enable and disable / Runtime/Console/Log/Network enable, disable을 추적하는 JNI 함수
+// Runs on the calling thread, it only flips an atomic flag / 호출 스레드에서 실행되며 원자 플래그만 바꿈
+extern "C" JNIEXPORT jboolean JNICALL
+Java_com_ohah_chromeremotedevtools_ChromeRemoteDevToolsLogHookJNI_nativeTrackDomainSubscription(
+    JNIEnv *env,
+    jobject /* thiz */,
+    jstring method) {
+  try {
+    if (!method) {
+      return JNI_FALSE;
+    }
+    return chrome_remote_devtools::trackDomainSubscription(jstringToStdString(env, method)) ? JNI_TRUE : JNI_FALSE;
+  } catch (...) {
+    __android_log_print(ANDROID_LOG_ERROR, TAG,
+                        "Unknown exception in nativeTrackDomainSubscription");
+    return JNI_FALSE;
+  }
+}
+
 // Note: nativeSetReduxDevToolsServerInfo was removed / nativeSetReduxDevToolsServerInfo 제거됨
 // Redux DevTools Extension server info is now set via JavaScript polyfill / Redux DevTools Extension 서버 정보는 이제 JavaScript polyfill을 통해 설정됩니다
 
@@ -917,6 +1364,24 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void* /* reserved */) {
     return JNI_ERR;
   }
 
+  // Cache callback class/method while the app class loader is available / 앱 클래스 로더를 사용할 수 있을 때 콜백 클래스/메서드 캐시
+  jclass clazz = env->FindClass("com/ohah/chromeremotedevtools/ChromeRemoteDevToolsLogHookJNI");
+  if (clazz != nullptr) {
+    g_logHookJNIClass = reinterpret_cast<jclass>(env->NewGlobalRef(clazz));
+    g_sendCDPMessageFromNativeMethod = env->GetStaticMethodID(
+        clazz,
+        "sendCDPMessageFromNative",
+        "(Ljava/lang/String;ILjava/lang/String;)V");
+    env->DeleteLocalRef(clazz);
+  }
+  if (env->ExceptionCheck()) {
+    env->ExceptionClear();
+  }
+  if (g_logHookJNIClass == nullptr || g_sendCDPMessageFromNativeMethod == nullptr) {
+    __android_log_print(ANDROID_LOG_ERROR, TAG,
+                        "JNI_OnLoad: Failed to resolve sendCDPMessageFromNative / sendCDPMessageFromNative 확인 실패");
+  }
+
 
   __android_log_print(ANDROID_LOG_INFO, TAG,
                       "JNI_OnLoad: Library loaded / JNI_OnLoad: 라이브러리 로드됨");
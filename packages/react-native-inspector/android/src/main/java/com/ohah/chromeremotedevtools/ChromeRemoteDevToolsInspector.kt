@@ -75,6 +75,48 @@ object ChromeRemoteDevToolsInspector {
     return serverHost
   }
 
+  /**
+   * Defer console and network hooks until a DevTools client enables their domain / DevTools 클라이언트가 도메인을 활성화할 때까지 console, 네트워크 훅 지연
+   * Keeps hook installation out of app startup; hooks are removed again when the client detaches.
+   * Call before connect (e.g. in Application.onCreate) /
+   * 훅 설치를 앱 시작에서 제외하며, 클라이언트가 분리되면 훅을 다시 제거함. connect 전에 호출해야 함 (예: Application.onCreate)
+   */
+  fun setDeferredHookInstall(deferred: Boolean) {
+    try {
+      ChromeRemoteDevToolsLogHookJNI.nativeSetDeferredHookInstall(deferred)
+    } catch (e: Throwable) {
+      android.util.Log.w("ChromeRemoteDevToolsInspector", "Failed to set deferred hook install / 지연 훅 설치 설정 실패: ${e.message}")
+    }
+  }
+
+  /**
+   * Set how many console objects stay inspectable / 검사 가능한 상태로 유지할 console 객체 수 설정
+   * Least recently used objects are evicted beyond the budget (default 5000 objects, 8 MB) /
+   * 예산을 초과하면 가장 오래 사용되지 않은 객체부터 제거 (기본값 5000개, 8 MB)
+   */
+  fun setObjectRetentionBudget(maxObjects: Int, maxBytes: Long) {
+    try {
+      ChromeRemoteDevToolsLogHookJNI.nativeSetObjectRetentionBudget(maxObjects, maxBytes)
+    } catch (e: Throwable) {
+      android.util.Log.w("ChromeRemoteDevToolsInspector", "Failed to set object retention budget / 객체 보유 예산 설정 실패: ${e.message}")
+    }
+  }
+
+  /**
+   * Set how many response bodies are kept for Network.getResponseBody / Network.getResponseBody를 위해 보관할 응답 본문 양 설정
+   * Bodies above spillThresholdBytes go to the app cache directory. Least recently stored bodies are evicted beyond
+   * the budget (default 32 MB in memory, 256 KB threshold, 128 MB on disk) /
+   * spillThresholdBytes보다 큰 본문은 앱 캐시 디렉토리로 이동. 예산을 초과하면 가장 오래전에 저장된 본문부터 제거
+   * (기본값 메모리 32 MB, 임계값 256 KB, 디스크 128 MB)
+   */
+  fun setResponseBodyBudget(maxMemoryBytes: Long, spillThresholdBytes: Long, maxSpillBytes: Long) {
+    try {
+      ChromeRemoteDevToolsLogHookJNI.nativeSetResponseBodyBudget(maxMemoryBytes, spillThresholdBytes, maxSpillBytes)
+    } catch (e: Throwable) {
+      android.util.Log.w("ChromeRemoteDevToolsInspector", "Failed to set response body budget / 응답 본문 예산 설정 실패: ${e.message}")
+    }
+  }
+
   /**
    * Connect to Chrome Remote DevTools server / Chrome Remote DevTools 서버에 연결
    */
@@ -152,12 +194,15 @@ object ChromeRemoteDevToolsInspector {
 
   /**
    * Send CDP message / CDP 메시지 전송
+   * @param awaitSendQueue Wait for the socket send queue to drain first (native sender thread only) /
+   *   먼저 소켓 송신 큐가 비워지기를 기다림 (네이티브 전송 스레드 전용)
    */
   fun sendCDPMessage(
     context: Context,
     serverHost: String,
     serverPort: Int,
-    message: String
+    message: String,
+    awaitSendQueue: Boolean = false
   ) {
     // Normalize server host for Android emulator / Android 에뮬레이터용 서버 호스트 정규화
     val normalizedHost = normalizeServerHost(serverHost)
@@ -169,6 +214,9 @@ object ChromeRemoteDevToolsInspector {
 
     val connection = socketConnections[url]
     if (connection != null && connection.isConnected()) {
+      if (awaitSendQueue) {
+        connection.awaitSendQueue()
+      }
       connection.sendCDPMessage(message)
     }
   }
@@ -178,6 +178,17 @@ class ChromeRemoteDevToolsInspectorModule(reactApplicationContext: ReactApplicat
     // Note: We don't disconnect here to allow background debugging / 참고: 백그라운드 디버깅을 허용하기 위해 여기서 연결을 끊지 않음
   }
 
+  override fun invalidate() {
+    // React instance is being destroyed, release retained objects while the runtime is alive /
+    // React 인스턴스가 파괴되는 중이므로 런타임이 살아 있는 동안 보유 객체 해제
+    try {
+      ChromeRemoteDevToolsLogHookJNI.nativeDetachRuntime()
+    } catch (e: Throwable) {
+      android.util.Log.w(NAME, "Failed to release runtime state / 런타임 상태 해제 실패: ${e.message}")
+    }
+    super.invalidate()
+  }
+
   override fun onHostDestroy() {
     // App is being destroyed / 앱이 파괴되는 중
     android.util.Log.d(NAME, "App destroyed, cleaning up / 앱이 파괴됨, 정리 중")
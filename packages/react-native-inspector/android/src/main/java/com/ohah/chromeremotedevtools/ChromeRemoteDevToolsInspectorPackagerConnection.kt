@@ -52,6 +52,13 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
     private const val MAX_RECONNECT_ATTEMPTS = 10 // Maximum reconnection attempts / 최대 재연결 시도 횟수
     private const val INITIAL_RECONNECT_DELAY_MS = 1000L // Initial delay: 1 second / 초기 지연: 1초
     private const val MAX_RECONNECT_DELAY_MS = 30000L // Maximum delay: 30 seconds / 최대 지연: 30초
+    // OkHttp closes the socket above 16 MiB of queued data / OkHttp는 큐 데이터가 16 MiB를 넘으면 소켓을 닫음
+    private const val MAX_QUEUED_SEND_BYTES = 4L * 1024 * 1024 // 4 MiB
+    private const val SEND_QUEUE_POLL_MS = 2L
+    private const val SEND_QUEUE_STALL_TIMEOUT_MS = 5000L
+    // Sent by the relay server, see devtools_session_message / 릴레이 서버가 전송, devtools_session_message 참고
+    private const val DEVTOOLS_ATTACHED_METHOD = "ChromeRemoteDevTools.devtoolsAttached"
+    private const val DEVTOOLS_DETACHED_METHOD = "ChromeRemoteDevTools.devtoolsDetached"
   }
 
   /**
@@ -107,6 +114,18 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
     isReconnecting = false
   }
 
+  /**
+   * Report connection state to native hooks / 네이티브 훅에 연결 상태 보고
+   * Hooks skip capture work while disconnected / 연결이 없는 동안 훅은 캡처 작업을 건너뜀
+   */
+  private fun reportDevToolsConnected(connected: Boolean) {
+    try {
+      ChromeRemoteDevToolsLogHookJNI.nativeSetDevToolsConnected(connected)
+    } catch (e: Throwable) {
+      Log.w(TAG, "Failed to report connection state / 연결 상태 보고 실패: ${e.message}")
+    }
+  }
+
   /**
    * Connect to WebSocket server / WebSocket 서버에 연결
    */
@@ -140,6 +159,7 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
         reconnectAttempts = 0 // Reset reconnect attempts on successful connection / 성공적인 연결 시 재연결 시도 횟수 초기화
         isReconnecting = false
         cancelReconnect() // Cancel any pending reconnection attempts / 대기 중인 재연결 시도 취소
+        reportDevToolsConnected(true)
         Log.d(TAG, "WebSocket connected successfully / WebSocket 연결 성공")
         Log.d(TAG, "Response code: ${response.code}, message: ${response.message}")
         Log.d(TAG, "WebSocket instance / WebSocket 인스턴스: $webSocket")
@@ -168,6 +188,16 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
               val method = message.getString("method")
               Log.d(TAG, "Method: $method")
 
+              // Hooks only capture domains a client has enabled; the command itself is handled below /
+              // 훅은 클라이언트가 활성화한 도메인만 캡처함, 명령 자체는 아래에서 처리
+              if (method.endsWith(".enable") || method.endsWith(".disable")) {
+                try {
+                  ChromeRemoteDevToolsLogHookJNI.nativeTrackDomainSubscription(method)
+                } catch (e: Throwable) {
+                  Log.w(TAG, "Failed to track domain subscription / 도메인 구독 추적 실패: ${e.message}")
+                }
+              }
+
               // Handle Page.getResourceTree request / Page.getResourceTree 요청 처리
               if (method == "Page.getResourceTree") {
                 Log.d(TAG, "Page.getResourceTree detected! / Page.getResourceTree 감지됨!")
@@ -201,6 +231,76 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
                 return
               }
 
+              // Handle IO.read / IO.close for streamed response bodies / 스트림 응답 본문을 위한 IO.read / IO.close 처리
+              if (method == "IO.read") {
+                val params = message.optJSONObject("params")
+                val handle = params?.optString("handle") ?: ""
+                val offset = if (params?.has("offset") == true) params.optLong("offset", -1L) else -1L
+                val size = params?.optInt("size", 0) ?: 0
+                val response = try {
+                  ChromeRemoteDevToolsLogHookJNI.nativeReadIOStream(cdpRequestId.toLong(), handle, offset, size)
+                } catch (e: Exception) {
+                  Log.e(TAG, "Failed to read IO stream / IO 스트림 읽기 실패: ${e.message}", e)
+                  null
+                }
+                if (response != null) {
+                  sendCDPMessage(response)
+                } else {
+                  sendEmptyResultResponse(cdpRequestId)
+                }
+                return
+              }
+              if (method == "IO.close") {
+                val handle = message.optJSONObject("params")?.optString("handle") ?: ""
+                try {
+                  ChromeRemoteDevToolsLogHookJNI.nativeCloseIOStream(handle)
+                } catch (e: Exception) {
+                  Log.e(TAG, "Failed to close IO stream / IO 스트림 닫기 실패: ${e.message}", e)
+                }
+                sendEmptyResultResponse(cdpRequestId)
+                return
+              }
+
+              // Handle Profiler and HeapProfiler domains in native code (Hermes) / Profiler, HeapProfiler 도메인을 네이티브 코드에서 처리 (Hermes)
+              // Native code sends the response once the JS thread has run the command / JS 스레드에서 명령이 실행되면 네이티브 코드가 응답 전송
+              if (method.startsWith("Profiler.") || method.startsWith("HeapProfiler.")) {
+                val scheduled = try {
+                  ChromeRemoteDevToolsLogHookJNI.nativeHandleProfilerCommand(text)
+                } catch (e: Exception) {
+                  Log.e(TAG, "Failed to handle Profiler command / Profiler 명령 처리 실패: ${e.message}", e)
+                  false
+                }
+                if (scheduled) {
+                  return
+                }
+              }
+
+              // Handle Performance domain in native code (process and heap statistics) / Performance 도메인을 네이티브 코드에서 처리 (프로세스, 힙 통계)
+              if (method.startsWith("Performance.")) {
+                val scheduled = try {
+                  ChromeRemoteDevToolsLogHookJNI.nativeHandlePerformanceCommand(text)
+                } catch (e: Exception) {
+                  Log.e(TAG, "Failed to handle Performance command / Performance 명령 처리 실패: ${e.message}", e)
+                  false
+                }
+                if (scheduled) {
+                  return
+                }
+              }
+
+              // Handle the inspector's own domain in native code (hook metrics) / 인스펙터 자체 도메인을 네이티브 코드에서 처리 (훅 메트릭)
+              if (method.startsWith("ChromeRemoteDevTools.")) {
+                val scheduled = try {
+                  ChromeRemoteDevToolsLogHookJNI.nativeHandleInspectorCommand(text)
+                } catch (e: Exception) {
+                  Log.e(TAG, "Failed to handle ChromeRemoteDevTools command / ChromeRemoteDevTools 명령 처리 실패: ${e.message}", e)
+                  false
+                }
+                if (scheduled) {
+                  return
+                }
+              }
+
               // Handle Runtime.getProperties request / Runtime.getProperties 요청 처리
               if (method == "Runtime.getProperties") {
                 Log.d(TAG, "Runtime.getProperties detected! / Runtime.getProperties 감지됨!")
@@ -211,6 +311,24 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
                 return
               }
 
+              // Handle object release requests / 객체 해제 요청 처리
+              // Retained objects live in the C++ handle table / 보유 객체는 C++ 핸들 테이블에 있음
+              if (method == "Runtime.releaseObject" || method == "Runtime.releaseObjectGroup" || method == "Runtime.discardConsoleEntries") {
+                val params = message.optJSONObject("params")
+                val argument = when (method) {
+                  "Runtime.releaseObject" -> params?.optString("objectId") ?: ""
+                  "Runtime.releaseObjectGroup" -> params?.optString("objectGroup") ?: ""
+                  else -> ""
+                }
+                try {
+                  ChromeRemoteDevToolsLogHookJNI.nativeReleaseRemoteObjects(method, argument)
+                } catch (e: Exception) {
+                  Log.e(TAG, "Failed to release remote objects / 원격 객체 해제 실패: ${e.message}", e)
+                }
+                sendEmptyResultResponse(cdpRequestId)
+                return
+              }
+
               // Route other CDP commands to JavaScript handler / 다른 CDP 명령을 JavaScript 핸들러로 라우팅
               // Handler routes based on method name / 핸들러가 메서드 이름을 기준으로 라우팅
               Log.d(TAG, "Routing CDP command to JavaScript handler / CDP 명령을 JavaScript 핸들러로 라우팅: $method")
@@ -221,6 +339,16 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
             // Handle CDP events (messages without id field) / CDP 이벤트 처리 (id 필드가 없는 메시지)
             val method = message.getString("method")
             Log.d(TAG, "CDP event received / CDP 이벤트 수신: $method")
+
+            // Relay server reports DevTools clients attaching and detaching / 릴레이 서버가 DevTools 클라이언트 연결과 분리를 알림
+            if (method == DEVTOOLS_ATTACHED_METHOD || method == DEVTOOLS_DETACHED_METHOD) {
+              val resumed = message.optJSONObject("params")?.optBoolean("resumed", false) ?: false
+              try {
+                ChromeRemoteDevToolsLogHookJNI.nativeSetDevToolsAttached(method == DEVTOOLS_ATTACHED_METHOD, resumed)
+              } catch (e: Throwable) {
+                Log.w(TAG, "Failed to report DevTools session / DevTools 세션 보고 실패: ${e.message}")
+              }
+            }
           } else {
             Log.d(TAG, "Message has no method field / 메시지에 method 필드 없음")
           }
@@ -233,6 +361,7 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
 
       override fun onFailure(webSocket: WebSocket, t: Throwable, response: Response?) {
         isConnected = false
+        reportDevToolsConnected(false)
         val errorMessage = "WebSocket connection failed / WebSocket 연결 실패"
         Log.e(TAG, errorMessage, t)
         Log.e(TAG, "═══════════════════════════════════════════════════════════")
@@ -265,6 +394,7 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
 
       override fun onClosing(webSocket: WebSocket, code: Int, reason: String) {
         isConnected = false
+        reportDevToolsConnected(false)
         Log.d(TAG, "WebSocket closing / WebSocket 종료 중: code=$code, reason=$reason")
         Log.d(TAG, "WebSocket instance / WebSocket 인스턴스: $webSocket")
       }
@@ -298,6 +428,7 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
     cancelReconnect() // Cancel any pending reconnection attempts / 대기 중인 재연결 시도 취소
     webSocket?.close(1000, "Normal closure / 정상 종료")
     isConnected = false
+    reportDevToolsConnected(false)
   }
 
   /**
@@ -330,6 +461,23 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
     connect()
   }
 
+  /**
+   * Wait until OkHttp has flushed enough queued data / OkHttp가 큐 데이터를 충분히 내보낼 때까지 대기
+   * Only for the native sender thread, so bulk streams (heap snapshots) never overflow the socket queue /
+   * 네이티브 전송 스레드 전용이며 대량 스트림(힙 스냅샷)이 소켓 큐를 넘치지 않도록 함
+   */
+  fun awaitSendQueue() {
+    val socket = webSocket ?: return
+    var lastQueued = socket.queueSize()
+    var stalledMs = 0L
+    while (isConnected && lastQueued > MAX_QUEUED_SEND_BYTES && stalledMs < SEND_QUEUE_STALL_TIMEOUT_MS) {
+      Thread.sleep(SEND_QUEUE_POLL_MS)
+      val queued = socket.queueSize()
+      stalledMs = if (queued < lastQueued) 0L else stalledMs + SEND_QUEUE_POLL_MS
+      lastQueued = queued
+    }
+  }
+
   /**
    * Send CDP message / CDP 메시지 전송
    */
@@ -390,6 +538,34 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
   private fun sendNetworkGetResponseBodyResponse(requestId: Int, networkRequestId: String) {
     Log.d(TAG, "sendNetworkGetResponseBodyResponse called / sendNetworkGetResponseBodyResponse 호출됨: requestId=$requestId, networkRequestId=$networkRequestId")
 
+    // Large bodies are answered with a stream handle and pulled with IO.read /
+    // 큰 본문은 스트림 핸들로 응답하고 IO.read로 가져감
+    val streamHandle = try {
+      ChromeRemoteDevToolsLogHookJNI.nativeOpenNetworkResponseBodyStream(networkRequestId)
+    } catch (e: Exception) {
+      Log.e(TAG, "Failed to open response body stream / 응답 본문 스트림 열기 실패: ${e.message}", e)
+      null
+    }
+    if (streamHandle != null) {
+      val response = org.json.JSONObject().apply {
+        put("id", requestId)
+        put("result", org.json.JSONObject().apply {
+          put("body", "")
+          put("base64Encoded", false)
+          put("stream", streamHandle)
+        })
+      }
+      sendCDPMessage(response.toString())
+      return
+    }
+
+    // Binary bodies come back base64-encoded / 바이너리 본문은 base64로 인코딩되어 반환됨
+    val base64Encoded = try {
+      ChromeRemoteDevToolsLogHookJNI.nativeIsNetworkResponseBodyBase64Encoded(networkRequestId)
+    } catch (e: Exception) {
+      false
+    }
+
     // Get response body from C++ network hook via JNI / JNI를 통해 C++ network 훅에서 응답 본문 가져오기
     val responseBody = try {
       ChromeRemoteDevToolsLogHookJNI.nativeGetNetworkResponseBody(networkRequestId) ?: ""
@@ -408,7 +584,7 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
       put("id", requestId)
       put("result", org.json.JSONObject().apply {
         put("body", responseBody)
-        put("base64Encoded", false)
+        put("base64Encoded", base64Encoded)
       })
     }
 
@@ -417,6 +593,18 @@ class ChromeRemoteDevToolsInspectorPackagerConnection(
     sendCDPMessage(messageStr)
   }
 
+  /**
+   * Send empty result response / 빈 result 응답 전송
+   * @param requestId CDP request ID / CDP 요청 ID
+   */
+  private fun sendEmptyResultResponse(requestId: Int) {
+    val response = org.json.JSONObject().apply {
+      put("id", requestId)
+      put("result", org.json.JSONObject())
+    }
+    sendCDPMessage(response.toString())
+  }
+
   /**
    * Send empty Runtime.getProperties response / 빈 Runtime.getProperties 응답 전송
    * @param requestId CDP request ID / CDP 요청 ID
@@ -95,6 +95,57 @@ class ChromeRemoteDevToolsLogHookJNI {
     @JvmStatic
     external fun nativeGetNetworkResponseBody(requestId: String): String?
 
+    /**
+     * Check if response body is returned base64-encoded (binary bodies) / 응답 본문이 base64로 인코딩되어 반환되는지 확인 (바이너리 본문)
+     * Must be called before nativeGetNetworkResponseBody, which removes the body / 본문을 제거하는 nativeGetNetworkResponseBody보다 먼저 호출해야 함
+     * @param requestId Network request ID / 네트워크 요청 ID
+     * @return true if the body is base64 / 본문이 base64이면 true
+     */
+    @JvmStatic
+    external fun nativeIsNetworkResponseBodyBase64Encoded(requestId: String): Boolean
+
+    /**
+     * Set directory for large response bodies / 큰 응답 본문을 위한 디렉토리 설정
+     * @param directory App cache directory / 앱 캐시 디렉토리
+     */
+    @JvmStatic
+    external fun nativeSetResponseBodySpillDirectory(directory: String)
+
+    /**
+     * Set response body store budget / 응답 본문 저장소 예산 설정
+     * @param maxMemoryBytes Bytes kept in native heap / 네이티브 힙에 보관되는 바이트
+     * @param spillThresholdBytes Bodies larger than this spill to disk / 이보다 큰 본문은 디스크로 spill
+     * @param maxSpillBytes Bytes kept on disk / 디스크에 보관되는 바이트
+     */
+    @JvmStatic
+    external fun nativeSetResponseBodyBudget(maxMemoryBytes: Long, spillThresholdBytes: Long, maxSpillBytes: Long)
+
+    /**
+     * Open IO stream for a large response body / 큰 응답 본문에 대한 IO 스트림 열기
+     * @param requestId Network request ID / 네트워크 요청 ID
+     * @return Stream handle, or null if the body is small or not found / 스트림 핸들, 본문이 작거나 없으면 null
+     */
+    @JvmStatic
+    external fun nativeOpenNetworkResponseBodyStream(requestId: String): String?
+
+    /**
+     * Handle IO.read / IO.read 처리
+     * @param messageId CDP message ID / CDP 메시지 ID
+     * @param handle Stream handle / 스트림 핸들
+     * @param offset Read offset, negative to continue / 읽기 오프셋, 음수면 이어서 읽음
+     * @param size Maximum bytes, 0 for default chunk size / 최대 바이트, 0이면 기본 청크 크기
+     * @return Complete CDP response JSON / 완전한 CDP 응답 JSON
+     */
+    @JvmStatic
+    external fun nativeReadIOStream(messageId: Long, handle: String, offset: Long, size: Int): String?
+
+    /**
+     * Handle IO.close / IO.close 처리
+     * @param handle Stream handle / 스트림 핸들
+     */
+    @JvmStatic
+    external fun nativeCloseIOStream(handle: String)
+
     /**
      * Get object properties for Runtime.getProperties / Runtime.getProperties를 위한 객체 속성 가져오기
      * @param objectId Object ID / 객체 ID
@@ -103,6 +154,93 @@ class ChromeRemoteDevToolsLogHookJNI {
     @JvmStatic
     external fun nativeGetObjectProperties(objectId: String): String?
 
+    /**
+     * Release retained objects on the JS thread / JS 스레드에서 보유 중인 객체 해제
+     * @param method Runtime.releaseObject, Runtime.releaseObjectGroup or Runtime.discardConsoleEntries
+     * @param argument objectId or objectGroup (empty for discardConsoleEntries) / objectId 또는 objectGroup (discardConsoleEntries는 빈 문자열)
+     */
+    @JvmStatic
+    external fun nativeReleaseRemoteObjects(method: String, argument: String)
+
+    /**
+     * Handle Profiler or HeapProfiler domain command on the JS thread / JS 스레드에서 Profiler 또는 HeapProfiler 도메인 명령 처리
+     * The response is sent by native code, callers must not answer the command / 응답은 네이티브 코드가 전송하므로 호출자는 명령에 응답하면 안 됨
+     * @param message CDP command as JSON string / JSON 문자열로 된 CDP 명령
+     * @return true if the command was scheduled / 명령이 예약되면 true
+     */
+    @JvmStatic
+    external fun nativeHandleProfilerCommand(message: String): Boolean
+
+    /**
+     * Handle Performance domain command on the JS thread / JS 스레드에서 Performance 도메인 명령 처리
+     * The response is sent by native code, callers must not answer the command / 응답은 네이티브 코드가 전송하므로 호출자는 명령에 응답하면 안 됨
+     * @param message CDP command as JSON string / JSON 문자열로 된 CDP 명령
+     * @return true if the command was scheduled / 명령이 예약되면 true
+     */
+    @JvmStatic
+    external fun nativeHandlePerformanceCommand(message: String): Boolean
+
+    /**
+     * Handle ChromeRemoteDevTools domain command (hook metrics) on the JS thread / JS 스레드에서 ChromeRemoteDevTools 도메인 명령 (훅 메트릭) 처리
+     * The response is sent by native code, callers must not answer the command / 응답은 네이티브 코드가 전송하므로 호출자는 명령에 응답하면 안 됨
+     * @param message CDP command as JSON string / JSON 문자열로 된 CDP 명령
+     * @return true if the command was scheduled / 명령이 예약되면 true
+     */
+    @JvmStatic
+    external fun nativeHandleInspectorCommand(message: String): Boolean
+
+    /**
+     * Report the DevTools connection state / DevTools 연결 상태 보고
+     * Console, XHR and fetch hooks call the original directly while disconnected / 연결이 없는 동안 console, XHR, fetch 훅은 원본을 바로 호출
+     * @param connected true on open, false on close or failure / 열리면 true, 닫히거나 실패하면 false
+     */
+    @JvmStatic
+    external fun nativeSetDevToolsConnected(connected: Boolean)
+
+    /**
+     * Report a DevTools client attaching or detaching, as announced by the relay server /
+     * 릴레이 서버가 알린 DevTools 클라이언트 연결 또는 분리 보고
+     * Detach forgets enabled domains, so capture stops until a client enables them again /
+     * 분리되면 활성화된 도메인을 잊으므로 클라이언트가 다시 활성화할 때까지 캡처 중지
+     * @param attached true for devtoolsAttached, false for devtoolsDetached / devtoolsAttached면 true, devtoolsDetached면 false
+     * @param resumed params.resumed of devtoolsAttached / devtoolsAttached의 params.resumed
+     */
+    @JvmStatic
+    external fun nativeSetDevToolsAttached(attached: Boolean, resumed: Boolean)
+
+    /**
+     * Choose deferred hook installation / 지연 훅 설치 선택
+     * Takes effect for the next nativeHookJSILog / 다음 nativeHookJSILog부터 적용됨
+     * @param deferred true to install hooks on first domain enable / 첫 도메인 활성화 시 훅을 설치하려면 true
+     */
+    @JvmStatic
+    external fun nativeSetDeferredHookInstall(deferred: Boolean)
+
+    /**
+     * Set the retention budget of objects kept for Runtime.getProperties / Runtime.getProperties를 위해 보유하는 객체의 예산 설정
+     * Least recently used objects are evicted beyond the budget / 예산을 초과하면 가장 오래 사용되지 않은 객체부터 제거
+     * @param maxObjects Maximum retained objects / 최대 보유 객체 수
+     * @param maxBytes Approximate maximum retained bytes / 대략적인 최대 보유 바이트
+     */
+    @JvmStatic
+    external fun nativeSetObjectRetentionBudget(maxObjects: Int, maxBytes: Long)
+
+    /**
+     * Release per-runtime state (retained objects) on the JS thread / JS 스레드에서 런타임별 상태 (보유 객체) 해제
+     * Call when the React instance is being destroyed / React 인스턴스가 파괴될 때 호출
+     */
+    @JvmStatic
+    external fun nativeDetachRuntime()
+
+    /**
+     * Track Runtime, Console, Log and Network enable/disable / Runtime, Console, Log, Network enable/disable 추적
+     * Only records the subscription, callers still handle the command / 구독만 기록하며 호출자는 명령을 계속 처리해야 함
+     * @param method CDP method name / CDP 메서드 이름
+     * @return true if the method was a tracked enable/disable command / 추적하는 enable/disable 명령이었으면 true
+     */
+    @JvmStatic
+    external fun nativeTrackDomainSubscription(method: String): Boolean
+
     /**
      * Handle CDP message from WebSocket using JSI / JSI를 사용하여 WebSocket에서 CDP 메시지 처리
      * This is the Android equivalent of iOS handleCDPMessage: method / 이것은 iOS handleCDPMessage: 메서드와 동등한 Android 버전입니다
@@ -134,7 +272,9 @@ class ChromeRemoteDevToolsLogHookJNI {
             context = context,
             serverHost = serverHost,
             serverPort = serverPort,
-            message = message
+            message = message,
+            // Called on the native sender thread, which may wait / 대기해도 되는 네이티브 전송 스레드에서 호출됨
+            awaitSendQueue = true
           )
         } else {
           Log.w(TAG, "Application context not available, cannot send CDP message / 애플리케이션 컨텍스트를 사용할 수 없어 CDP 메시지를 전송할 수 없습니다")
@@ -154,6 +294,13 @@ class ChromeRemoteDevToolsLogHookJNI {
     @JvmStatic
     fun setApplicationContext(context: android.content.Context) {
       g_applicationContext = context.applicationContext
+
+      // Large response bodies spill to the app cache directory / 큰 응답 본문은 앱 캐시 디렉토리로 spill
+      try {
+        nativeSetResponseBodySpillDirectory(context.cacheDir.absolutePath)
+      } catch (e: Throwable) {
+        Log.w(TAG, "Failed to set response body spill directory / 응답 본문 spill 디렉토리 설정 실패: ${e.message}")
+      }
     }
 
   }
@@ -11,6 +11,9 @@
 #include "console/ConsoleHook.h"
 #include "console/ConsoleUtils.h"
 #include "console/ConsoleRuntime.h"
+#include "console/ObjectHandleTable.h"
+#include "transport/CDPEventSender.h"
+#include "common/JSIHandleCache.h"
 #include <atomic>
 
 // Platform-specific log support / 플랫폼별 로그 지원
@@ -30,13 +33,22 @@ namespace chrome_remote_devtools {
 
 // Platform-specific callback for sending CDP messages / CDP 메시지 전송을 위한 플랫폼별 콜백
 // Note: Made non-static so NetworkHook can access it / 참고: NetworkHook에서 접근할 수 있도록 static 제거
-SendCDPMessageCallback g_sendCDPMessageCallback = nullptr;
+// Atomic because the sender thread reads it while platform code replaces it / 플랫폼 코드가 교체하는 동안 전송 스레드가 읽으므로 atomic
+std::atomic<SendCDPMessageCallback> g_sendCDPMessageCallback{nullptr};
 
 // Track console hook state / console 훅 상태 추적
 static std::atomic<bool> g_isConsoleHooked{false};
 
 void setSendCDPMessageCallback(SendCDPMessageCallback callback) {
-  g_sendCDPMessageCallback = callback;
+  if (callback == nullptr) {
+    // Drain and stop sender before clearing callback it reads / 전송 스레드가 읽는 콜백을 해제하기 전에 비우고 중지
+    transport::stopCDPEventSender();
+    g_sendCDPMessageCallback.store(nullptr, std::memory_order_release);
+    return;
+  }
+  g_sendCDPMessageCallback.store(callback, std::memory_order_release);
+  // Callback is invoked from the sender thread, not the JS thread / 콜백은 JS 스레드가 아닌 전송 스레드에서 호출됨
+  transport::startCDPEventSender();
 }
 
 RemoteObject jsiValueToRemoteObject(facebook::jsi::Runtime& runtime, const facebook::jsi::Value& value) {
@@ -119,6 +131,18 @@ bool disableConsoleHook(facebook::jsi::Runtime& runtime) {
         }
       }
 
+      // Drop retained objects and captured originals; runtime is alive so handles can be released here /
+      // 보유 객체와 캡처된 원본 제거, 런타임이 살아 있으므로 여기서 핸들 해제 가능
+      console::clearObjectTable(runtime);
+      if (common::JSIHandleCache* handleCache = common::getHandleCache(runtime)) {
+        handleCache->clearFunction(common::CachedFunction::ConsoleLog);
+        handleCache->clearFunction(common::CachedFunction::ConsoleWarn);
+        handleCache->clearFunction(common::CachedFunction::ConsoleError);
+        handleCache->clearFunction(common::CachedFunction::ConsoleInfo);
+        handleCache->clearFunction(common::CachedFunction::ConsoleDebug);
+        common::releaseHandleCache(runtime);
+      }
+
       // Only update flag if restoration succeeded / 복원이 성공했을 때만 플래그 업데이트
       if (allRestored) {
         g_isConsoleHooked.store(false);
@@ -139,6 +163,25 @@ std::string getObjectProperties(facebook::jsi::Runtime& runtime, const std::stri
   return console::getObjectProperties(runtime, objectId, ownProperties);
 }
 
+void releaseObject(facebook::jsi::Runtime& runtime, const std::string& objectId) {
+  console::releaseObject(runtime, objectId);
+}
+
+void releaseObjectGroup(facebook::jsi::Runtime& runtime, const std::string& objectGroup) {
+  console::releaseObjectGroup(runtime, objectGroup);
+}
+
+void discardConsoleEntries(facebook::jsi::Runtime& runtime) {
+  console::discardConsoleEntries(runtime);
+}
+
+void setObjectRetentionBudget(size_t maxObjects, size_t maxBytes) {
+  console::ObjectRetentionBudget budget;
+  budget.maxObjects = maxObjects;
+  budget.maxBytes = maxBytes;
+  console::setObjectRetentionBudget(budget);
+}
+
 bool isConsoleHookEnabled() {
   // Return flag value / 플래그 값 반환
   // Note: For Android, runtime state check is done in JNI layer / 참고: Android의 경우 런타임 상태 확인은 JNI 레이어에서 수행됨
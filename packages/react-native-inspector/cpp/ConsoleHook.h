@@ -32,12 +32,17 @@ struct RemoteObject {
   std::string type;
   std::string subtype;  // Optional: "array", "null", "error", etc. / 선택사항: "array", "null", "error" 등
   std::string value;    // For primitive types / 기본 타입용
-  std::string description;  // For objects, contains JSON stringified value / 객체의 경우 JSON 문자열화된 값 포함
+  std::string description;  // For objects: "Object", "Array(3)", "f name()", error stack... / 객체의 경우: "Object", "Array(3)", "f name()", 에러 stack 등
   std::string objectId;  // Optional: Object ID for Runtime.getProperties / 선택사항: Runtime.getProperties를 위한 객체 ID
+  std::string className;  // Optional: Constructor name for objects / 선택사항: 객체의 생성자 이름
+  std::string preview;  // Optional: Serialized CDP ObjectPreview JSON / 선택사항: 직렬화된 CDP ObjectPreview JSON
 };
 
 /**
  * Set platform-specific callback for sending CDP messages / CDP 메시지 전송을 위한 플랫폼별 콜백 설정
+ * The callback is called from a dedicated sender thread, never from the JS thread /
+ * 콜백은 JS 스레드가 아닌 전용 전송 스레드에서 호출됨
+ * Passing nullptr drains pending messages and stops the sender thread / nullptr를 전달하면 대기 중인 메시지를 비우고 전송 스레드를 중지
  * @param callback Callback function / 콜백 함수
  */
 void setSendCDPMessageCallback(SendCDPMessageCallback callback);
@@ -85,7 +90,8 @@ bool isConsoleHookEnabled(facebook::jsi::Runtime& runtime);
 RemoteObject jsiValueToRemoteObject(facebook::jsi::Runtime& runtime, const facebook::jsi::Value& value);
 
 /**
- * Find object by __cdpObjectId in runtime / 런타임에서 __cdpObjectId로 객체 찾기
+ * Find object by objectId / objectId로 객체 찾기
+ * Objects are retained in a native handle table, O(1) lookup / 객체는 네이티브 핸들 테이블에 보유되며 O(1) 조회
  * @param runtime JSI runtime instance / JSI 런타임 인스턴스
  * @param objectId Object ID to find / 찾을 객체 ID
  * @return JSI Value of the object, or undefined if not found / 객체의 JSI Value, 찾지 못하면 undefined
@@ -101,5 +107,35 @@ facebook::jsi::Value findObjectById(facebook::jsi::Runtime& runtime, const std::
  */
 std::string getObjectProperties(facebook::jsi::Runtime& runtime, const std::string& objectId, bool ownProperties = false);
 
+/**
+ * Release one retained object (Runtime.releaseObject) / 보유 중인 객체 하나 해제 (Runtime.releaseObject)
+ * @param runtime JSI runtime instance / JSI 런타임 인스턴스
+ * @param objectId Object ID / 객체 ID
+ */
+void releaseObject(facebook::jsi::Runtime& runtime, const std::string& objectId);
+
+/**
+ * Release all objects of a group (Runtime.releaseObjectGroup) / 그룹의 모든 객체 해제 (Runtime.releaseObjectGroup)
+ * Each console message has its own group; "console" releases all of them /
+ * console 메시지마다 자체 그룹이 있으며, "console"은 모두 해제
+ * @param runtime JSI runtime instance / JSI 런타임 인스턴스
+ * @param objectGroup Object group name / 객체 그룹 이름
+ */
+void releaseObjectGroup(facebook::jsi::Runtime& runtime, const std::string& objectGroup);
+
+/**
+ * Release objects of all console messages (Runtime.discardConsoleEntries) / 모든 console 메시지의 객체 해제 (Runtime.discardConsoleEntries)
+ * @param runtime JSI runtime instance / JSI 런타임 인스턴스
+ */
+void discardConsoleEntries(facebook::jsi::Runtime& runtime);
+
+/**
+ * Set retention budget for inspectable objects / 검사 가능 객체의 보유 예산 설정
+ * Least recently used objects are evicted beyond the budget / 예산을 초과하면 가장 오래 사용되지 않은 객체부터 제거
+ * @param maxObjects Maximum retained objects / 최대 보유 객체 수
+ * @param maxBytes Approximate maximum retained bytes / 대략적인 최대 보유 바이트
+ */
+void setObjectRetentionBudget(size_t maxObjects, size_t maxBytes);
+
 } // namespace chrome_remote_devtools
 
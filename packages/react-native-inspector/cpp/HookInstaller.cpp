@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "HookInstaller.h"
+#include "ConsoleHook.h"
+#include "NetworkHook.h"
+#include "InspectorHook.h"
+#include "common/DomainSubscriptions.h"
+#include <atomic>
+#include <mutex>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "HookInstaller"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "HookInstaller"
+#define LOGI(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+
+static std::atomic<bool> g_deferredInstall{false};
+
+static std::mutex g_schedulerMutex;
+static JSThreadScheduler g_scheduler;  // Guarded by g_schedulerMutex / g_schedulerMutex로 보호
+// Coalesces bursts of enable commands into one JS thread task / 연속된 enable 명령을 JS 스레드 작업 하나로 합침
+static std::atomic<bool> g_syncPending{false};
+
+void setHookInstallMode(HookInstallMode mode) {
+  g_deferredInstall.store(mode == HookInstallMode::Deferred);
+}
+
+HookInstallMode getHookInstallMode() {
+  return g_deferredInstall.load() ? HookInstallMode::Deferred : HookInstallMode::Eager;
+}
+
+// Install or remove each hook group to match the client's subscriptions / 클라이언트 구독에 맞춰 각 훅 그룹을 설치하거나 제거
+// Installed hooks stay inert while the relay socket is down and are removed once the client detaches /
+// 설치된 훅은 릴레이 소켓이 끊긴 동안 아무 일도 하지 않으며, 클라이언트가 분리되면 제거됨
+static void syncHooks(facebook::jsi::Runtime& runtime) {
+  bool wantConsole = common::isConsoleDomainSubscribed();
+  if (wantConsole != isConsoleHookEnabled()) {
+    bool success = wantConsole ? enableConsoleHook(runtime) : disableConsoleHook(runtime);
+    LOGI("Deferred console hook %s: %s / 지연 console 훅 %s: %s", wantConsole ? "install" : "removal",
+         success ? "ok" : "failed", wantConsole ? "설치" : "제거", success ? "성공" : "실패");
+    (void)success;  // Unused when logging is compiled out / 로그가 비활성화되면 사용되지 않음
+  }
+  bool wantNetwork = common::isNetworkDomainSubscribed();
+  if (wantNetwork != isNetworkHookEnabled()) {
+    bool success = wantNetwork ? enableNetworkHook(runtime) : disableNetworkHook(runtime);
+    LOGI("Deferred network hook %s: %s / 지연 네트워크 훅 %s: %s", wantNetwork ? "install" : "removal",
+         success ? "ok" : "failed", wantNetwork ? "설치" : "제거", success ? "성공" : "실패");
+    (void)success;  // Unused when logging is compiled out / 로그가 비활성화되면 사용되지 않음
+  }
+}
+
+void installDeferredHooks(facebook::jsi::Runtime& runtime, JSThreadScheduler scheduler) {
+  {
+    std::lock_guard<std::mutex> lock(g_schedulerMutex);
+    g_scheduler = std::move(scheduler);
+  }
+  installHookMetricsGetter(runtime);
+  // A client may have attached before the runtime (e.g. after a JS reload) / 런타임보다 먼저 클라이언트가 연결되었을 수 있음 (예: JS 리로드 후)
+  syncHooks(runtime);
+}
+
+void scheduleDeferredHookSync() {
+  if (!g_deferredInstall.load()) {
+    return;
+  }
+  // Hook state is only read on the JS thread; changes after the pending flag is cleared post a new task /
+  // 훅 상태는 JS 스레드에서만 읽음, 대기 플래그가 해제된 뒤의 변경은 새 작업을 보냄
+  if (g_syncPending.exchange(true)) {
+    return;
+  }
+  JSThreadScheduler scheduler;
+  {
+    std::lock_guard<std::mutex> lock(g_schedulerMutex);
+    scheduler = g_scheduler;
+  }
+  if (!scheduler) {
+    // No runtime yet, installDeferredHooks syncs when it arrives / 런타임이 아직 없음, installDeferredHooks가 도착 시 맞춤
+    g_syncPending.store(false);
+    return;
+  }
+  try {
+    scheduler([](facebook::jsi::Runtime& runtime) {
+      g_syncPending.store(false);
+      try {
+        syncHooks(runtime);
+      } catch (const std::exception& e) {
+        LOGW("Deferred hook sync failed / 지연 훅 동기화 실패: %s", e.what());
+      } catch (...) {
+        LOGW("Deferred hook sync failed / 지연 훅 동기화 실패");
+      }
+    });
+  } catch (...) {
+    g_syncPending.store(false);
+    LOGW("Failed to schedule deferred hook sync / 지연 훅 동기화 예약 실패");
+  }
+}
+
+} // namespace chrome_remote_devtools
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include "StallWatchdog.h" // For JSThreadScheduler / JSThreadScheduler를 위해
+#include <jsi/jsi.h>
+
+namespace chrome_remote_devtools {
+
+enum class HookInstallMode {
+  // Console and network hooks are installed with the runtime (default) / console, 네트워크 훅을 런타임과 함께 설치 (기본값)
+  Eager,
+  // Hooks are installed when a client first enables their domain and removed when capture stops /
+  // 클라이언트가 도메인을 처음 활성화할 때 훅을 설치하고 캡처가 멈추면 제거
+  Deferred,
+};
+
+/**
+ * Choose when hooks are installed / 훅 설치 시점 선택
+ * Must be set before the runtime is hooked (e.g. in Application.onCreate or the app delegate) /
+ * 런타임에 훅을 걸기 전에 설정해야 함 (예: Application.onCreate 또는 앱 델리게이트)
+ * @param mode Install mode / 설치 모드
+ */
+void setHookInstallMode(HookInstallMode mode);
+
+HookInstallMode getHookInstallMode();
+
+/**
+ * Set up deferred installation for a new runtime / 새 런타임에 지연 설치 준비
+ * Installs nothing in the app's globals but the hook metrics getter. When Runtime, Console or Log is enabled the
+ * console hooks and object table are installed through the scheduler; Network installs the XHR and fetch hooks.
+ * Once the client detaches or the domains are disabled the hooks are removed again. Must be called on the JS
+ * thread; replaces the scheduler of a previous runtime /
+ * 앱 전역에는 훅 메트릭 getter 외에 아무것도 설치하지 않음. Runtime, Console, Log가 활성화되면 스케줄러를 통해
+ * console 훅과 객체 테이블을, Network가 활성화되면 XHR과 fetch 훅을 설치함. 클라이언트가 분리되거나 도메인이 비활성화되면
+ * 훅을 다시 제거함. JS 스레드에서 호출해야 하며 이전 런타임의 스케줄러를 대체함
+ * @param runtime JSI runtime instance / JSI 런타임 인스턴스
+ * @param scheduler Posts tasks to the JS thread / JS 스레드에 작업을 보냄
+ */
+void installDeferredHooks(facebook::jsi::Runtime& runtime, JSThreadScheduler scheduler);
+
+/**
+ * Bring installed hooks in line with the current subscriptions (deferred mode only) /
+ * 설치된 훅을 현재 구독 상태에 맞춤 (지연 모드 전용)
+ * Called after every attach, detach or subscription change; posts at most one pending task to the JS thread.
+ * Safe to call from any thread /
+ * 연결, 분리 또는 구독이 바뀔 때마다 호출되며 JS 스레드에 대기 작업을 최대 하나만 보냄. 어느 스레드에서든 호출 가능
+ */
+void scheduleDeferredHookSync();
+
+} // namespace chrome_remote_devtools
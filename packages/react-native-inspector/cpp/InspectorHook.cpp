@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "InspectorHook.h"
+#include "HookInstaller.h"
+#include "StallWatchdog.h"
+#include "profiler/ProfilerEventSender.h"
+#include "transport/CDPEventSender.h"
+#include "common/Clock.h"
+#include "common/HookMetrics.h"
+#include "common/OverheadGovernor.h"
+#include "common/DomainSubscriptions.h"
+#include "common/JsonWriter.h"
+#include "common/JSIHandleCache.h"
+#include "console/ObjectHandleTable.h"
+#include <folly/json.h>
+#include <cstdio>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "InspectorHook"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "InspectorHook"
+#define LOGI(...) ((void)0)
+#define LOGE(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+
+// CDP error codes / CDP 에러 코드
+static constexpr int kMethodNotFound = -32601;
+static constexpr int kServerError = -32000;
+
+static constexpr const char* kDomainPrefix = "ChromeRemoteDevTools.";
+static constexpr size_t kDomainPrefixLength = 21;
+
+static constexpr const char* kHookMetricsGetterName = "__ChromeRemoteDevToolsGetHookMetrics";
+
+// What the current capture level leaves out, in DevTools console wording / 현재 캡처 단계에서 빠지는 것, DevTools 콘솔 문구
+static std::string describeCaptureLevel(common::CaptureLevel level, const common::GovernorConfig& config) {
+  if (level == common::CaptureLevel::Full) {
+    return "full capture";
+  }
+  char text[96];
+  std::string description;
+  if (level >= common::CaptureLevel::ErrorsOnly) {
+    description = "only console.error kept";
+  } else {
+    std::snprintf(text, sizeof(text), "console.log/info/debug sampled 1 in %u", config.consoleSampleEvery);
+    description = text;
+  }
+  if (level >= common::CaptureLevel::NoPreviews) {
+    description += ", object previews off";
+  }
+  if (level >= common::CaptureLevel::NoLargeBodies) {
+    std::snprintf(text, sizeof(text), ", response bodies over %zu KB not kept", config.maxResponseBodyBytes / 1024);
+    description += text;
+  }
+  return description;
+}
+
+static void handleGetHookMetrics(facebook::jsi::Runtime& runtime, int64_t id) {
+  common::HookMetricsSnapshot snapshot = common::snapshotHookMetrics();
+
+  std::string& buffer = common::acquireJsonBuffer();
+  common::JsonWriter writer(buffer);
+  writer.beginObject();
+  writer.field("id", id);
+  writer.key("result");
+  writer.beginObject();
+  writer.key("hooks");
+  writer.beginArray();
+  for (size_t i = 0; i < snapshot.sites.size(); ++i) {
+    const common::HookSiteMetrics& site = snapshot.sites[i];
+    writer.beginObject();
+    writer.field("name", common::hookSiteName(static_cast<common::HookSite>(i)));
+    writer.field("calls", site.calls);
+    writer.field("totalNanos", site.totalNanos);
+    writer.field("p50Nanos", site.p50Nanos);
+    writer.field("p99Nanos", site.p99Nanos);
+    writer.field("maxNanos", site.maxNanos);
+    writer.field("bytesSerialized", site.bytesSerialized);
+    writer.field("eventsSent", site.eventsSent);
+    writer.field("eventsDropped", site.eventsDropped);
+    writer.endObject();
+  }
+  writer.endArray();
+  writer.field("inHookNanos", snapshot.inHookNanos);
+  writer.key("queue");
+  writer.beginObject();
+  writer.field("depth", transport::getPendingCDPMessageCount());
+  writer.field("bytes", transport::getPendingCDPMessageBytes());
+  writer.field("dropped", transport::getDroppedCDPMessageCount());
+  writer.endObject();
+  common::GovernorConfig config = common::governorConfig();
+  writer.key("governor");
+  writer.beginObject();
+  writer.field("level", common::captureLevelName(common::captureLevel()));
+  writer.field("budgetPercent", config.budgetFraction * 100.0);
+  writer.field("inHookPercent", common::governedHookFraction() * 100.0);
+  writer.field("skippedConsoleMessages", common::skippedConsoleMessageCount());
+  writer.field("skippedResponseBodies", common::skippedResponseBodyCount());
+  writer.endObject();
+  writer.key("capture");
+  writer.beginObject();
+  writer.field("console", common::isConsoleCaptureActive());
+  writer.field("network", common::isNetworkCaptureActive());
+  writer.endObject();
+  writer.endObject();
+  writer.endObject();
+  profiler::sendCDPProfilerMessage(runtime, buffer);
+}
+
+// Params left out keep their current value / 생략된 파라미터는 현재 값을 유지
+static void handleSetOverheadBudget(facebook::jsi::Runtime& runtime, int64_t id, const folly::dynamic& command) {
+  common::GovernorConfig config = common::governorConfig();
+  const folly::dynamic* params = command.get_ptr("params");
+  if (params != nullptr && params->isObject()) {
+    const folly::dynamic* budget = params->get_ptr("budgetPercent");
+    if (budget != nullptr && budget->isNumber()) {
+      config.budgetFraction = budget->asDouble() / 100.0;
+    }
+    const folly::dynamic* sampleEvery = params->get_ptr("consoleSampleEvery");
+    if (sampleEvery != nullptr && sampleEvery->isNumber() && sampleEvery->asDouble() >= 1) {
+      config.consoleSampleEvery = static_cast<uint32_t>(sampleEvery->asDouble());
+    }
+    const folly::dynamic* maxBodyKB = params->get_ptr("maxResponseBodyKB");
+    if (maxBodyKB != nullptr && maxBodyKB->isNumber() && maxBodyKB->asDouble() >= 0) {
+      config.maxResponseBodyBytes = static_cast<size_t>(maxBodyKB->asDouble() * 1024);
+    }
+  }
+  common::setGovernorConfig(config);
+  profiler::sendEmptyResult(runtime, id);
+}
+
+void reportCaptureLevelChange(facebook::jsi::Runtime& runtime) {
+  if (!common::takeCaptureLevelChange()) {
+    return;
+  }
+  common::CaptureLevel level = common::captureLevel();
+  common::GovernorConfig config = common::governorConfig();
+  double inHookPercent = common::governedHookFraction() * 100.0;
+  double budgetPercent = config.budgetFraction * 100.0;
+  std::string description = describeCaptureLevel(level, config);
+
+  char text[256];
+  std::snprintf(text, sizeof(text), "Chrome Remote DevTools: inspector hooks used %.1f%% of the JS thread (budget %.1f%%), %s%s",
+                inHookPercent, budgetPercent, level == common::CaptureLevel::Full ? "restored " : "reduced to ",
+                description.c_str());
+  LOGW("%s", text);
+
+  // Own buffers, callers may be holding the shared JSON buffer / 자체 버퍼 사용, 호출자가 공유 JSON 버퍼를 쓰는 중일 수 있음
+  // Visible in the DevTools console / DevTools 콘솔에 표시됨
+  std::string notice;
+  common::JsonWriter writer(notice);
+  writer.beginObject();
+  writer.field("method", "Runtime.consoleAPICalled");
+  writer.key("params");
+  writer.beginObject();
+  writer.field("type", "warning");
+  writer.key("args");
+  writer.beginArray();
+  writer.beginObject();
+  writer.field("type", "string");
+  writer.field("value", text);
+  writer.endObject();
+  writer.endArray();
+  writer.field("executionContextId", 1);
+  writer.field("timestamp", common::wallTimeMillis());
+  writer.endObject();
+  writer.endObject();
+  profiler::sendCDPProfilerMessage(runtime, notice);
+
+  // Machine-readable form for tooling / 도구를 위한 기계 판독 가능한 형태
+  std::string event;
+  common::JsonWriter eventWriter(event);
+  eventWriter.beginObject();
+  eventWriter.field("method", "ChromeRemoteDevTools.captureLevelChanged");
+  eventWriter.key("params");
+  eventWriter.beginObject();
+  eventWriter.field("level", common::captureLevelName(level));
+  eventWriter.field("degraded", description);
+  eventWriter.field("inHookPercent", inHookPercent);
+  eventWriter.field("budgetPercent", budgetPercent);
+  eventWriter.endObject();
+  eventWriter.endObject();
+  profiler::sendCDPProfilerMessage(runtime, event);
+}
+
+void attachRuntime(facebook::jsi::Runtime& runtime) {
+  common::bindHandleCache(runtime);
+}
+
+void detachRuntime(facebook::jsi::Runtime& runtime) {
+  console::clearObjectTable(runtime);
+}
+
+void setDevToolsConnected(bool connected) {
+  LOGI("DevTools connection %s / DevTools 연결 %s", connected ? "opened" : "closed", connected ? "열림" : "닫힘");
+  common::setDevToolsConnected(connected);
+  scheduleDeferredHookSync();
+  syncStallWatchdog();
+}
+
+void setDevToolsAttached(bool attached, bool resumed) {
+  LOGI("DevTools client %s / DevTools 클라이언트 %s", attached ? "attached" : "detached", attached ? "연결됨" : "분리됨");
+  common::setDevToolsAttached(attached, resumed);
+  scheduleDeferredHookSync();
+  syncStallWatchdog();
+}
+
+bool trackDomainSubscription(const std::string& method) {
+  if (!common::trackSubscriptionCommand(method)) {
+    return false;
+  }
+  scheduleDeferredHookSync();
+  syncStallWatchdog();
+  return true;
+}
+
+bool handleInspectorCommand(facebook::jsi::Runtime& runtime, const std::string& message) {
+  folly::dynamic command;
+  try {
+    command = folly::parseJson(message);
+  } catch (const std::exception& e) {
+    LOGE("Failed to parse ChromeRemoteDevTools command / ChromeRemoteDevTools 명령 파싱 실패: %s", e.what());
+    return false;
+  }
+  const folly::dynamic* idValue = command.get_ptr("id");
+  const folly::dynamic* methodValue = command.get_ptr("method");
+  if (idValue == nullptr || !idValue->isInt() || methodValue == nullptr || !methodValue->isString()) {
+    return false;
+  }
+  int64_t id = idValue->getInt();
+  const std::string& method = methodValue->getString();
+  if (method.compare(0, kDomainPrefixLength, kDomainPrefix) != 0) {
+    return false;
+  }
+
+  try {
+    if (method == "ChromeRemoteDevTools.getHookMetrics") {
+      handleGetHookMetrics(runtime, id);
+    } else if (method == "ChromeRemoteDevTools.resetHookMetrics") {
+      common::resetHookMetrics();
+      profiler::sendEmptyResult(runtime, id);
+    } else if (method == "ChromeRemoteDevTools.setOverheadBudget") {
+      handleSetOverheadBudget(runtime, id, command);
+    } else {
+      profiler::sendErrorResponse(runtime, id, kMethodNotFound, "'" + method + "' wasn't found");
+    }
+  } catch (const std::exception& e) {
+    LOGE("Failed to handle %s / %s 처리 실패: %s", method.c_str(), method.c_str(), e.what());
+    profiler::sendErrorResponse(runtime, id, kServerError, e.what());
+  }
+  return true;
+}
+
+static facebook::jsi::Object hookMetricsObject(facebook::jsi::Runtime& rt) {
+  common::HookMetricsSnapshot snapshot = common::snapshotHookMetrics();
+  facebook::jsi::Object hooks(rt);
+  for (size_t i = 0; i < snapshot.sites.size(); ++i) {
+    const common::HookSiteMetrics& site = snapshot.sites[i];
+    facebook::jsi::Object entry(rt);
+    entry.setProperty(rt, "calls", static_cast<double>(site.calls));
+    entry.setProperty(rt, "totalNanos", static_cast<double>(site.totalNanos));
+    entry.setProperty(rt, "p50Nanos", static_cast<double>(site.p50Nanos));
+    entry.setProperty(rt, "p99Nanos", static_cast<double>(site.p99Nanos));
+    entry.setProperty(rt, "maxNanos", static_cast<double>(site.maxNanos));
+    entry.setProperty(rt, "bytesSerialized", static_cast<double>(site.bytesSerialized));
+    entry.setProperty(rt, "eventsSent", static_cast<double>(site.eventsSent));
+    entry.setProperty(rt, "eventsDropped", static_cast<double>(site.eventsDropped));
+    hooks.setProperty(rt, common::hookSiteName(static_cast<common::HookSite>(i)), entry);
+  }
+  facebook::jsi::Object queue(rt);
+  queue.setProperty(rt, "depth", static_cast<double>(transport::getPendingCDPMessageCount()));
+  queue.setProperty(rt, "bytes", static_cast<double>(transport::getPendingCDPMessageBytes()));
+  queue.setProperty(rt, "dropped", static_cast<double>(transport::getDroppedCDPMessageCount()));
+
+  facebook::jsi::Object governor(rt);
+  governor.setProperty(rt, "level", facebook::jsi::String::createFromAscii(rt, common::captureLevelName(common::captureLevel())));
+  governor.setProperty(rt, "budgetPercent", common::governorConfig().budgetFraction * 100.0);
+  governor.setProperty(rt, "inHookPercent", common::governedHookFraction() * 100.0);
+  governor.setProperty(rt, "skippedConsoleMessages", static_cast<double>(common::skippedConsoleMessageCount()));
+  governor.setProperty(rt, "skippedResponseBodies", static_cast<double>(common::skippedResponseBodyCount()));
+
+  facebook::jsi::Object capture(rt);
+  capture.setProperty(rt, "console", common::isConsoleCaptureActive());
+  capture.setProperty(rt, "network", common::isNetworkCaptureActive());
+
+  facebook::jsi::Object result(rt);
+  result.setProperty(rt, "hooks", hooks);
+  result.setProperty(rt, "inHookNanos", static_cast<double>(snapshot.inHookNanos));
+  result.setProperty(rt, "queue", queue);
+  result.setProperty(rt, "governor", governor);
+  result.setProperty(rt, "capture", capture);
+  return result;
+}
+
+bool installHookMetricsGetter(facebook::jsi::Runtime& runtime) {
+  try {
+    auto getter = facebook::jsi::Function::createFromHostFunction(
+      runtime,
+      facebook::jsi::PropNameID::forAscii(runtime, kHookMetricsGetterName),
+      0,
+      [](facebook::jsi::Runtime& rt,
+         const facebook::jsi::Value&,
+         const facebook::jsi::Value*,
+         size_t) -> facebook::jsi::Value {
+        return facebook::jsi::Value(rt, hookMetricsObject(rt));
+      });
+    runtime.global().setProperty(runtime, kHookMetricsGetterName, std::move(getter));
+    return true;
+  } catch (const std::exception& e) {
+    LOGE("Failed to install %s: %s", kHookMetricsGetterName, e.what());
+  } catch (...) {
+    LOGE("Failed to install %s (unknown exception) / %s 설치 실패 (알 수 없는 예외)", kHookMetricsGetterName,
+         kHookMetricsGetterName);
+  }
+  return false;
+}
+
+} // namespace chrome_remote_devtools
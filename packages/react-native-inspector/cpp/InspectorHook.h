@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <string>
+
+namespace chrome_remote_devtools {
+
+/**
+ * Handle the inspector's own ChromeRemoteDevTools domain natively / 인스펙터 자체 ChromeRemoteDevTools 도메인을 네이티브에서 처리
+ * Supports ChromeRemoteDevTools.getHookMetrics and resetHookMetrics, which report what every hook costs on the
+ * thread it runs on (calls, time, serialized bytes, sent and dropped events) plus the sender queue depth, and
+ * setOverheadBudget, which configures the overhead governor. Must be called on the JS thread /
+ * 모든 훅이 실행되는 스레드에서의 비용 (호출 수, 시간, 직렬화 바이트, 전송 및 버려진 이벤트)과 전송 큐 깊이를 보고하는
+ * ChromeRemoteDevTools.getHookMetrics, resetHookMetrics와 오버헤드 거버너를 설정하는 setOverheadBudget을 지원함.
+ * JS 스레드에서 호출해야 함
+ * @param runtime JSI runtime instance / JSI 런타임 인스턴스
+ * @param message Raw CDP command message (JSON) / 원본 CDP 명령 메시지 (JSON)
+ * @return true if the message was a ChromeRemoteDevTools command and has been answered /
+ *         ChromeRemoteDevTools 명령이었고 응답했으면 true
+ */
+bool handleInspectorCommand(facebook::jsi::Runtime& runtime, const std::string& message);
+
+/**
+ * Hand a runtime to the inspector / 런타임을 인스펙터에 전달
+ * Drops cached handles left by a reloaded runtime, even when the new runtime reuses its address. Must be called on
+ * the JS thread before hooks are installed or any other task runs on the runtime /
+ * 새 런타임이 이전 주소를 재사용하더라도 리로드된 런타임이 남긴 캐시 핸들을 버림. 훅을 설치하거나 런타임에서
+ * 다른 작업이 실행되기 전에 JS 스레드에서 호출해야 함
+ * @param runtime JSI runtime instance / JSI 런타임 인스턴스
+ */
+void attachRuntime(facebook::jsi::Runtime& runtime);
+
+/**
+ * Release per-runtime state before the runtime is torn down / 런타임이 해제되기 전에 런타임별 상태 해제
+ * Frees the objects retained for Runtime.getProperties while the runtime can still release them. If the runtime is
+ * destroyed first, attachRuntime abandons the stale state instead. Must be called on the JS thread /
+ * 런타임이 아직 해제할 수 있을 때 Runtime.getProperties를 위해 보유한 객체를 해제함. 런타임이 먼저 파괴되면
+ * 대신 attachRuntime이 오래된 상태를 버림. JS 스레드에서 호출해야 함
+ * @param runtime JSI runtime instance / JSI 런타임 인스턴스
+ */
+void detachRuntime(facebook::jsi::Runtime& runtime);
+
+/**
+ * Report the relay socket state / 릴레이 소켓 상태 보고
+ * Console, XHR and fetch hooks call straight through to the original while no client is attached or no client has
+ * enabled their domain; in deferred install mode the hooks are installed or removed to match. Safe to call from any
+ * thread /
+ * 연결된 클라이언트가 없거나 해당 도메인을 활성화한 클라이언트가 없으면 console, XHR, fetch 훅은 바로 원본을 호출함.
+ * 지연 설치 모드에서는 이에 맞춰 훅을 설치하거나 제거함. 어느 스레드에서든 호출 가능
+ * @param connected true when the connection opened, false when it closed or failed / 연결이 열리면 true, 닫히거나 실패하면 false
+ */
+void setDevToolsConnected(bool connected);
+
+/**
+ * Report a DevTools client attaching or detaching, as announced by the relay server /
+ * 릴레이 서버가 알린 DevTools 클라이언트 연결 또는 분리 보고
+ * Handles ChromeRemoteDevTools.devtoolsAttached / devtoolsDetached. A detach forgets enabled domains, so hooks go
+ * back to calling the original and deferred hooks are removed. Safe to call from any thread /
+ * ChromeRemoteDevTools.devtoolsAttached / devtoolsDetached 처리. 분리되면 활성화된 도메인을 잊으므로 훅은 다시
+ * 원본을 호출하고 지연 설치된 훅은 제거됨. 어느 스레드에서든 호출 가능
+ * @param resumed params.resumed of devtoolsAttached / devtoolsAttached의 params.resumed
+ */
+void setDevToolsAttached(bool attached, bool resumed);
+
+/**
+ * Track Runtime, Console, Log and Network enable/disable commands / Runtime, Console, Log, Network enable/disable 명령 추적
+ * Only records the subscription, the command is still handled as before. Safe to call from any thread /
+ * 구독만 기록하며 명령은 기존대로 처리됨. 어느 스레드에서든 호출 가능
+ * @param method CDP method name / CDP 메서드 이름
+ * @return true if the method was a tracked enable/disable command / 추적하는 enable/disable 명령이었으면 true
+ */
+bool trackDomainSubscription(const std::string& method);
+
+/**
+ * Tell DevTools when the overhead governor changed capture fidelity / 오버헤드 거버너가 캡처 충실도를 바꾸면 DevTools에 알림
+ * Sends a Runtime.consoleAPICalled warning describing what is degraded and a ChromeRemoteDevTools.captureLevelChanged
+ * event. Costs one relaxed load when nothing changed, so hooks call it on every entry /
+ * 무엇이 축소되었는지 설명하는 Runtime.consoleAPICalled 경고와 ChromeRemoteDevTools.captureLevelChanged 이벤트를 전송함.
+ * 변경이 없으면 relaxed 로드 한 번의 비용이므로 훅이 진입할 때마다 호출함
+ * @param runtime JSI runtime instance / JSI 런타임 인스턴스
+ */
+void reportCaptureLevelChange(facebook::jsi::Runtime& runtime);
+
+/**
+ * Install global.__ChromeRemoteDevToolsGetHookMetrics() / global.__ChromeRemoteDevToolsGetHookMetrics() 설치
+ * Returns the same report as ChromeRemoteDevTools.getHookMetrics as a plain object, so in-app benchmarks can
+ * read it without a DevTools connection /
+ * ChromeRemoteDevTools.getHookMetrics와 같은 보고서를 일반 객체로 반환하므로 앱 내 벤치마크가 DevTools 연결 없이 읽을 수 있음
+ * @param runtime JSI runtime instance / JSI 런타임 인스턴스
+ * @return true if installed / 설치되었으면 true
+ */
+bool installHookMetricsGetter(facebook::jsi::Runtime& runtime);
+
+} // namespace chrome_remote_devtools
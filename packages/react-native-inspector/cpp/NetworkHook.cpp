@@ -11,6 +11,7 @@
 #include "network/XHRHook.h"
 #include "network/FetchHook.h"
 #include "network/NetworkGlobals.h"
+#include "common/JSIHandleCache.h"
 #include <atomic>
 
 // Platform-specific log support / 플랫폼별 로그 지원
@@ -133,6 +134,21 @@ bool disableNetworkHook(facebook::jsi::Runtime& runtime) {
           }
         }
 
+        // Drop captured originals; runtime is alive so handles can be released here /
+        // 캡처된 원본 제거, 런타임이 살아 있으므로 여기서 핸들 해제 가능
+        // The fetch wrapper stays installed and falls back to __original_fetch /
+        // fetch 래퍼는 설치된 상태로 남으며 __original_fetch로 대체됨
+        if (common::JSIHandleCache* handleCache = common::getHandleCache(runtime)) {
+          handleCache->clearFunction(common::CachedFunction::XHROpen);
+          handleCache->clearFunction(common::CachedFunction::XHRSend);
+          handleCache->clearFunction(common::CachedFunction::XHRSetRequestHeader);
+          handleCache->clearFunction(common::CachedFunction::XHRReadyStateListener);
+          handleCache->clearFunction(common::CachedFunction::Fetch);
+          common::releaseHandleCache(runtime);
+        }
+        network::g_fetchCorrelation.clear();
+        network::g_xhrStates.clear();
+
         // Only update flag if restoration succeeded / 복원이 성공했을 때만 플래그 업데이트
         if (allRestored) {
           g_isNetworkHooked.store(false);
@@ -148,15 +164,45 @@ bool disableNetworkHook(facebook::jsi::Runtime& runtime) {
 }
 
 std::string getNetworkResponseBody(const std::string& requestId) {
-  std::lock_guard<std::mutex> lock(network::g_responseDataMutex);
-  auto it = network::g_responseData.find(requestId);
-  if (it != network::g_responseData.end()) {
-    // Move and erase to prevent memory leak / 메모리 누수 방지를 위해 이동 후 삭제
-    std::string body = std::move(it->second);
-    network::g_responseData.erase(it);
-    return body;
+  bool base64Encoded = false;
+  return getNetworkResponseBody(requestId, base64Encoded);
+}
+
+std::string getNetworkResponseBody(const std::string& requestId, bool& base64Encoded) {
+  // Taken bodies are removed from the store / 가져간 본문은 저장소에서 제거됨
+  return network::g_responseBodyStore.take(requestId, base64Encoded);
+}
+
+bool isNetworkResponseBodyBase64Encoded(const std::string& requestId) {
+  return network::g_responseBodyStore.isBinary(requestId);
+}
+
+std::string openNetworkResponseBodyStream(const std::string& requestId) {
+  size_t size = 0;
+  if (!network::g_responseBodyStore.size(requestId, size) || size < network::kResponseBodyStreamThresholdBytes) {
+    return "";
   }
-  return "";
+  return network::g_ioStreams.open(requestId);
+}
+
+std::string readIOStream(int64_t messageId, const std::string& handle, int64_t offset, size_t size) {
+  return network::buildIOReadResponse(network::g_ioStreams, messageId, handle, offset, size);
+}
+
+void closeIOStream(const std::string& handle) {
+  network::g_ioStreams.close(handle);
+}
+
+void setResponseBodySpillDirectory(const std::string& directory) {
+  network::g_responseBodyStore.setSpillDirectory(directory);
+}
+
+void setResponseBodyBudget(size_t maxMemoryBytes, size_t spillThresholdBytes, size_t maxSpillBytes) {
+  network::ResponseBodyBudget budget;
+  budget.maxMemoryBytes = maxMemoryBytes;
+  budget.spillThresholdBytes = spillThresholdBytes;
+  budget.maxSpillBytes = maxSpillBytes;
+  network::g_responseBodyStore.setBudget(budget);
 }
 
 bool isNetworkHookEnabled() {
@@ -10,6 +10,8 @@
 #pragma once
 
 #include <jsi/jsi.h>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace chrome_remote_devtools {
@@ -56,5 +58,64 @@ bool isNetworkHookEnabled(facebook::jsi::Runtime& runtime);
  */
 std::string getNetworkResponseBody(const std::string& requestId);
 
+/**
+ * Get network response body by request ID / 요청 ID로 네트워크 응답 본문 가져오기
+ * Binary bodies (arraybuffer responses) are base64-encoded at this point / 바이너리 본문(arraybuffer 응답)은 이 시점에 base64로 인코딩됨
+ * @param requestId Network request ID / 네트워크 요청 ID
+ * @param base64Encoded Set to true if the returned body is base64 / 반환된 본문이 base64이면 true로 설정
+ * @return Response body as string, or empty string if not found / 응답 본문 문자열, 없으면 빈 문자열
+ */
+std::string getNetworkResponseBody(const std::string& requestId, bool& base64Encoded);
+
+/**
+ * Check if stored response body is returned base64-encoded / 저장된 응답 본문이 base64로 인코딩되어 반환되는지 확인
+ * @param requestId Network request ID / 네트워크 요청 ID
+ * @return true for binary bodies / 바이너리 본문이면 true
+ */
+bool isNetworkResponseBodyBase64Encoded(const std::string& requestId);
+
+/**
+ * Open IO stream for a large response body / 큰 응답 본문에 대한 IO 스트림 열기
+ * Network.getResponseBody answers with the handle instead of the body, DevTools then pulls it with IO.read /
+ * Network.getResponseBody는 본문 대신 핸들로 응답하며, DevTools는 IO.read로 본문을 가져감
+ * @param requestId Network request ID / 네트워크 요청 ID
+ * @return Stream handle, or empty string if the body is small or not found (use getNetworkResponseBody) /
+ *         스트림 핸들, 본문이 작거나 없으면 빈 문자열 (getNetworkResponseBody 사용)
+ */
+std::string openNetworkResponseBodyStream(const std::string& requestId);
+
+/**
+ * Handle IO.read / IO.read 처리
+ * @param messageId CDP message ID / CDP 메시지 ID
+ * @param handle Stream handle / 스트림 핸들
+ * @param offset Read offset, negative to continue / 읽기 오프셋, 음수면 이어서 읽음
+ * @param size Maximum bytes, 0 for the default chunk size / 최대 바이트, 0이면 기본 청크 크기
+ * @return Complete CDP response message / 완전한 CDP 응답 메시지
+ */
+std::string readIOStream(int64_t messageId, const std::string& handle, int64_t offset, size_t size);
+
+/**
+ * Handle IO.close, releasing the stream and its body / IO.close 처리, 스트림과 본문 해제
+ * @param handle Stream handle / 스트림 핸들
+ */
+void closeIOStream(const std::string& handle);
+
+/**
+ * Set directory for large response bodies (app cache directory) / 큰 응답 본문을 위한 디렉토리 설정 (앱 캐시 디렉토리)
+ * Bodies above the spill threshold are written to mmap'd files there instead of the native heap /
+ * spill 임계값보다 큰 본문은 네이티브 힙 대신 이 디렉토리의 mmap 파일에 기록됨
+ * @param directory Directory path, empty disables spilling / 디렉토리 경로, 비어 있으면 spill 비활성화
+ */
+void setResponseBodySpillDirectory(const std::string& directory);
+
+/**
+ * Set response body store budget / 응답 본문 저장소 예산 설정
+ * Least recently stored bodies are evicted once a budget is exceeded / 예산을 초과하면 가장 오래전에 저장된 본문부터 제거됨
+ * @param maxMemoryBytes Bytes kept in native heap / 네이티브 힙에 보관되는 바이트
+ * @param spillThresholdBytes Bodies larger than this spill to disk / 이보다 큰 본문은 디스크로 spill
+ * @param maxSpillBytes Bytes kept on disk / 디스크에 보관되는 바이트
+ */
+void setResponseBodyBudget(size_t maxMemoryBytes, size_t spillThresholdBytes, size_t maxSpillBytes);
+
 } // namespace chrome_remote_devtools
 
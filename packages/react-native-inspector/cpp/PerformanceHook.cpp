@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+
+#include "PerformanceHook.h"
+#include "StallWatchdog.h"
+#include "performance/PerformanceSampler.h"
+#include "profiler/ProfilerEventSender.h"
+#include "console/ObjectHandleTable.h"
+#include "common/Clock.h"
+#include "common/JsonWriter.h"
+#include <folly/json.h>
+#include <unordered_map>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "PerformanceHook"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "PerformanceHook"
+#define LOGI(...) ((void)0)
+#define LOGE(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+
+// CDP error codes / CDP 에러 코드
+static constexpr int kMethodNotFound = -32601;
+static constexpr int kServerError = -32000;
+
+static void writeMetric(common::JsonWriter& writer, const char* name, double value) {
+  writer.beginObject();
+  writer.field("name", name);
+  writer.field("value", value);
+  writer.endObject();
+}
+
+// Write Hermes heap counter if present (JSC reports none) / Hermes 힙 카운터가 있으면 작성 (JSC는 보고하지 않음)
+static void writeHeapMetric(common::JsonWriter& writer,
+                            const std::unordered_map<std::string, int64_t>& heapInfo,
+                            const char* name,
+                            const char* key) {
+  auto it = heapInfo.find(key);
+  if (it != heapInfo.end()) {
+    writeMetric(writer, name, static_cast<double>(it->second));
+  }
+}
+
+static void handleGetMetrics(facebook::jsi::Runtime& runtime, int64_t id) {
+  // Plain counters, cheap enough for the JS thread; JSI cannot be used from the sampler /
+  // 단순 카운터라 JS 스레드에서도 저렴함, 샘플러에서는 JSI를 사용할 수 없음
+  std::unordered_map<std::string, int64_t> heapInfo = runtime.instrumentation().getHeapInfo(false);
+  performance::ProcessSample sample = performance::latestProcessSample();
+
+  std::string& buffer = common::acquireJsonBuffer();
+  common::JsonWriter writer(buffer);
+  writer.beginObject();
+  writer.field("id", id);
+  writer.key("result");
+  writer.beginObject();
+  writer.key("metrics");
+  writer.beginArray();
+  writeMetric(writer, "Timestamp", common::monotonicSeconds());
+  writeHeapMetric(writer, heapInfo, "JSHeapUsedSize", "hermes_allocatedBytes");
+  writeHeapMetric(writer, heapInfo, "JSHeapTotalSize", "hermes_heapSize");
+  writeHeapMetric(writer, heapInfo, "GCCount", "hermes_numCollections");
+  // Hermes reports GC time per generation in milliseconds / Hermes는 세대별 GC 시간을 밀리초로 보고함
+  auto fullGcTime = heapInfo.find("hermes_full_gcTime");
+  auto youngGcTime = heapInfo.find("hermes_yg_gcTime");
+  if (fullGcTime != heapInfo.end() || youngGcTime != heapInfo.end()) {
+    int64_t gcMillis = (fullGcTime != heapInfo.end() ? fullGcTime->second : 0) +
+                       (youngGcTime != heapInfo.end() ? youngGcTime->second : 0);
+    writeMetric(writer, "GCDuration", static_cast<double>(gcMillis) / 1000.0);
+  }
+  if (sample.valid) {
+    if (sample.jsThreadCpuSeconds >= 0) {
+      writeMetric(writer, "ThreadTime", sample.jsThreadCpuSeconds);
+    }
+    if (sample.processCpuSeconds >= 0) {
+      writeMetric(writer, "ProcessTime", sample.processCpuSeconds);
+    }
+    if (sample.residentBytes > 0) {
+      writeMetric(writer, "ResidentSetSize", static_cast<double>(sample.residentBytes));
+    }
+    writeMetric(writer, "ResponseBodyStoreSize", static_cast<double>(sample.responseBodyBytes));
+  }
+  writeMetric(writer, "RetainedObjects", static_cast<double>(console::retainedObjectCount(runtime)));
+  // JS thread responsiveness from the stall watchdog, durations in seconds like other CDP metrics /
+  // 멈춤 감시기의 JS 스레드 응답성, 다른 CDP 메트릭처럼 시간은 초 단위
+  common::LatencySummary latency = getJSThreadLatencySummary();
+  if (latency.count > 0) {
+    writeMetric(writer, "JSThreadLatencyP50", static_cast<double>(latency.p50) / 1e6);
+    writeMetric(writer, "JSThreadLatencyP99", static_cast<double>(latency.p99) / 1e6);
+    writeMetric(writer, "JSThreadLatencyMax", static_cast<double>(latency.max) / 1e6);
+  }
+  writeMetric(writer, "JSThreadStalls", static_cast<double>(getJSThreadStallCount()));
+  writer.endArray();
+  writer.endObject();
+  writer.endObject();
+  profiler::sendCDPProfilerMessage(runtime, buffer);
+}
+
+bool handlePerformanceCommand(facebook::jsi::Runtime& runtime, const std::string& message) {
+  folly::dynamic command;
+  try {
+    command = folly::parseJson(message);
+  } catch (const std::exception& e) {
+    LOGE("Failed to parse Performance command / Performance 명령 파싱 실패: %s", e.what());
+    return false;
+  }
+  const folly::dynamic* idValue = command.get_ptr("id");
+  const folly::dynamic* methodValue = command.get_ptr("method");
+  if (idValue == nullptr || !idValue->isInt() || methodValue == nullptr || !methodValue->isString()) {
+    return false;
+  }
+  int64_t id = idValue->getInt();
+  const std::string& method = methodValue->getString();
+  if (method.compare(0, 12, "Performance.") != 0) {
+    return false;
+  }
+
+  try {
+    if (method == "Performance.enable") {
+      // Called on the JS thread, so this is the thread whose CPU time is reported /
+      // JS 스레드에서 호출되므로 이 스레드의 CPU 시간이 보고됨
+      performance::startPerformanceSampler(performance::currentThreadHandle());
+      profiler::sendEmptyResult(runtime, id);
+    } else if (method == "Performance.disable") {
+      performance::stopPerformanceSampler();
+      profiler::sendEmptyResult(runtime, id);
+    } else if (method == "Performance.getMetrics") {
+      handleGetMetrics(runtime, id);
+    } else {
+      profiler::sendErrorResponse(runtime, id, kMethodNotFound, "'" + method + "' wasn't found");
+    }
+  } catch (const std::exception& e) {
+    LOGE("Failed to handle %s / %s 처리 실패: %s", method.c_str(), method.c_str(), e.what());
+    profiler::sendErrorResponse(runtime, id, kServerError, e.what());
+  }
+  return true;
+}
+
+} // namespace chrome_remote_devtools
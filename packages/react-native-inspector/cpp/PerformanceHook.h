@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <string>
+
+namespace chrome_remote_devtools {
+
+/**
+ * Handle Performance domain command natively / Performance 도메인 명령을 네이티브에서 처리
+ * Supports Performance.enable, disable and getMetrics. Must be called on the JS thread /
+ * Performance.enable, disable, getMetrics를 지원함. JS 스레드에서 호출해야 함
+ * Process statistics come from a background sampler started by enable, JS heap counters are read on the JS thread
+ * when getMetrics runs /
+ * 프로세스 통계는 enable이 시작한 백그라운드 샘플러에서 오며, JS 힙 카운터는 getMetrics 실행 시 JS 스레드에서 읽음
+ * @param runtime JSI runtime instance / JSI 런타임 인스턴스
+ * @param message Raw CDP command message (JSON) / 원본 CDP 명령 메시지 (JSON)
+ * @return true if the message was a Performance command and has been answered / Performance 명령이었고 응답했으면 true
+ */
+bool handlePerformanceCommand(facebook::jsi::Runtime& runtime, const std::string& message);
+
+} // namespace chrome_remote_devtools
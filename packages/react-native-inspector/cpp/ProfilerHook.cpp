@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "ProfilerHook.h"
+#include "profiler/CpuProfile.h"
+#include "profiler/HeapSnapshotStream.h"
+#include "profiler/HermesSampler.h"
+#include "profiler/ProfilerEventSender.h"
+#include "profiler/SamplingHeapProfile.h"
+#include "common/Clock.h"
+#include "common/JsonWriter.h"
+#include <folly/json.h>
+#include <algorithm>
+#include <sstream>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "ProfilerHook"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "ProfilerHook"
+#define LOGI(...) ((void)0)
+#define LOGE(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+
+// CDP error codes / CDP 에러 코드
+static constexpr int kMethodNotFound = -32601;
+static constexpr int kServerError = -32000;
+
+// Sampling frequency bounds, Hermes samples with a dedicated thread / 샘플링 빈도 범위, Hermes는 전용 스레드로 샘플링함
+static constexpr double kDefaultSamplingHz = 100.0;
+static constexpr double kMaxSamplingHz = 10000.0;
+
+// CPU profiling state, JS thread only / CPU 프로파일링 상태, JS 스레드 전용
+struct CpuProfilerState {
+  bool running = false;
+  double samplingHz = kDefaultSamplingHz;
+  int64_t startTime = 0;
+};
+static CpuProfilerState g_cpuProfiler;
+
+// Default HeapProfiler.startSampling interval, same as V8 / V8과 같은 기본 HeapProfiler.startSampling 간격
+static constexpr double kDefaultHeapSamplingIntervalBytes = 32768.0;
+
+// Heap sampling state, JS thread only / 힙 샘플링 상태, JS 스레드 전용
+struct HeapSamplingState {
+  bool running = false;
+  size_t intervalBytes = static_cast<size_t>(kDefaultHeapSamplingIntervalBytes);
+};
+static HeapSamplingState g_heapSampling;
+
+static void handleProfilerStart(facebook::jsi::Runtime& runtime, int64_t id) {
+  if (g_cpuProfiler.running) {
+    profiler::sendEmptyResult(runtime, id);
+    return;
+  }
+  if (!profiler::isHermesRuntime(runtime)) {
+    profiler::sendErrorResponse(runtime, id, kServerError, "CPU profiling requires Hermes");
+    return;
+  }
+  if (!profiler::startCpuSampling(g_cpuProfiler.samplingHz)) {
+    profiler::sendErrorResponse(runtime, id, kServerError, "Hermes sampling profiler is not available or busy");
+    return;
+  }
+  g_cpuProfiler.running = true;
+  g_cpuProfiler.startTime = common::monotonicMicros();
+  LOGI("CPU profiling started at %.0f Hz / CPU 프로파일링 시작 (%.0f Hz)", g_cpuProfiler.samplingHz, g_cpuProfiler.samplingHz);
+  profiler::sendEmptyResult(runtime, id);
+}
+
+static void handleProfilerStop(facebook::jsi::Runtime& runtime, int64_t id) {
+  if (!g_cpuProfiler.running) {
+    profiler::sendErrorResponse(runtime, id, kServerError, "Profiler is not started");
+    return;
+  }
+  g_cpuProfiler.running = false;
+  int64_t endTime = common::monotonicMicros();
+
+  std::ostringstream trace;
+  if (!profiler::stopCpuSampling(trace)) {
+    profiler::sendErrorResponse(runtime, id, kServerError, "Failed to collect sampled trace");
+    return;
+  }
+
+  // Converted straight into the response, the trace is released right after / 응답으로 바로 변환되며 트레이스는 직후 해제됨
+  std::string& buffer = common::acquireJsonBuffer();
+  common::JsonWriter writer(buffer);
+  writer.beginObject();
+  writer.field("id", id);
+  writer.key("result");
+  writer.beginObject();
+  writer.key("profile");
+  if (!profiler::writeCpuProfile(trace.str(), g_cpuProfiler.startTime, endTime, writer)) {
+    profiler::sendErrorResponse(runtime, id, kServerError, "Failed to convert sampled trace");
+    return;
+  }
+  writer.endObject();
+  writer.endObject();
+  LOGI("CPU profile sent (%zu bytes) / CPU 프로파일 전송 (%zu 바이트)", buffer.size(), buffer.size());
+  profiler::sendCDPProfilerMessage(runtime, buffer);
+}
+
+static void sendHeapSnapshotProgress(facebook::jsi::Runtime& runtime, int done, int total, bool finished) {
+  std::string& buffer = common::acquireJsonBuffer();
+  common::JsonWriter writer(buffer);
+  writer.beginObject();
+  writer.field("method", "HeapProfiler.reportHeapSnapshotProgress");
+  writer.key("params");
+  writer.beginObject();
+  writer.field("done", done);
+  writer.field("total", total);
+  writer.field("finished", finished);
+  writer.endObject();
+  writer.endObject();
+  profiler::sendCDPProfilerMessage(runtime, buffer);
+}
+
+static void handleTakeHeapSnapshot(facebook::jsi::Runtime& runtime, int64_t id, const folly::dynamic* params) {
+  const folly::dynamic* reportProgress = params != nullptr ? params->get_ptr("reportProgress") : nullptr;
+  if (reportProgress != nullptr && reportProgress->isBool() && reportProgress->getBool()) {
+    // DevTools starts a fresh loader on finished=true, so it must arrive before the first chunk (Hermes does the same) /
+    // DevTools는 finished=true에서 새 로더를 시작하므로 첫 청크보다 먼저 도착해야 함 (Hermes도 동일)
+    sendHeapSnapshotProgress(runtime, 0, 100, false);
+    sendHeapSnapshotProgress(runtime, 100, 100, true);
+  }
+
+  // Resolved up front, JSI must not be used during the snapshot walk / 스냅샷 순회 중에는 JSI를 사용할 수 없으므로 미리 확인
+  std::string serverHost;
+  int serverPort;
+  profiler::getServerInfo(runtime, serverHost, serverPort);
+
+  profiler::HeapSnapshotChunkBuffer chunks(serverHost, serverPort);
+  std::ostream stream(&chunks);
+  runtime.instrumentation().createSnapshotToStream(stream);
+  stream.flush();
+  if (!chunks.finish()) {
+    profiler::sendErrorResponse(runtime, id, kServerError, "Heap snapshot transfer stalled");
+    return;
+  }
+  if (chunks.bytesSent() == 0) {
+    profiler::sendErrorResponse(runtime, id, kServerError, "Heap snapshots are not supported by this runtime");
+    return;
+  }
+  LOGI("Heap snapshot streamed (%zu bytes) / 힙 스냅샷 스트리밍 완료 (%zu 바이트)", chunks.bytesSent(), chunks.bytesSent());
+  // Queued after the last chunk, so DevTools sees every chunk first / 마지막 청크 뒤에 큐에 들어가므로 DevTools는 모든 청크를 먼저 받음
+  profiler::sendEmptyResult(runtime, id);
+}
+
+static void handleHeapStartSampling(facebook::jsi::Runtime& runtime, int64_t id, const folly::dynamic* params) {
+  if (g_heapSampling.running) {
+    profiler::sendErrorResponse(runtime, id, kServerError, "Heap sampling is already started");
+    return;
+  }
+  double intervalBytes = kDefaultHeapSamplingIntervalBytes;
+  const folly::dynamic* interval = params != nullptr ? params->get_ptr("samplingInterval") : nullptr;
+  if (interval != nullptr && interval->isNumber() && interval->asDouble() >= 1) {
+    intervalBytes = interval->asDouble();
+  }
+  if (!profiler::startHeapSampling(runtime, static_cast<size_t>(intervalBytes))) {
+    profiler::sendErrorResponse(runtime, id, kServerError, "Hermes sampling heap profiler is not available");
+    return;
+  }
+  g_heapSampling.running = true;
+  g_heapSampling.intervalBytes = static_cast<size_t>(intervalBytes);
+  LOGI("Heap sampling started every %zu bytes / 힙 샘플링 시작 (%zu 바이트마다)", g_heapSampling.intervalBytes,
+       g_heapSampling.intervalBytes);
+  profiler::sendEmptyResult(runtime, id);
+}
+
+// stopSampling, or getSamplingProfile when keepSampling is set / stopSampling, keepSampling이면 getSamplingProfile
+// Hermes can only report a profile by stopping, so getSamplingProfile restarts sampling right away and later
+// profiles start from that point /
+// Hermes는 중지해야만 프로파일을 보고하므로 getSamplingProfile은 즉시 샘플링을 재시작하고 이후 프로파일은 그 시점부터 시작됨
+static void handleHeapSamplingProfile(facebook::jsi::Runtime& runtime, int64_t id, bool keepSampling) {
+  if (!g_heapSampling.running) {
+    profiler::sendErrorResponse(runtime, id, kServerError, "Heap sampling is not started");
+    return;
+  }
+  std::ostringstream trace;
+  bool stopped = profiler::stopHeapSampling(runtime, trace);
+  g_heapSampling.running = keepSampling && profiler::startHeapSampling(runtime, g_heapSampling.intervalBytes);
+  if (!stopped) {
+    profiler::sendErrorResponse(runtime, id, kServerError, "Failed to collect heap sampling profile");
+    return;
+  }
+
+  std::string& buffer = common::acquireJsonBuffer();
+  common::JsonWriter writer(buffer);
+  writer.beginObject();
+  writer.field("id", id);
+  writer.key("result");
+  writer.beginObject();
+  writer.key("profile");
+  if (!profiler::writeSamplingHeapProfile(trace.str(), writer)) {
+    profiler::sendErrorResponse(runtime, id, kServerError, "Failed to convert heap sampling profile");
+    return;
+  }
+  writer.endObject();
+  writer.endObject();
+  LOGI("Heap sampling profile sent (%zu bytes) / 힙 샘플링 프로파일 전송 (%zu 바이트)", buffer.size(), buffer.size());
+  profiler::sendCDPProfilerMessage(runtime, buffer);
+}
+
+static void handleHeapProfilerCommand(facebook::jsi::Runtime& runtime,
+                                      int64_t id,
+                                      const std::string& method,
+                                      const folly::dynamic* params) {
+  if (method == "HeapProfiler.takeHeapSnapshot") {
+    handleTakeHeapSnapshot(runtime, id, params);
+  } else if (method == "HeapProfiler.collectGarbage") {
+    runtime.instrumentation().collectGarbage("inspector");
+    profiler::sendEmptyResult(runtime, id);
+  } else if (method == "HeapProfiler.startSampling") {
+    handleHeapStartSampling(runtime, id, params);
+  } else if (method == "HeapProfiler.stopSampling") {
+    handleHeapSamplingProfile(runtime, id, false);
+  } else if (method == "HeapProfiler.getSamplingProfile") {
+    handleHeapSamplingProfile(runtime, id, true);
+  } else if (method == "HeapProfiler.enable") {
+    profiler::sendEmptyResult(runtime, id);
+  } else if (method == "HeapProfiler.disable") {
+    if (g_heapSampling.running) {
+      // Drop the unfinished profile / 끝나지 않은 프로파일 버림
+      std::ostringstream discarded;
+      profiler::stopHeapSampling(runtime, discarded);
+      g_heapSampling.running = false;
+    }
+    profiler::sendEmptyResult(runtime, id);
+  } else {
+    profiler::sendErrorResponse(runtime, id, kMethodNotFound, "'" + method + "' wasn't found");
+  }
+}
+
+bool isProfilerAvailable(facebook::jsi::Runtime& runtime) {
+  return profiler::isHermesRuntime(runtime);
+}
+
+bool handleProfilerCommand(facebook::jsi::Runtime& runtime, const std::string& message) {
+  folly::dynamic command;
+  try {
+    command = folly::parseJson(message);
+  } catch (const std::exception& e) {
+    LOGE("Failed to parse Profiler command / Profiler 명령 파싱 실패: %s", e.what());
+    return false;
+  }
+  const folly::dynamic* idValue = command.get_ptr("id");
+  const folly::dynamic* methodValue = command.get_ptr("method");
+  if (idValue == nullptr || !idValue->isInt() || methodValue == nullptr || !methodValue->isString()) {
+    return false;
+  }
+  int64_t id = idValue->getInt();
+  const std::string& method = methodValue->getString();
+  bool isHeapProfiler = method.compare(0, 13, "HeapProfiler.") == 0;
+  if (!isHeapProfiler && method.compare(0, 9, "Profiler.") != 0) {
+    return false;
+  }
+
+  try {
+    if (isHeapProfiler) {
+      handleHeapProfilerCommand(runtime, id, method, command.get_ptr("params"));
+    } else if (method == "Profiler.start") {
+      handleProfilerStart(runtime, id);
+    } else if (method == "Profiler.stop") {
+      handleProfilerStop(runtime, id);
+    } else if (method == "Profiler.setSamplingInterval") {
+      // interval is in microseconds / interval은 마이크로초 단위
+      const folly::dynamic* params = command.get_ptr("params");
+      const folly::dynamic* interval = params != nullptr ? params->get_ptr("interval") : nullptr;
+      if (interval != nullptr && interval->isNumber() && interval->asDouble() > 0) {
+        g_cpuProfiler.samplingHz = std::min(kMaxSamplingHz, 1e6 / interval->asDouble());
+      }
+      profiler::sendEmptyResult(runtime, id);
+    } else if (method == "Profiler.enable") {
+      profiler::sendEmptyResult(runtime, id);
+    } else if (method == "Profiler.disable") {
+      if (g_cpuProfiler.running) {
+        // Drop the unfinished profile / 끝나지 않은 프로파일 버림
+        std::ostringstream discarded;
+        profiler::stopCpuSampling(discarded);
+        g_cpuProfiler.running = false;
+      }
+      profiler::sendEmptyResult(runtime, id);
+    } else {
+      profiler::sendErrorResponse(runtime, id, kMethodNotFound, "'" + method + "' wasn't found");
+    }
+  } catch (const std::exception& e) {
+    LOGE("Failed to handle %s / %s 처리 실패: %s", method.c_str(), method.c_str(), e.what());
+    profiler::sendErrorResponse(runtime, id, kServerError, e.what());
+  }
+  return true;
+}
+
+} // namespace chrome_remote_devtools
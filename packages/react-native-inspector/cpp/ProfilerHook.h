@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <string>
+
+namespace chrome_remote_devtools {
+
+/**
+ * Check if CPU profiling is available (runtime is Hermes) / CPU 프로파일링을 사용할 수 있는지 확인 (런타임이 Hermes인 경우)
+ * @param runtime JSI runtime instance / JSI 런타임 인스턴스
+ * @return true if Profiler.start can succeed / Profiler.start가 성공할 수 있으면 true
+ */
+bool isProfilerAvailable(facebook::jsi::Runtime& runtime);
+
+/**
+ * Handle Profiler or HeapProfiler domain command natively / Profiler 또는 HeapProfiler 도메인 명령을 네이티브에서 처리
+ * Supports Profiler.enable, disable, setSamplingInterval, start and stop, and HeapProfiler.enable, disable,
+ * collectGarbage, takeHeapSnapshot, startSampling, stopSampling and getSamplingProfile. Must be called on the JS thread /
+ * Profiler.enable, disable, setSamplingInterval, start, stop과 HeapProfiler.enable, disable, collectGarbage,
+ * takeHeapSnapshot, startSampling, stopSampling, getSamplingProfile을 지원함. JS 스레드에서 호출해야 함
+ * The response is sent through the CDP event sender like console and network events /
+ * 응답은 console, network 이벤트처럼 CDP 이벤트 전송기를 통해 전송됨
+ * @param runtime JSI runtime instance / JSI 런타임 인스턴스
+ * @param message Raw CDP command message (JSON) / 원본 CDP 명령 메시지 (JSON)
+ * @return true if the message was a Profiler or HeapProfiler command and has been answered /
+ *         Profiler 또는 HeapProfiler 명령이었고 응답했으면 true
+ */
+bool handleProfilerCommand(facebook::jsi::Runtime& runtime, const std::string& message);
+
+} // namespace chrome_remote_devtools
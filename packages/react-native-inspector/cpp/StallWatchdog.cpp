@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+
+#include "StallWatchdog.h"
+#include "profiler/CpuProfile.h"
+#include "profiler/HermesSampler.h"
+#include "profiler/ProfilerEventSender.h"
+#include "transport/CDPEventSender.h"
+#include "common/Clock.h"
+#include "common/DomainSubscriptions.h"
+#include "common/JsonWriter.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "StallWatchdog"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "StallWatchdog"
+#define LOGI(...) ((void)0)
+#define LOGE(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+
+// Delay between a finished probe and the next one / 끝난 프로브와 다음 프로브 사이의 지연
+static constexpr int64_t kProbeIntervalMicros = 100 * 1000;
+
+// Probe latency reported as a stall / 멈춤으로 보고되는 프로브 지연 시간
+static constexpr int64_t kStallThresholdMicros = 500 * 1000;
+
+// Sampling ends after this long even if the stall does not, samples are kept / 멈춤이 계속되어도 이 시간 후 샘플링 종료, 샘플은 유지
+static constexpr int64_t kMaxStallSamplingMicros = 10 * 1000 * 1000;
+
+// Dense enough to catch the stalling frame within a few milliseconds / 몇 밀리초 안에 멈춘 프레임을 잡을 만큼 촘촘함
+static constexpr double kStallSamplingHz = 1000.0;
+
+namespace {
+
+// Finished stall waiting to be reported by the watchdog thread / 감시 스레드가 보고할 끝난 멈춤
+struct StallReport {
+  int64_t durationMicros = 0;
+  std::string trace;  // Empty if no samples were taken / 샘플링하지 않았으면 비어 있음
+  std::string serverHost;
+  int serverPort = 0;
+};
+
+struct WatchdogState {
+  std::mutex lifecycleMutex;  // Serializes thread start and stop, taken before mutex / 스레드 시작과 중지 직렬화, mutex보다 먼저 잠금
+  std::mutex mutex;
+  std::condition_variable wakeCondition;
+  std::thread thread;
+  bool running = false;
+  uint64_t generation = 0;  // Bumped on restart so probes of an old runtime are ignored / 재시작 시 증가하여 이전 런타임의 프로브는 무시됨
+  JSThreadScheduler scheduler;
+
+  // Probe in flight / 진행 중인 프로브
+  bool probeOutstanding = false;
+  uint64_t probeGeneration = 0;
+  int64_t probePostedAt = 0;
+  int64_t nextProbeAt = 0;
+  bool sampling = false;
+  bool samplingSuspended = false;
+
+  std::vector<StallReport> reports;
+
+  common::LatencyHistogram histogram;
+  std::atomic<uint64_t> stallCount{0};
+};
+
+// Intentionally leaked so static destruction order never joins a live thread /
+// 정적 소멸 순서가 살아 있는 스레드를 join하지 않도록 의도적으로 해제하지 않음
+WatchdogState& getWatchdogState() {
+  static WatchdogState* state = new WatchdogState();
+  return *state;
+}
+
+void sendStallReport(const StallReport& report) {
+  std::vector<profiler::CallFrame> frames;
+  size_t sampleCount = 0;
+  if (!report.trace.empty()) {
+    profiler::hottestSampledStack(report.trace, frames, sampleCount);
+  }
+
+  char text[160];
+  std::snprintf(text, sizeof(text), "JS thread stalled for %.0f ms%s",
+                static_cast<double>(report.durationMicros) / 1000.0,
+                frames.empty() ? "" : ", hottest sampled stack below");
+
+  std::string message;
+  common::JsonWriter writer(message);
+  writer.beginObject();
+  writer.field("method", "Runtime.consoleAPICalled");
+  writer.key("params");
+  writer.beginObject();
+  writer.field("type", "warning");
+  writer.key("args");
+  writer.beginArray();
+  writer.beginObject();
+  writer.field("type", "string");
+  writer.field("value", text);
+  writer.endObject();
+  writer.endArray();
+  writer.field("executionContextId", 1);
+  writer.field("timestamp", common::wallTimeMillis());
+  writer.key("stackTrace");
+  writer.beginObject();
+  writer.key("callFrames");
+  writer.beginArray();
+  for (const profiler::CallFrame& frame : frames) {
+    writer.beginObject();
+    writer.field("functionName", frame.functionName);
+    writer.field("scriptId", frame.scriptId);
+    writer.field("url", frame.url);
+    writer.field("lineNumber", frame.lineNumber);
+    writer.field("columnNumber", frame.columnNumber);
+    writer.endObject();
+  }
+  writer.endArray();
+  writer.endObject();
+  writer.endObject();
+  writer.endObject();
+
+  LOGW("%s (%zu samples) / JS 스레드 멈춤 %.0f ms", text, sampleCount, static_cast<double>(report.durationMicros) / 1000.0);
+  transport::enqueueCDPMessage(report.serverHost, report.serverPort, std::move(message));
+}
+
+// Runs on the JS thread / JS 스레드에서 실행됨
+void onProbe(WatchdogState& state, uint64_t generation, facebook::jsi::Runtime& runtime) {
+  int64_t now = common::monotonicMicros();
+  std::unique_lock<std::mutex> lock(state.mutex);
+  if (!state.probeOutstanding || state.probeGeneration != generation) {
+    return;
+  }
+  int64_t latency = now - state.probePostedAt;
+  bool sampled = state.sampling;
+  state.probeOutstanding = false;
+  state.sampling = false;
+  state.samplingSuspended = false;
+  state.nextProbeAt = now + kProbeIntervalMicros;
+  lock.unlock();
+
+  state.histogram.record(static_cast<uint64_t>(latency));
+
+  StallReport report;
+  if (sampled) {
+    // The dump must happen on the JS thread / 덤프는 JS 스레드에서 해야 함
+    std::ostringstream trace;
+    if (profiler::stopCpuSampling(trace)) {
+      report.trace = trace.str();
+    }
+  }
+  if (latency < kStallThresholdMicros) {
+    return;
+  }
+  report.durationMicros = latency;
+  profiler::getServerInfo(runtime, report.serverHost, report.serverPort);
+  state.stallCount.fetch_add(1, std::memory_order_relaxed);
+
+  // Parsing and serialization happen on the watchdog thread / 파싱과 직렬화는 감시 스레드에서 수행
+  lock.lock();
+  state.reports.push_back(std::move(report));
+  lock.unlock();
+  state.wakeCondition.notify_all();
+}
+
+void watchdogLoop(WatchdogState& state, uint64_t generation) {
+  std::unique_lock<std::mutex> lock(state.mutex);
+  while (state.running && state.generation == generation) {
+    int64_t now = common::monotonicMicros();
+
+    if (!state.probeOutstanding && now >= state.nextProbeAt) {
+      state.probeOutstanding = true;
+      state.probeGeneration = generation;
+      state.probePostedAt = now;
+      JSThreadScheduler scheduler = state.scheduler;
+      lock.unlock();
+      try {
+        scheduler([&state, generation](facebook::jsi::Runtime& runtime) { onProbe(state, generation, runtime); });
+      } catch (const std::exception& e) {
+        LOGE("Failed to post JS thread probe: %s", e.what());
+      }
+      lock.lock();
+      continue;
+    }
+
+    if (state.probeOutstanding) {
+      int64_t late = now - state.probePostedAt;
+      if (!state.sampling && late >= kStallThresholdMicros && profiler::startCpuSampling(kStallSamplingHz)) {
+        // Stall in progress, capture what the JS thread is doing / 멈춤 진행 중, JS 스레드의 작업 캡처
+        state.sampling = true;
+      } else if (state.sampling && !state.samplingSuspended && late >= kStallThresholdMicros + kMaxStallSamplingMicros) {
+        profiler::suspendCpuSampling();
+        state.samplingSuspended = true;
+      }
+    }
+
+    std::vector<StallReport> reports;
+    reports.swap(state.reports);
+    if (!reports.empty()) {
+      lock.unlock();
+      for (const StallReport& report : reports) {
+        sendStallReport(report);
+      }
+      lock.lock();
+      continue;
+    }
+
+    state.wakeCondition.wait_for(lock, std::chrono::microseconds(kProbeIntervalMicros));
+  }
+}
+
+// Caller holds lifecycleMutex and mutex / 호출자가 lifecycleMutex와 mutex를 보유
+void startThreadLocked(WatchdogState& state) {
+  state.probeOutstanding = false;
+  state.sampling = false;
+  state.samplingSuspended = false;
+  state.nextProbeAt = 0;
+  try {
+    state.running = true;
+    uint64_t generation = state.generation;
+    state.thread = std::thread([&state, generation]() { watchdogLoop(state, generation); });
+    LOGI("JS thread stall watchdog started / JS 스레드 멈춤 감시 시작됨");
+  } catch (const std::exception& e) {
+    state.running = false;
+    LOGE("Failed to start stall watchdog thread: %s", e.what());
+  }
+}
+
+// Caller holds lifecycleMutex / 호출자가 lifecycleMutex를 보유
+void stopThread(WatchdogState& state) {
+  std::thread thread;
+  bool sampling = false;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!state.running) {
+      return;
+    }
+    state.running = false;
+    state.generation++;
+    sampling = state.sampling;
+    state.sampling = false;
+    state.probeOutstanding = false;
+    state.reports.clear();
+    thread = std::move(state.thread);
+  }
+  state.wakeCondition.notify_all();
+  if (thread.joinable()) {
+    thread.join();
+  }
+  if (sampling) {
+    // The probe that would have dumped the samples is ignored now / 샘플을 덤프했을 프로브는 이제 무시됨
+    profiler::cancelCpuSampling();
+  }
+  LOGI("JS thread stall watchdog stopped / JS 스레드 멈춤 감시 중지됨");
+}
+
+} // namespace
+
+void startStallWatchdog(JSThreadScheduler scheduler) {
+  if (!scheduler) {
+    return;
+  }
+  WatchdogState& state = getWatchdogState();
+  std::lock_guard<std::mutex> lifecycleLock(state.lifecycleMutex);
+  stopThread(state);
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.scheduler = std::move(scheduler);
+  // Nobody sees stall reports until a client enables a console domain / 클라이언트가 console 도메인을 활성화하기 전에는 아무도 멈춤 보고를 보지 않음
+  if (common::isConsoleCaptureActive()) {
+    startThreadLocked(state);
+  }
+}
+
+void stopStallWatchdog() {
+  WatchdogState& state = getWatchdogState();
+  std::lock_guard<std::mutex> lifecycleLock(state.lifecycleMutex);
+  stopThread(state);
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.scheduler = nullptr;
+}
+
+void syncStallWatchdog() {
+  WatchdogState& state = getWatchdogState();
+  std::lock_guard<std::mutex> lifecycleLock(state.lifecycleMutex);
+  bool active = common::isConsoleCaptureActive();
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.running == active) {
+      return;
+    }
+    if (active) {
+      if (state.scheduler) {
+        startThreadLocked(state);
+      }
+      return;
+    }
+  }
+  stopThread(state);
+}
+
+common::LatencySummary getJSThreadLatencySummary() {
+  return getWatchdogState().histogram.summary();
+}
+
+uint64_t getJSThreadStallCount() {
+  return getWatchdogState().stallCount.load(std::memory_order_relaxed);
+}
+
+} // namespace chrome_remote_devtools
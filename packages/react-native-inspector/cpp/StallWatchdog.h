@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+
+#pragma once
+
+#include "common/LatencyHistogram.h"
+#include <jsi/jsi.h>
+#include <functional>
+
+namespace chrome_remote_devtools {
+
+// Runs a task on the JS thread (platform RuntimeExecutor) / JS 스레드에서 작업 실행 (플랫폼 RuntimeExecutor)
+using JSThreadScheduler = std::function<void(std::function<void(facebook::jsi::Runtime&)>)>;
+
+/**
+ * Watch the JS thread for stalls (idempotent, replaces the scheduler of a previous runtime) /
+ * JS 스레드 멈춤 감시 (멱등, 이전 런타임의 스케줄러를 대체)
+ * The watchdog thread only runs while a DevTools client has Runtime, Console or Log enabled; it is started and
+ * stopped by syncStallWatchdog. While it runs it posts a probe through the scheduler and records how long the JS
+ * thread takes to run it.
+ * Once a probe is late by the stall threshold the Hermes sampling profiler captures what the JS thread is doing,
+ * and a console warning with the hottest sampled stack is sent when the stall ends /
+ * 감시 스레드는 DevTools 클라이언트가 Runtime, Console, Log를 활성화한 동안에만 실행되며 syncStallWatchdog이
+ * 시작하고 중지함. 실행 중에는 스케줄러로 프로브를 보내고 JS 스레드가 실행하기까지 걸린 시간을 기록함.
+ * 프로브가 멈춤 기준만큼 늦어지면 Hermes 샘플링 프로파일러가 JS 스레드의 작업을 캡처하고,
+ * 멈춤이 끝나면 가장 많이 샘플링된 스택과 함께 console 경고를 전송함
+ * @param scheduler Posts tasks to the JS thread / JS 스레드에 작업을 보냄
+ */
+void startStallWatchdog(JSThreadScheduler scheduler);
+
+/**
+ * Stop the watchdog thread and forget the scheduler / 감시 스레드를 중지하고 스케줄러를 잊음
+ */
+void stopStallWatchdog();
+
+/**
+ * Start or stop the watchdog thread to match the current subscriptions / 현재 구독 상태에 맞춰 감시 스레드 시작 또는 중지
+ * Called after every connection or subscription change. Safe to call from any thread but the JS thread /
+ * 연결 또는 구독이 바뀔 때마다 호출됨. JS 스레드를 제외한 어느 스레드에서든 호출 가능
+ */
+void syncStallWatchdog();
+
+/**
+ * Latency of JS thread probes since start / 시작 이후 JS 스레드 프로브 지연 시간
+ * @return Summary in microseconds / 마이크로초 단위 요약
+ */
+common::LatencySummary getJSThreadLatencySummary();
+
+/**
+ * Number of stalls reported since start / 시작 이후 보고된 멈춤 수
+ */
+uint64_t getJSThreadStallCount();
+
+} // namespace chrome_remote_devtools
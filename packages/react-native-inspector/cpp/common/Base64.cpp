@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "Base64.h"
+#include <cstdint>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define CRD_BASE64_NEON 1
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define CRD_BASE64_SSSE3 1
+#endif
+
+namespace chrome_remote_devtools {
+namespace common {
+
+static const char kAlphabet[65] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+#if defined(CRD_BASE64_NEON)
+// 48 input bytes -> 64 output chars per iteration / 반복당 입력 48바이트 -> 출력 64문자
+static size_t encodeBlocks(const uint8_t* src, size_t size, char* dst) {
+  const uint8x16x4_t table = {{
+    vld1q_u8(reinterpret_cast<const uint8_t*>(kAlphabet)),
+    vld1q_u8(reinterpret_cast<const uint8_t*>(kAlphabet) + 16),
+    vld1q_u8(reinterpret_cast<const uint8_t*>(kAlphabet) + 32),
+    vld1q_u8(reinterpret_cast<const uint8_t*>(kAlphabet) + 48),
+  }};
+  const uint8x16_t mask = vdupq_n_u8(0x3F);
+  size_t consumed = 0;
+  while (size - consumed >= 48) {
+    uint8x16x3_t in = vld3q_u8(src + consumed);
+    uint8x16x4_t indices;
+    indices.val[0] = vshrq_n_u8(in.val[0], 2);
+    indices.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+    indices.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+    indices.val[3] = vandq_u8(in.val[2], mask);
+    uint8x16x4_t out;
+    out.val[0] = vqtbl4q_u8(table, indices.val[0]);
+    out.val[1] = vqtbl4q_u8(table, indices.val[1]);
+    out.val[2] = vqtbl4q_u8(table, indices.val[2]);
+    out.val[3] = vqtbl4q_u8(table, indices.val[3]);
+    vst4q_u8(reinterpret_cast<uint8_t*>(dst), out);
+    consumed += 48;
+    dst += 64;
+  }
+  return consumed;
+}
+#elif defined(CRD_BASE64_SSSE3)
+// 12 input bytes -> 16 output chars per iteration, loads 16 bytes so 4 must remain readable /
+// 반복당 입력 12바이트 -> 출력 16문자, 16바이트를 읽으므로 4바이트가 더 읽을 수 있어야 함
+static size_t encodeBlocks(const uint8_t* src, size_t size, char* dst) {
+  const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+  const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  size_t consumed = 0;
+  while (size - consumed >= 16) {
+    __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + consumed));
+    in = _mm_shuffle_epi8(in, shuffle);
+    // Split 3 bytes into four 6-bit indices per 32-bit lane / 32비트 레인마다 3바이트를 6비트 인덱스 4개로 분리
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+    // Map index ranges to ASCII offsets / 인덱스 범위를 ASCII 오프셋으로 변환
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i lower = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    range = _mm_or_si128(range, _mm_and_si128(lower, _mm_set1_epi8(13)));
+    const __m128i out = _mm_add_epi8(_mm_shuffle_epi8(offsets, range), indices);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), out);
+    consumed += 12;
+    dst += 16;
+  }
+  return consumed;
+}
+#else
+static size_t encodeBlocks(const uint8_t*, size_t, char*) {
+  return 0;
+}
+#endif
+
+std::string base64Encode(const void* data, size_t size) {
+  std::string out;
+  out.resize(base64EncodedLength(size));
+  const uint8_t* src = static_cast<const uint8_t*>(data);
+  char* dst = &out[0];
+
+  size_t i = encodeBlocks(src, size, dst);
+  dst += i / 3 * 4;
+
+  // Scalar tail / 스칼라 나머지
+  for (; i + 3 <= size; i += 3) {
+    uint32_t n = (static_cast<uint32_t>(src[i]) << 16) | (static_cast<uint32_t>(src[i + 1]) << 8) | src[i + 2];
+    *dst++ = kAlphabet[(n >> 18) & 0x3F];
+    *dst++ = kAlphabet[(n >> 12) & 0x3F];
+    *dst++ = kAlphabet[(n >> 6) & 0x3F];
+    *dst++ = kAlphabet[n & 0x3F];
+  }
+  size_t remaining = size - i;
+  if (remaining > 0) {
+    uint32_t n = static_cast<uint32_t>(src[i]) << 16;
+    if (remaining == 2) {
+      n |= static_cast<uint32_t>(src[i + 1]) << 8;
+    }
+    *dst++ = kAlphabet[(n >> 18) & 0x3F];
+    *dst++ = kAlphabet[(n >> 12) & 0x3F];
+    *dst++ = remaining == 2 ? kAlphabet[(n >> 6) & 0x3F] : '=';
+    *dst++ = '=';
+  }
+  return out;
+}
+
+static inline int decodeChar(unsigned char c) {
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+  if (c >= '0' && c <= '9') return c - '0' + 52;
+  if (c == '+' || c == '-') return 62;  // '-' for URL-safe input / URL-safe 입력용 '-'
+  if (c == '/' || c == '_') return 63;  // '_' for URL-safe input / URL-safe 입력용 '_'
+  return -1;
+}
+
+bool base64Decode(const char* data, size_t size, std::string& out) {
+  out.clear();
+  out.reserve(size / 4 * 3);
+  uint32_t accumulator = 0;
+  int bits = 0;
+  bool padding = false;
+  for (size_t i = 0; i < size; ++i) {
+    unsigned char c = static_cast<unsigned char>(data[i]);
+    if (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+      continue;
+    }
+    if (c == '=') {
+      padding = true;
+      continue;
+    }
+    int value = decodeChar(c);
+    if (value < 0 || padding) {
+      return false;
+    }
+    accumulator = (accumulator << 6) | static_cast<uint32_t>(value);
+    bits += 6;
+    if (bits >= 8) {
+      bits -= 8;
+      out.push_back(static_cast<char>((accumulator >> bits) & 0xFF));
+    }
+  }
+  return true;
+}
+
+} // namespace common
+} // namespace chrome_remote_devtools
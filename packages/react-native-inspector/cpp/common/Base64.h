@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+// Encoded length of size bytes (with padding) / size 바이트의 인코딩 길이 (패딩 포함)
+inline size_t base64EncodedLength(size_t size) {
+  return (size + 2) / 3 * 4;
+}
+
+// Standard base64 with padding, vectorized with NEON (arm64) or SSSE3 (x86) /
+// 패딩을 포함한 표준 base64, NEON (arm64) 또는 SSSE3 (x86)로 벡터화
+std::string base64Encode(const void* data, size_t size);
+
+// Decode standard base64, whitespace is ignored / 표준 base64 디코딩, 공백은 무시
+// @return false on invalid input / 잘못된 입력이면 false
+bool base64Decode(const char* data, size_t size, std::string& out);
+
+} // namespace common
+} // namespace chrome_remote_devtools
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "Clock.h"
+#include <chrono>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+// Steady and wall clock read back to back / 연속으로 읽은 steady clock과 벽시계
+struct ClockAnchor {
+  int64_t monotonicMicros;
+  int64_t wallMicros;
+};
+
+static const ClockAnchor& anchor() {
+  static const ClockAnchor instance{
+    monotonicMicros(),
+    std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::system_clock::now().time_since_epoch()
+    ).count(),
+  };
+  return instance;
+}
+
+int64_t monotonicMicros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()
+  ).count();
+}
+
+double wallTimeSeconds(int64_t micros) {
+  const ClockAnchor& base = anchor();
+  return static_cast<double>(base.wallMicros + (micros - base.monotonicMicros)) / 1e6;
+}
+
+double wallTimeMillis() {
+  const ClockAnchor& base = anchor();
+  return static_cast<double>(base.wallMicros + (monotonicMicros() - base.monotonicMicros)) / 1e3;
+}
+
+} // namespace common
+} // namespace chrome_remote_devtools
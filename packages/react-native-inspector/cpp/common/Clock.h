@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+// Single time source of every CDP event / 모든 CDP 이벤트의 단일 시간 소스
+// Times are taken from the steady clock in microseconds, so intervals never jump with wall clock changes.
+// Wall time is derived from one anchor pair (steady, system) captured on first use /
+// 시간은 steady clock에서 마이크로초 단위로 가져오므로 벽시계 변경으로 간격이 튀지 않음.
+// 벽시계 시간은 처음 사용할 때 캡처한 하나의 기준 쌍 (steady, system)에서 계산됨
+
+// Current steady clock time in microseconds / 현재 steady clock 시간 (마이크로초)
+int64_t monotonicMicros();
+
+// Monotonic micros as seconds (CDP MonotonicTime) / 모노토닉 마이크로초를 초로 변환 (CDP MonotonicTime)
+inline double monotonicSeconds(int64_t micros) {
+  return static_cast<double>(micros) / 1e6;
+}
+
+inline double monotonicSeconds() {
+  return monotonicSeconds(monotonicMicros());
+}
+
+// Wall time of monotonic micros in seconds since epoch (CDP TimeSinceEpoch) /
+// 모노토닉 마이크로초의 epoch 이후 벽시계 시간 (초, CDP TimeSinceEpoch)
+double wallTimeSeconds(int64_t micros);
+
+// Current wall time in milliseconds since epoch (CDP Runtime.Timestamp) / 현재 epoch 이후 벽시계 시간 (밀리초, CDP Runtime.Timestamp)
+double wallTimeMillis();
+
+} // namespace common
+} // namespace chrome_remote_devtools
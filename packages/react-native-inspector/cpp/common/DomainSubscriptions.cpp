@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "DomainSubscriptions.h"
+#include <cstring>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+namespace detail {
+std::atomic<uint32_t> g_subscriptions{0};
+}
+
+void setDevToolsConnected(bool connected) {
+  if (connected) {
+    detail::g_subscriptions.fetch_or(detail::kConnectedBit, std::memory_order_relaxed);
+  } else {
+    detail::g_subscriptions.fetch_and(~detail::kConnectedBit, std::memory_order_relaxed);
+  }
+}
+
+void setDevToolsAttached(bool attached, bool resumed) {
+  if (!attached) {
+    detail::g_subscriptions.store(0, std::memory_order_relaxed);
+  } else if (resumed) {
+    detail::g_subscriptions.fetch_or(detail::kConnectedBit, std::memory_order_relaxed);
+  } else {
+    detail::g_subscriptions.store(detail::kConnectedBit, std::memory_order_relaxed);
+  }
+}
+
+void setDomainSubscribed(SubscribedDomain domain, bool subscribed) {
+  uint32_t bit = static_cast<uint32_t>(domain);
+  if (subscribed) {
+    detail::g_subscriptions.fetch_or(bit, std::memory_order_relaxed);
+  } else {
+    detail::g_subscriptions.fetch_and(~bit, std::memory_order_relaxed);
+  }
+}
+
+bool trackSubscriptionCommand(const std::string& method) {
+  size_t dot = method.find('.');
+  if (dot == std::string::npos) {
+    return false;
+  }
+  const char* command = method.c_str() + dot + 1;
+  bool subscribed;
+  if (std::strcmp(command, "enable") == 0) {
+    subscribed = true;
+  } else if (std::strcmp(command, "disable") == 0) {
+    subscribed = false;
+  } else {
+    return false;
+  }
+
+  static const struct {
+    const char* name;
+    SubscribedDomain domain;
+  } kDomains[] = {
+    {"Runtime", SubscribedDomain::Runtime},
+    {"Console", SubscribedDomain::Console},
+    {"Log", SubscribedDomain::Log},
+    {"Network", SubscribedDomain::Network},
+  };
+  for (const auto& entry : kDomains) {
+    if (method.compare(0, dot, entry.name) == 0) {
+      setDomainSubscribed(entry.domain, subscribed);
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t subscriptionState() {
+  return detail::g_subscriptions.load(std::memory_order_relaxed);
+}
+
+} // namespace common
+} // namespace chrome_remote_devtools
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+// CDP domains whose enable/disable gates hook work / enable/disable이 훅 작업을 제어하는 CDP 도메인
+enum class SubscribedDomain : uint32_t {
+  Runtime = 1u << 0,
+  Console = 1u << 1,
+  Log = 1u << 2,
+  Network = 1u << 3,
+};
+
+// Domain subscriptions / 도메인 구독
+// One bit per enabled domain plus a connected bit, all in one word so a hook decides with a single relaxed load.
+// The connected bit is set while a DevTools client is attached through an open relay socket. Domain bits survive a
+// dropped socket because the relay server does not replay X.enable to a reconnected app; they are cleared when the
+// server reports that the client detached, and only count while the connected bit is set /
+// 활성화된 도메인마다 한 비트와 연결 비트를 한 워드에 두므로 훅은 relaxed 로드 한 번으로 판단함.
+// 연결 비트는 열린 릴레이 소켓을 통해 DevTools 클라이언트가 연결된 동안 설정됨. 릴레이 서버는 다시 연결된 앱에
+// X.enable을 재전송하지 않으므로 도메인 비트는 소켓이 끊겨도 유지되며, 서버가 클라이언트 분리를 알리면 지워지고,
+// 연결 비트가 설정된 동안에만 유효함
+
+namespace detail {
+extern std::atomic<uint32_t> g_subscriptions;
+constexpr uint32_t kConnectedBit = 1u << 31;
+constexpr uint32_t kConsoleDomains = static_cast<uint32_t>(SubscribedDomain::Runtime) |
+                                     static_cast<uint32_t>(SubscribedDomain::Console) |
+                                     static_cast<uint32_t>(SubscribedDomain::Log);
+constexpr uint32_t kNetworkDomains = static_cast<uint32_t>(SubscribedDomain::Network);
+
+inline bool isCaptureActive(uint32_t domains) {
+  uint32_t subscriptions = g_subscriptions.load(std::memory_order_relaxed);
+  return (subscriptions & kConnectedBit) != 0 && (subscriptions & domains) != 0;
+}
+
+inline bool isSubscribed(uint32_t domains) {
+  return (g_subscriptions.load(std::memory_order_relaxed) & domains) != 0;
+}
+} // namespace detail
+
+// Whether console calls should be captured (Runtime, Console or Log enabled) / console 호출을 캡처해야 하는지 (Runtime, Console, Log 활성화)
+inline bool isConsoleCaptureActive() {
+  return detail::isCaptureActive(detail::kConsoleDomains);
+}
+
+// Whether XHR and fetch should be captured (Network enabled) / XHR과 fetch를 캡처해야 하는지 (Network 활성화)
+inline bool isNetworkCaptureActive() {
+  return detail::isCaptureActive(detail::kNetworkDomains);
+}
+
+// Whether the attached client enabled a console or network domain, even while the relay socket is down /
+// 릴레이 소켓이 끊긴 동안에도, 연결된 클라이언트가 console 또는 network 도메인을 활성화했는지
+// Deferred hooks follow these so a dropped socket does not tear down the object table /
+// 지연 훅은 이를 따르므로 소켓이 끊겨도 객체 테이블이 해체되지 않음
+inline bool isConsoleDomainSubscribed() {
+  return detail::isSubscribed(detail::kConsoleDomains);
+}
+
+inline bool isNetworkDomainSubscribed() {
+  return detail::isSubscribed(detail::kNetworkDomains);
+}
+
+// Called by the platform transport when its relay socket opens or closes / 플랫폼 전송 계층의 릴레이 소켓이 열리거나 닫힐 때 호출됨
+void setDevToolsConnected(bool connected);
+
+/**
+ * Called when the relay server reports a DevTools client attaching or detaching / 릴레이 서버가 DevTools 클라이언트 연결 또는 분리를 알릴 때 호출됨
+ * A new client starts without enabled domains, a resumed one keeps them; detach clears everything /
+ * 새 클라이언트는 활성화된 도메인 없이 시작하고, 재개된 클라이언트는 유지하며, 분리 시 모두 지움
+ * @param resumed The app reconnected to a client that stayed attached / 연결이 유지된 클라이언트에 앱이 다시 연결됨
+ */
+void setDevToolsAttached(bool attached, bool resumed);
+
+void setDomainSubscribed(SubscribedDomain domain, bool subscribed);
+
+/**
+ * Track X.enable / X.disable for the domains above / 위 도메인에 대한 X.enable / X.disable 추적
+ * @param method CDP method name, e.g. "Network.enable" / CDP 메서드 이름, 예: "Network.enable"
+ * @return true if the method was a subscription command / 구독 명령이었으면 true
+ */
+bool trackSubscriptionCommand(const std::string& method);
+
+// Raw word for reports: domain bits plus the connected bit / 보고용 원시 워드: 도메인 비트와 연결 비트
+uint32_t subscriptionState();
+
+} // namespace common
+} // namespace chrome_remote_devtools
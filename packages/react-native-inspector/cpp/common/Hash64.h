@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+// Fast non-cryptographic 64-bit hash (XXH64 algorithm) / 빠른 비암호화 64비트 해시 (XXH64 알고리즘)
+// Used to find identical payloads, never for security / 동일한 페이로드를 찾는 용도이며 보안 용도가 아님
+uint64_t hash64(const void* data, size_t length, uint64_t seed = 0);
+
+} // namespace common
+} // namespace chrome_remote_devtools
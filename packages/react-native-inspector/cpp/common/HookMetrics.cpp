@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "HookMetrics.h"
+#include "LatencyHistogram.h"
+#include "OverheadGovernor.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+static constexpr size_t kSiteCount = static_cast<size_t>(HookSite::Count);
+
+// Indexed by HookSite / HookSite로 인덱싱
+static const char* const kHookSiteNames[] = {
+  "consoleCall",
+  "xhrOpen",
+  "xhrSend",
+  "xhrReadyStateChange",
+  "fetch",
+  "remoteObject",
+  "consoleEvent",
+  "networkEvent",
+  "profilerEvent",
+};
+static_assert(sizeof(kHookSiteNames) / sizeof(kHookSiteNames[0]) == kSiteCount,
+              "kHookSiteNames must match HookSite / kHookSiteNames는 HookSite와 일치해야 함");
+
+const char* hookSiteName(HookSite site) {
+  size_t index = static_cast<size_t>(site);
+  return index < kSiteCount ? kHookSiteNames[index] : "";
+}
+
+static inline uint64_t steadyNanos() {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch())
+                                 .count());
+}
+
+namespace {
+
+struct SiteCounters {
+  std::atomic<uint64_t> calls{0};
+  std::atomic<uint64_t> nanos{0};
+  std::atomic<uint64_t> bytes{0};
+  std::atomic<uint64_t> eventsSent{0};
+  std::atomic<uint64_t> eventsDropped{0};
+  LatencyHistogram histogram;
+};
+
+} // namespace
+
+// Written only by the owning thread; atomics let snapshots read without tearing /
+// 소유 스레드만 씀, 원자 변수라 스냅샷이 찢어짐 없이 읽을 수 있음
+struct HookThreadCounters {
+  std::array<SiteCounters, kSiteCount> sites;
+  std::atomic<uint64_t> inHookNanos{0};
+  uint32_t depth = 0;  // Owning thread only / 소유 스레드 전용
+  bool inUse = false;  // Guarded by registry mutex / 레지스트리 뮤텍스로 보호
+};
+
+namespace {
+
+// Blocks of exited threads are kept and handed to the next new thread, so totals survive thread exit and
+// memory stays bounded by the peak number of hooked threads /
+// 종료된 스레드의 블록은 유지되어 다음 새 스레드에 넘겨지므로 합계가 스레드 종료 후에도 남고
+// 메모리는 훅을 거친 스레드 수의 최댓값으로 제한됨
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<HookThreadCounters>> blocks;
+};
+
+// Intentionally leaked so thread_local destructors can still reach it at exit /
+// 종료 시 thread_local 소멸자가 접근할 수 있도록 의도적으로 해제하지 않음
+Registry& getRegistry() {
+  static Registry* registry = new Registry();
+  return *registry;
+}
+
+struct ThreadSlot {
+  HookThreadCounters* counters = nullptr;
+
+  ~ThreadSlot() {
+    if (counters != nullptr) {
+      Registry& registry = getRegistry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      counters->depth = 0;
+      counters->inUse = false;
+    }
+  }
+};
+
+thread_local ThreadSlot t_slot;
+
+// Lock is taken once per thread, on its first hook / 잠금은 스레드마다 첫 훅에서 한 번만 사용
+HookThreadCounters& currentCounters() {
+  HookThreadCounters* counters = t_slot.counters;
+  if (counters != nullptr) {
+    return *counters;
+  }
+  Registry& registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto& block : registry.blocks) {
+    if (!block->inUse) {
+      counters = block.get();
+      break;
+    }
+  }
+  if (counters == nullptr) {
+    registry.blocks.push_back(std::make_unique<HookThreadCounters>());
+    counters = registry.blocks.back().get();
+  }
+  counters->inUse = true;
+  t_slot.counters = counters;
+  return *counters;
+}
+
+inline void add(std::atomic<uint64_t>& counter, uint64_t value) {
+  counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+} // namespace
+
+HookScope::HookScope(HookSite site)
+    : counters_(currentCounters()), site_(site), start_(steadyNanos()) {
+  ++counters_.depth;
+}
+
+HookScope::~HookScope() {
+  uint64_t end = steadyNanos();
+  uint64_t elapsed = end - start_;
+  elapsed = elapsed > pausedNanos_ ? elapsed - pausedNanos_ : 0;
+  SiteCounters& site = counters_.sites[static_cast<size_t>(site_)];
+  add(site.calls, 1);
+  add(site.nanos, elapsed);
+  site.histogram.record(elapsed);
+  if (--counters_.depth == 0) {
+    add(counters_.inHookNanos, elapsed);
+    recordGovernedHookTime(end, elapsed);
+  }
+}
+
+// Nested scopes inside the paused region (e.g. XHR hooks under the original fetch) count as outermost again /
+// 일시 중지 구간 안의 중첩 범위 (예: 원본 fetch 아래의 XHR 훅)는 다시 가장 바깥 범위로 셈
+HookScope::Pause::Pause(HookScope& scope)
+    : scope_(scope), start_(steadyNanos()), savedDepth_(scope.counters_.depth) {
+  scope_.counters_.depth = 0;
+}
+
+HookScope::Pause::~Pause() {
+  scope_.pausedNanos_ += steadyNanos() - start_;
+  scope_.counters_.depth = savedDepth_;
+}
+
+void recordHookEvent(HookSite site, size_t bytes, bool sent) {
+  SiteCounters& counters = currentCounters().sites[static_cast<size_t>(site)];
+  add(counters.bytes, bytes);
+  add(sent ? counters.eventsSent : counters.eventsDropped, 1);
+}
+
+uint64_t currentThreadInHookNanos() {
+  HookThreadCounters* counters = t_slot.counters;
+  return counters != nullptr ? counters->inHookNanos.load(std::memory_order_relaxed) : 0;
+}
+
+HookMetricsSnapshot snapshotHookMetrics() {
+  HookMetricsSnapshot snapshot;
+  // ~5 KB per site, too large for the stack / 사이트당 약 5 KB라 스택에 두기에는 큼
+  auto histograms = std::make_unique<std::array<LatencyHistogram, kSiteCount>>();
+  Registry& registry = getRegistry();
+  {
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto& block : registry.blocks) {
+      for (size_t i = 0; i < kSiteCount; ++i) {
+        const SiteCounters& site = block->sites[i];
+        HookSiteMetrics& metrics = snapshot.sites[i];
+        metrics.calls += site.calls.load(std::memory_order_relaxed);
+        metrics.totalNanos += site.nanos.load(std::memory_order_relaxed);
+        metrics.bytesSerialized += site.bytes.load(std::memory_order_relaxed);
+        metrics.eventsSent += site.eventsSent.load(std::memory_order_relaxed);
+        metrics.eventsDropped += site.eventsDropped.load(std::memory_order_relaxed);
+        (*histograms)[i].merge(site.histogram);
+      }
+      snapshot.inHookNanos += block->inHookNanos.load(std::memory_order_relaxed);
+    }
+  }
+  for (size_t i = 0; i < kSiteCount; ++i) {
+    LatencySummary summary = (*histograms)[i].summary();
+    snapshot.sites[i].p50Nanos = summary.p50;
+    snapshot.sites[i].p99Nanos = summary.p99;
+    snapshot.sites[i].maxNanos = summary.max;
+  }
+  return snapshot;
+}
+
+void resetHookMetrics() {
+  Registry& registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto& block : registry.blocks) {
+    for (auto& site : block->sites) {
+      site.calls.store(0, std::memory_order_relaxed);
+      site.nanos.store(0, std::memory_order_relaxed);
+      site.bytes.store(0, std::memory_order_relaxed);
+      site.eventsSent.store(0, std::memory_order_relaxed);
+      site.eventsDropped.store(0, std::memory_order_relaxed);
+      site.histogram.reset();
+    }
+    block->inHookNanos.store(0, std::memory_order_relaxed);
+  }
+}
+
+} // namespace common
+} // namespace chrome_remote_devtools
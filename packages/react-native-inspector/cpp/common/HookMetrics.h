@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+// Inspector code paths that measure their own cost / 자체 비용을 측정하는 인스펙터 코드 경로
+enum class HookSite : uint8_t {
+  ConsoleCall = 0,       // Wrapped console.* method / 래핑된 console.* 메서드
+  XHROpen,               // XMLHttpRequest.prototype.open
+  XHRSend,               // XMLHttpRequest.prototype.send
+  XHRReadyStateChange,   // Shared readystatechange listener / 공유 readystatechange 리스너
+  Fetch,                 // Wrapped fetch / 래핑된 fetch
+  RemoteObject,          // jsiValueToRemoteObject
+  ConsoleEvent,          // Runtime.consoleAPICalled sender / Runtime.consoleAPICalled 전송
+  NetworkEvent,          // Network.* event senders / Network.* 이벤트 전송
+  ProfilerEvent,         // Profiler, HeapProfiler and Performance responses / Profiler, HeapProfiler, Performance 응답
+  Count
+};
+
+// Stable name of site used in reports / 보고서에 쓰이는 사이트의 고정 이름
+const char* hookSiteName(HookSite site);
+
+// Counters of one site summed over all threads / 모든 스레드에서 합산된 사이트 하나의 카운터
+struct HookSiteMetrics {
+  uint64_t calls = 0;
+  uint64_t totalNanos = 0;
+  uint64_t p50Nanos = 0;
+  uint64_t p99Nanos = 0;
+  uint64_t maxNanos = 0;
+  uint64_t bytesSerialized = 0;
+  uint64_t eventsSent = 0;
+  uint64_t eventsDropped = 0;
+};
+
+struct HookMetricsSnapshot {
+  std::array<HookSiteMetrics, static_cast<size_t>(HookSite::Count)> sites{};
+  // Time spent in outermost hook scopes, nested scopes are not counted twice /
+  // 가장 바깥 훅 범위에서 보낸 시간, 중첩된 범위는 두 번 세지 않음
+  uint64_t inHookNanos = 0;
+};
+
+// Sum counters of every thread; takes the registry lock, never called from hooks /
+// 모든 스레드의 카운터 합산, 레지스트리 잠금을 사용하며 훅에서는 호출하지 않음
+HookMetricsSnapshot snapshotHookMetrics();
+
+// Zero counters of every thread / 모든 스레드의 카운터를 0으로
+void resetHookMetrics();
+
+// Nanoseconds the calling thread has spent in outermost hook scopes so far / 호출 스레드가 지금까지 가장 바깥 훅 범위에서 보낸 나노초
+uint64_t currentThreadInHookNanos();
+
+struct HookThreadCounters;
+
+// Measures one hook entry on the calling thread / 호출 스레드에서 훅 진입 하나를 측정
+// Counters are per thread and written only by their own thread, so the hot path takes no lock and shares no
+// cache line with other threads. Time spent in the app's original function should be excluded with Pause /
+// 카운터는 스레드별이며 해당 스레드만 쓰므로 핫 경로는 잠금이 없고 다른 스레드와 캐시 라인을 공유하지 않음.
+// 앱의 원본 함수에서 보낸 시간은 Pause로 제외해야 함
+class HookScope {
+public:
+  explicit HookScope(HookSite site);
+  ~HookScope();
+
+  HookScope(const HookScope&) = delete;
+  HookScope& operator=(const HookScope&) = delete;
+
+  // Excludes its lifetime from the enclosing scope, e.g. around the original console method or XHR send /
+  // 수명 동안의 시간을 바깥 범위에서 제외 (예: 원본 console 메서드나 XHR send 주변)
+  class Pause {
+  public:
+    explicit Pause(HookScope& scope);
+    ~Pause();
+
+    Pause(const Pause&) = delete;
+    Pause& operator=(const Pause&) = delete;
+
+  private:
+    HookScope& scope_;
+    uint64_t start_;
+    uint32_t savedDepth_;
+  };
+
+private:
+  HookThreadCounters& counters_;
+  HookSite site_;
+  uint64_t start_;
+  uint64_t pausedNanos_ = 0;
+};
+
+// Count one serialized event of site and whether the transport accepted it /
+// 사이트의 직렬화된 이벤트 하나와 전송 계층이 받아들였는지 기록
+void recordHookEvent(HookSite site, size_t bytes, bool sent);
+
+} // namespace common
+} // namespace chrome_remote_devtools
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "JSIHandleCache.h"
+#include <atomic>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "JSIHandleCache"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "JSIHandleCache"
+#define LOGI(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+namespace common {
+
+// Must match PropName order / PropName 순서와 일치해야 함
+static const char* const kPropNames[] = {
+  "name",
+  "constructor",
+  "stack",
+  "message",
+  "__ChromeRemoteDevToolsServerHost",
+  "__ChromeRemoteDevToolsServerPort",
+  "__cdpNetworkState",
+  "addEventListener",
+  "readyState",
+  "getAllResponseHeaders",
+};
+static_assert(sizeof(kPropNames) / sizeof(kPropNames[0]) == static_cast<size_t>(PropName::Count),
+              "kPropNames must list every PropName");
+
+// Global property stamped with the cache generation / 캐시 세대가 기록되는 전역 속성
+// A new runtime may reuse the old runtime's address, so the pointer alone cannot detect reloads /
+// 새 런타임이 이전 런타임의 주소를 재사용할 수 있으므로 포인터만으로는 리로드를 감지할 수 없음
+static constexpr const char* kGenerationProperty = "__cdpHandleCacheGeneration";
+
+// Raw pointer on purpose: no static destructor may touch a dead runtime /
+// 의도적으로 raw 포인터 사용: 정적 소멸자가 사라진 런타임을 건드리면 안 됨
+static JSIHandleCache* g_handleCache = nullptr;
+static uint64_t g_handleCacheGeneration = 0;
+// Advanced whenever a cache is abandoned; caches of an older epoch are never handed out /
+// 캐시를 버릴 때마다 증가하며 이전 epoch의 캐시는 절대 반환되지 않음
+static std::atomic<uint64_t> g_runtimeEpoch{0};
+
+bool JSIHandleCache::belongsTo(const facebook::jsi::Runtime& runtime) const {
+  return runtime_ == &runtime && epoch_ == g_runtimeEpoch.load(std::memory_order_relaxed);
+}
+
+const facebook::jsi::PropNameID& JSIHandleCache::propName(PropName name) {
+  auto& slot = propNames_[static_cast<size_t>(name)];
+  if (!slot.has_value()) {
+    slot.emplace(facebook::jsi::PropNameID::forAscii(*runtime_, propNameString(name)));
+  }
+  return *slot;
+}
+
+const facebook::jsi::Function* JSIHandleCache::function(CachedFunction slot) const {
+  const auto& function = functions_[static_cast<size_t>(slot)];
+  return function.has_value() ? &*function : nullptr;
+}
+
+void JSIHandleCache::setFunction(CachedFunction slot, facebook::jsi::Function function) {
+  functions_[static_cast<size_t>(slot)].emplace(std::move(function));
+}
+
+void JSIHandleCache::clearFunction(CachedFunction slot) {
+  functions_[static_cast<size_t>(slot)].reset();
+}
+
+bool JSIHandleCache::hasFunctions() const {
+  for (const auto& function : functions_) {
+    if (function.has_value()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+JSIHandleCache* getHandleCache(facebook::jsi::Runtime& runtime) {
+  if (g_handleCache != nullptr && g_handleCache->belongsTo(runtime)) {
+    return g_handleCache;
+  }
+  return nullptr;
+}
+
+// Whether runtime carries the stamp of the current cache / runtime에 현재 캐시의 기록이 있는지 여부
+static bool isStampedRuntime(facebook::jsi::Runtime& runtime) {
+  if (g_handleCache == nullptr || !g_handleCache->belongsTo(runtime)) {
+    return false;
+  }
+  try {
+    facebook::jsi::Value generation = runtime.global().getProperty(runtime, kGenerationProperty);
+    return generation.isNumber() && generation.getNumber() == static_cast<double>(g_handleCache->generation());
+  } catch (...) {
+    // Treat as a new runtime / 새 런타임으로 취급
+    return false;
+  }
+}
+
+static void abandonHandleCache() {
+  // Handles of a reloaded runtime cannot be released safely, abandon them /
+  // 리로드된 런타임의 핸들은 안전하게 해제할 수 없으므로 버림
+  LOGW("JSIHandleCache: Abandoning cache of previous runtime / 이전 런타임의 캐시 폐기");
+  g_handleCache = nullptr;
+  g_runtimeEpoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+void bindHandleCache(facebook::jsi::Runtime& runtime) {
+  if (g_handleCache != nullptr && !isStampedRuntime(runtime)) {
+    abandonHandleCache();
+  }
+}
+
+JSIHandleCache& acquireHandleCache(facebook::jsi::Runtime& runtime) {
+  if (isStampedRuntime(runtime)) {
+    return *g_handleCache;
+  }
+
+  if (g_handleCache != nullptr) {
+    abandonHandleCache();
+  }
+  g_handleCacheGeneration += 1;
+  g_handleCache = new JSIHandleCache(runtime, g_handleCacheGeneration, g_runtimeEpoch.load(std::memory_order_relaxed));
+  try {
+    runtime.global().setProperty(runtime, kGenerationProperty,
+                                 facebook::jsi::Value(static_cast<double>(g_handleCacheGeneration)));
+  } catch (...) {
+    LOGW("JSIHandleCache: Failed to stamp runtime generation / 런타임 세대 기록 실패");
+  }
+  LOGI("JSIHandleCache: Created cache for runtime / 런타임 캐시 생성");
+  return *g_handleCache;
+}
+
+void releaseHandleCache(facebook::jsi::Runtime& runtime) {
+  if (g_handleCache == nullptr || !g_handleCache->belongsTo(runtime) || g_handleCache->hasFunctions()) {
+    return;
+  }
+  // Runtime is alive here, so handles can be destroyed / 여기서는 런타임이 살아 있으므로 핸들 파괴 가능
+  delete g_handleCache;
+  g_handleCache = nullptr;
+  LOGI("JSIHandleCache: Released cache / 캐시 해제");
+}
+
+const char* propNameString(PropName name) {
+  return kPropNames[static_cast<size_t>(name)];
+}
+
+facebook::jsi::Value getCachedProperty(facebook::jsi::Runtime& runtime,
+                                       const facebook::jsi::Object& object,
+                                       PropName name) {
+  if (JSIHandleCache* cache = getHandleCache(runtime)) {
+    return object.getProperty(runtime, cache->propName(name));
+  }
+  return object.getProperty(runtime, propNameString(name));
+}
+
+const facebook::jsi::Function* getCachedFunction(facebook::jsi::Runtime& runtime, CachedFunction slot) {
+  JSIHandleCache* cache = getHandleCache(runtime);
+  return cache != nullptr ? cache->function(slot) : nullptr;
+}
+
+} // namespace common
+} // namespace chrome_remote_devtools
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+// Property names looked up on hook hot paths / 훅 핫 패스에서 조회되는 속성 이름
+enum class PropName : uint8_t {
+  Name,                   // "name"
+  Constructor,            // "constructor"
+  Stack,                  // "stack"
+  Message,                // "message"
+  ServerHost,             // "__ChromeRemoteDevToolsServerHost"
+  ServerPort,             // "__ChromeRemoteDevToolsServerPort"
+  CdpNetworkState,        // "__cdpNetworkState"
+  AddEventListener,       // "addEventListener"
+  ReadyState,             // "readyState"
+  GetAllResponseHeaders,  // "getAllResponseHeaders"
+  Count
+};
+
+// Original functions captured at hook installation / 훅 설치 시 캡처된 원본 함수
+enum class CachedFunction : uint8_t {
+  ConsoleLog,
+  ConsoleWarn,
+  ConsoleError,
+  ConsoleInfo,
+  ConsoleDebug,
+  XHROpen,
+  XHRSend,
+  XHRSetRequestHeader,
+  XHRReadyStateListener,  // Shared by every tracked XHR, not an original / 추적되는 모든 XHR이 공유, 원본 아님
+  Fetch,
+  Count
+};
+
+// Per-runtime cache of PropNameIDs and original functions / 런타임별 PropNameID 및 원본 함수 캐시
+// Saves a temporary string and a Hermes hash lookup per access. JS thread only /
+// 접근마다 임시 문자열과 Hermes 해시 조회를 절약. JS 스레드 전용
+class JSIHandleCache {
+public:
+  JSIHandleCache(facebook::jsi::Runtime& runtime, uint64_t generation, uint64_t epoch)
+      : runtime_(&runtime), generation_(generation), epoch_(epoch) {}
+
+  // Same runtime and no runtime was replaced since creation / 같은 런타임이며 생성 이후 교체된 런타임이 없음
+  bool belongsTo(const facebook::jsi::Runtime& runtime) const;
+
+  // Unique per cache instance, lets other per-runtime state detect reloads /
+  // 캐시 인스턴스마다 고유하며, 다른 런타임별 상태가 리로드를 감지할 수 있게 함
+  uint64_t generation() const { return generation_; }
+
+  // PropNameID for name, created on first use / name의 PropNameID, 처음 사용 시 생성
+  const facebook::jsi::PropNameID& propName(PropName name);
+
+  // Captured original function, or nullptr / 캡처된 원본 함수, 없으면 nullptr
+  const facebook::jsi::Function* function(CachedFunction slot) const;
+  void setFunction(CachedFunction slot, facebook::jsi::Function function);
+  void clearFunction(CachedFunction slot);
+  bool hasFunctions() const;
+
+private:
+  facebook::jsi::Runtime* runtime_;
+  uint64_t generation_;
+  uint64_t epoch_;
+  std::array<std::optional<facebook::jsi::PropNameID>, static_cast<size_t>(PropName::Count)> propNames_;
+  std::array<std::optional<facebook::jsi::Function>, static_cast<size_t>(CachedFunction::Count)> functions_;
+};
+
+// Cache for runtime, or nullptr if hooks were not installed in it or it was replaced /
+// runtime의 캐시, 훅이 설치되지 않았거나 런타임이 교체되었으면 nullptr
+JSIHandleCache* getHandleCache(facebook::jsi::Runtime& runtime);
+
+// Verify the cache against the runtime's generation stamp when a runtime is handed to the inspector /
+// 런타임이 인스펙터에 전달될 때 런타임의 세대 기록으로 캐시 검증
+// A new runtime may reuse the old runtime's address; on mismatch the cache is abandoned and getHandleCache
+// returns nullptr until hooks acquire a new one. JS thread, before any other use of runtime /
+// 새 런타임이 이전 런타임의 주소를 재사용할 수 있음. 불일치하면 캐시를 버리고 훅이 새 캐시를 얻을 때까지
+// getHandleCache는 nullptr를 반환함. JS 스레드에서 runtime의 다른 사용보다 먼저 호출
+void bindHandleCache(facebook::jsi::Runtime& runtime);
+
+// Get or create cache at hook installation / 훅 설치 시 캐시 가져오기 또는 생성
+// A cache left over from a reloaded runtime is abandoned, never destroyed (its runtime is gone) /
+// 리로드된 런타임에서 남은 캐시는 버려지며 파괴되지 않음 (해당 런타임이 이미 사라짐)
+JSIHandleCache& acquireHandleCache(facebook::jsi::Runtime& runtime);
+
+// Destroy cache once no hook holds an original function / 원본 함수를 보유한 훅이 없으면 캐시 파괴
+void releaseHandleCache(facebook::jsi::Runtime& runtime);
+
+// Property name as C string / C 문자열 속성 이름
+const char* propNameString(PropName name);
+
+// Property access through the cache, falling back to C-string lookup /
+// 캐시를 통한 속성 접근, 캐시가 없으면 C 문자열 조회로 대체
+facebook::jsi::Value getCachedProperty(facebook::jsi::Runtime& runtime,
+                                       const facebook::jsi::Object& object,
+                                       PropName name);
+template <typename T>
+void setCachedProperty(facebook::jsi::Runtime& runtime,
+                       facebook::jsi::Object& object,
+                       PropName name,
+                       T&& value) {
+  if (JSIHandleCache* cache = getHandleCache(runtime)) {
+    object.setProperty(runtime, cache->propName(name), std::forward<T>(value));
+  } else {
+    object.setProperty(runtime, propNameString(name), std::forward<T>(value));
+  }
+}
+
+// Original function from cache / 캐시의 원본 함수
+const facebook::jsi::Function* getCachedFunction(facebook::jsi::Runtime& runtime, CachedFunction slot);
+
+} // namespace common
+} // namespace chrome_remote_devtools
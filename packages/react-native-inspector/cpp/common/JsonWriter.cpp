@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "JsonWriter.h"
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+// Escape table for bytes < 0x20 plus '"' and '\\' / 0x20 미만 바이트와 '"', '\\'를 위한 이스케이프 판단
+static inline bool needsEscape(unsigned char c) {
+  return c < 0x20 || c == '"' || c == '\\';
+}
+
+void JsonWriter::appendEscaped(std::string& out, std::string_view text) {
+  static const char kHex[] = "0123456789abcdef";
+  const char* data = text.data();
+  size_t size = text.size();
+  size_t runStart = 0;
+  for (size_t i = 0; i < size; i++) {
+    unsigned char c = static_cast<unsigned char>(data[i]);
+    if (!needsEscape(c)) {
+      continue;
+    }
+    // Flush unescaped run in one append / 이스케이프 불필요 구간을 한 번에 추가
+    out.append(data + runStart, i - runStart);
+    runStart = i + 1;
+    switch (c) {
+      case '"': out.append("\\\"", 2); break;
+      case '\\': out.append("\\\\", 2); break;
+      case '\n': out.append("\\n", 2); break;
+      case '\r': out.append("\\r", 2); break;
+      case '\t': out.append("\\t", 2); break;
+      case '\b': out.append("\\b", 2); break;
+      case '\f': out.append("\\f", 2); break;
+      default: {
+        char escaped[6] = {'\\', 'u', '0', '0', kHex[c >> 4], kHex[c & 0xF]};
+        out.append(escaped, 6);
+        break;
+      }
+    }
+  }
+  out.append(data + runStart, size - runStart);
+}
+
+void JsonWriter::prefix() {
+  if (afterKey_) {
+    afterKey_ = false;
+    return;
+  }
+  if (needComma_) {
+    out_ += ',';
+  }
+  needComma_ = true;
+}
+
+void JsonWriter::beginObject() {
+  prefix();
+  out_ += '{';
+  needComma_ = false;
+}
+
+void JsonWriter::endObject() {
+  out_ += '}';
+  // Parent's next element always needs a separator / 부모의 다음 요소는 항상 구분자가 필요
+  needComma_ = true;
+}
+
+void JsonWriter::beginArray() {
+  prefix();
+  out_ += '[';
+  needComma_ = false;
+}
+
+void JsonWriter::endArray() {
+  out_ += ']';
+  needComma_ = true;
+}
+
+void JsonWriter::key(std::string_view name) {
+  prefix();
+  out_ += '"';
+  appendEscaped(out_, name);
+  out_.append("\":", 2);
+  afterKey_ = true;
+}
+
+void JsonWriter::value(std::string_view text) {
+  prefix();
+  out_.reserve(out_.size() + text.size() + 2);
+  out_ += '"';
+  appendEscaped(out_, text);
+  out_ += '"';
+}
+
+void JsonWriter::value(bool flag) {
+  prefix();
+  if (flag) {
+    out_.append("true", 4);
+  } else {
+    out_.append("false", 5);
+  }
+}
+
+void JsonWriter::value(long long number) {
+  prefix();
+  char buffer[24];
+  auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+  out_.append(buffer, result.ptr - buffer);
+}
+
+void JsonWriter::value(unsigned long long number) {
+  prefix();
+  char buffer[24];
+  auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+  out_.append(buffer, result.ptr - buffer);
+}
+
+void JsonWriter::value(double number) {
+  prefix();
+  // JSON has no NaN/Infinity / JSON에는 NaN/Infinity가 없음
+  if (!std::isfinite(number)) {
+    out_.append("null", 4);
+    return;
+  }
+  appendNumber(out_, number);
+}
+
+void JsonWriter::nullValue() {
+  prefix();
+  out_.append("null", 4);
+}
+
+void JsonWriter::rawValue(std::string_view json) {
+  prefix();
+  out_.append(json.data(), json.size());
+}
+
+void appendNumber(std::string& out, double number) {
+  if (std::isnan(number)) {
+    out.append("NaN", 3);
+    return;
+  }
+  if (std::isinf(number)) {
+    out.append(number > 0 ? "Infinity" : "-Infinity");
+    return;
+  }
+  // Integral values print without fraction / 정수 값은 소수부 없이 출력
+  if (number == std::floor(number) && std::fabs(number) < 9007199254740992.0) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), static_cast<long long>(number));
+    out.append(buffer, result.ptr - buffer);
+    return;
+  }
+  // Shortest of %.15g / %.17g that round-trips / 왕복 변환되는 %.15g / %.17g 중 짧은 쪽
+  char buffer[32];
+  int length = std::snprintf(buffer, sizeof(buffer), "%.15g", number);
+  if (std::strtod(buffer, nullptr) != number) {
+    length = std::snprintf(buffer, sizeof(buffer), "%.17g", number);
+  }
+  if (length > 0) {
+    out.append(buffer, static_cast<size_t>(length));
+  }
+}
+
+std::string& acquireJsonBuffer() {
+  thread_local std::string buffer;
+  buffer.clear();
+  // Do not let one huge event pin memory forever / 하나의 거대한 이벤트가 메모리를 계속 점유하지 않도록 함
+  if (buffer.capacity() > 1024 * 1024) {
+    buffer.shrink_to_fit();
+  }
+  return buffer;
+}
+
+} // namespace common
+} // namespace chrome_remote_devtools
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+// Streaming JSON writer (no DOM) / 스트리밍 JSON 작성기 (DOM 없음)
+// Appends directly into a caller-owned buffer; commas are inserted automatically /
+// 호출자가 소유한 버퍼에 직접 추가하며, 쉼표는 자동으로 삽입됨
+// Usage / 사용법:
+//   JsonWriter w(buffer);
+//   w.beginObject(); w.key("method"); w.value("Network.loadingFinished"); w.endObject();
+class JsonWriter {
+public:
+  explicit JsonWriter(std::string& out) : out_(out) {}
+
+  void beginObject();
+  void endObject();
+  void beginArray();
+  void endArray();
+
+  // Object key; next value call writes its value / 객체 키, 다음 value 호출이 값을 작성
+  void key(std::string_view name);
+
+  void value(std::string_view text);
+  void value(const char* text) { value(std::string_view(text)); }
+  void value(const std::string& text) { value(std::string_view(text)); }
+  void value(bool flag);
+  // Integer overloads cover size_t/int64_t on every platform without ambiguity /
+  // 정수 오버로드는 모든 플랫폼에서 모호함 없이 size_t/int64_t를 처리
+  void value(int number) { value(static_cast<long long>(number)); }
+  void value(unsigned number) { value(static_cast<unsigned long long>(number)); }
+  void value(long number) { value(static_cast<long long>(number)); }
+  void value(unsigned long number) { value(static_cast<unsigned long long>(number)); }
+  void value(long long number);
+  void value(unsigned long long number);
+  void value(double number);
+  void nullValue();
+
+  // Pre-serialized JSON value, written verbatim / 미리 직렬화된 JSON 값, 그대로 작성
+  void rawValue(std::string_view json);
+
+  // key + value shorthand / key + value 단축형
+  template <typename T>
+  void field(std::string_view name, const T& fieldValue) {
+    key(name);
+    value(fieldValue);
+  }
+
+  // Append JSON-escaped string contents (without quotes) / JSON 이스케이프된 문자열 내용 추가 (따옴표 제외)
+  static void appendEscaped(std::string& out, std::string_view text);
+
+private:
+  void prefix();
+
+  std::string& out_;
+  bool needComma_ = false;
+  bool afterKey_ = false;
+};
+
+// Append number in shortest round-trip form (NaN/Infinity as given name) / 왕복 가능한 가장 짧은 형태로 숫자 추가 (NaN/Infinity는 이름으로)
+void appendNumber(std::string& out, double number);
+
+// Thread-local scratch buffer reused across events (cleared, capacity kept) /
+// 이벤트 간 재사용되는 스레드 로컬 버퍼 (내용은 비우고 용량은 유지)
+std::string& acquireJsonBuffer();
+
+} // namespace common
+} // namespace chrome_remote_devtools
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "LatencyHistogram.h"
+#include <cmath>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+static unsigned highestBit(uint64_t value) {
+  unsigned bit = 0;
+  while (value >>= 1) {
+    ++bit;
+  }
+  return bit;
+}
+
+size_t LatencyHistogram::bucketIndex(uint64_t value) {
+  if (value < kSubBucketCount) {
+    return static_cast<size_t>(value);
+  }
+  unsigned exponent = highestBit(value);
+  if (exponent > kMaxExponent) {
+    return kBucketCount - 1;
+  }
+  unsigned shift = exponent - kSubBucketBits;
+  uint64_t subBucket = (value >> shift) & (kSubBucketCount - 1);
+  return static_cast<size_t>(kSubBucketCount + shift * kSubBucketCount + subBucket);
+}
+
+uint64_t LatencyHistogram::bucketHighestValue(size_t index) {
+  if (index < kSubBucketCount) {
+    return index;
+  }
+  uint64_t shift = (index - kSubBucketCount) / kSubBucketCount;
+  uint64_t subBucket = (index - kSubBucketCount) % kSubBucketCount;
+  uint64_t lowest = (kSubBucketCount + subBucket) << shift;
+  return lowest + (uint64_t{1} << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t value) {
+  counts_[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+  total_.fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(value, std::memory_order_relaxed);
+  uint64_t currentMax = max_.load(std::memory_order_relaxed);
+  while (value > currentMax && !max_.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {
+  }
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    uint64_t count = other.counts_[i].load(std::memory_order_relaxed);
+    if (count != 0) {
+      counts_[i].fetch_add(count, std::memory_order_relaxed);
+    }
+  }
+  total_.fetch_add(other.total_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  sum_.fetch_add(other.sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  uint64_t otherMax = other.max_.load(std::memory_order_relaxed);
+  uint64_t currentMax = max_.load(std::memory_order_relaxed);
+  while (otherMax > currentMax && !max_.compare_exchange_weak(currentMax, otherMax, std::memory_order_relaxed)) {
+  }
+}
+
+uint64_t LatencyHistogram::percentile(double percent) const {
+  uint64_t total = total_.load(std::memory_order_relaxed);
+  if (total == 0) {
+    return 0;
+  }
+  uint64_t target = static_cast<uint64_t>(std::ceil(percent / 100.0 * static_cast<double>(total)));
+  if (target == 0) {
+    target = 1;
+  }
+  uint64_t max = max_.load(std::memory_order_relaxed);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    seen += counts_[i].load(std::memory_order_relaxed);
+    if (seen >= target) {
+      uint64_t value = bucketHighestValue(i);
+      return value < max ? value : max;
+    }
+  }
+  return max;
+}
+
+LatencySummary LatencyHistogram::summary() const {
+  LatencySummary summary;
+  summary.count = total_.load(std::memory_order_relaxed);
+  if (summary.count == 0) {
+    return summary;
+  }
+  summary.p50 = percentile(50);
+  summary.p90 = percentile(90);
+  summary.p99 = percentile(99);
+  summary.max = max_.load(std::memory_order_relaxed);
+  summary.mean = static_cast<double>(sum_.load(std::memory_order_relaxed)) / static_cast<double>(summary.count);
+  return summary;
+}
+
+void LatencyHistogram::reset() {
+  for (auto& count : counts_) {
+    count.store(0, std::memory_order_relaxed);
+  }
+  total_.store(0, std::memory_order_relaxed);
+  sum_.store(0, std::memory_order_relaxed);
+  max_.store(0, std::memory_order_relaxed);
+}
+
+} // namespace common
+} // namespace chrome_remote_devtools
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+// Summary of recorded latencies, in the unit they were recorded in / 기록된 지연 시간 요약 (기록한 단위 그대로)
+struct LatencySummary {
+  uint64_t count = 0;
+  uint64_t p50 = 0;
+  uint64_t p90 = 0;
+  uint64_t p99 = 0;
+  uint64_t max = 0;
+  double mean = 0;
+};
+
+// HDR-style log-linear histogram of latencies / 지연 시간의 HDR 방식 로그-선형 히스토그램
+// Every power of two is split into 16 linear buckets, so any value is reported within 6.25% using a fixed
+// ~5 KB of counters. The unit is the caller's (micros for the stall watchdog, nanos for hook metrics).
+// Recording is lock-free and safe from any thread /
+// 2의 거듭제곱 구간마다 16개의 선형 버킷으로 나누어 고정된 약 5 KB 카운터로 모든 값을 6.25% 이내로 보고함.
+// 단위는 호출자가 정함 (멈춤 감시기는 마이크로초, 훅 메트릭은 나노초). 기록은 잠금 없이 모든 스레드에서 안전함
+class LatencyHistogram {
+public:
+  void record(uint64_t value);
+
+  // Add counts of other, e.g. to combine per-thread histograms / other의 카운트를 더함 (예: 스레드별 히스토그램 합산)
+  void merge(const LatencyHistogram& other);
+
+  // Value at percentile (0-100), reported as the bucket's highest value / 백분위수(0-100)의 값, 버킷의 최댓값으로 보고
+  uint64_t percentile(double percent) const;
+
+  LatencySummary summary() const;
+
+  void reset();
+
+private:
+  static constexpr unsigned kSubBucketBits = 4;
+  static constexpr uint64_t kSubBucketCount = 1u << kSubBucketBits;
+  static constexpr unsigned kMaxExponent = 40;  // ~12 days in micros, ~18 minutes in nanos / 마이크로초로 약 12일, 나노초로 약 18분
+  static constexpr size_t kBucketCount = kSubBucketCount + (kMaxExponent - kSubBucketBits + 1) * kSubBucketCount;
+
+  static size_t bucketIndex(uint64_t value);
+  static uint64_t bucketHighestValue(size_t index);
+
+  std::array<std::atomic<uint64_t>, kBucketCount> counts_{};
+  std::atomic<uint64_t> total_{0};
+  std::atomic<uint64_t> sum_{0};
+  std::atomic<uint64_t> max_{0};
+};
+
+} // namespace common
+} // namespace chrome_remote_devtools
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "OverheadGovernor.h"
+#include <array>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+namespace detail {
+std::atomic<uint8_t> g_captureLevel{static_cast<uint8_t>(CaptureLevel::Full)};
+}
+
+static constexpr uint64_t kBucketNanos = 100ull * 1000 * 1000;
+static constexpr size_t kBucketCount = 10;
+// Fewer completed buckets than this are too noisy to act on / 완료된 버킷이 이보다 적으면 판단하기에 너무 불안정함
+static constexpr size_t kMinBucketsToEvaluate = 3;
+static constexpr uint64_t kMinNanosBetweenDegrades = 500ull * 1000 * 1000;
+// Consecutive buckets the window must stay below half the budget before one level is restored (2 s) /
+// 한 단계를 복원하기 전에 윈도가 예산의 절반 미만을 유지해야 하는 연속 버킷 수 (2초)
+static constexpr uint64_t kQuietBucketsBeforeRestore = 20;
+
+static std::atomic<uint32_t> g_budgetPartsPerMillion{30000};
+static std::atomic<uint32_t> g_consoleSampleEvery{10};
+static std::atomic<size_t> g_maxResponseBodyBytes{64 * 1024};
+
+static std::atomic<uint32_t> g_hookFractionPartsPerMillion{0};
+static std::atomic<uint64_t> g_skippedConsoleMessages{0};
+static std::atomic<uint64_t> g_skippedResponseBodies{0};
+static std::atomic<bool> g_levelChanged{false};
+
+const char* captureLevelName(CaptureLevel level) {
+  switch (level) {
+    case CaptureLevel::Full: return "full";
+    case CaptureLevel::SampledConsole: return "sampledConsole";
+    case CaptureLevel::NoPreviews: return "noPreviews";
+    case CaptureLevel::NoLargeBodies: return "noLargeBodies";
+    case CaptureLevel::ErrorsOnly: return "errorsOnly";
+  }
+  return "";
+}
+
+void setGovernorConfig(const GovernorConfig& config) {
+  double budget = config.budgetFraction < 0 ? 0 : (config.budgetFraction > 1 ? 1 : config.budgetFraction);
+  g_budgetPartsPerMillion.store(static_cast<uint32_t>(budget * 1e6), std::memory_order_relaxed);
+  g_consoleSampleEvery.store(config.consoleSampleEvery > 0 ? config.consoleSampleEvery : 1, std::memory_order_relaxed);
+  g_maxResponseBodyBytes.store(config.maxResponseBodyBytes, std::memory_order_relaxed);
+  if (budget == 0 && captureLevel() != CaptureLevel::Full) {
+    detail::g_captureLevel.store(static_cast<uint8_t>(CaptureLevel::Full), std::memory_order_relaxed);
+    g_levelChanged.store(true, std::memory_order_release);
+  }
+}
+
+GovernorConfig governorConfig() {
+  GovernorConfig config;
+  config.budgetFraction = static_cast<double>(g_budgetPartsPerMillion.load(std::memory_order_relaxed)) / 1e6;
+  config.consoleSampleEvery = g_consoleSampleEvery.load(std::memory_order_relaxed);
+  config.maxResponseBodyBytes = g_maxResponseBodyBytes.load(std::memory_order_relaxed);
+  return config;
+}
+
+namespace {
+
+// Sliding window of the thread running hooks / 훅을 실행하는 스레드의 슬라이딩 윈도
+struct HookTimeWindow {
+  std::array<uint64_t, kBucketCount> buckets{};
+  size_t current = 0;
+  size_t completed = 0;
+  uint64_t bucketStart = 0;
+  uint64_t lastChange = 0;
+  // Buckets completed in a row while under the restore threshold / 복원 임계값 미만으로 연속 완료된 버킷 수
+  uint64_t quietBuckets = 0;
+  bool started = false;
+};
+
+thread_local HookTimeWindow t_window;
+
+void setLevel(CaptureLevel level) {
+  detail::g_captureLevel.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+  g_levelChanged.store(true, std::memory_order_release);
+}
+
+void evaluate(HookTimeWindow& window, uint64_t now, uint64_t elapsedBuckets) {
+  if (window.completed < kMinBucketsToEvaluate) {
+    return;
+  }
+  // Completed buckets only, the current one has just started / 완료된 버킷만, 현재 버킷은 막 시작됨
+  uint64_t hookNanos = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    if (i != window.current) {
+      hookNanos += window.buckets[i];
+    }
+  }
+  uint64_t spanNanos = static_cast<uint64_t>(window.completed) * kBucketNanos;
+  uint32_t fraction = static_cast<uint32_t>(static_cast<double>(hookNanos) / static_cast<double>(spanNanos) * 1e6);
+  g_hookFractionPartsPerMillion.store(fraction, std::memory_order_relaxed);
+
+  uint32_t budget = g_budgetPartsPerMillion.load(std::memory_order_relaxed);
+  if (budget == 0) {
+    return;
+  }
+  // One quiet window right after a burst is not enough, the quiet must last / 버스트 직후 조용한 윈도 하나로는 부족하며 지속되어야 함
+  if (fraction < budget / 2) {
+    window.quietBuckets += elapsedBuckets;
+  } else {
+    window.quietBuckets = 0;
+  }
+  CaptureLevel level = captureLevel();
+  uint64_t sinceChange = now - window.lastChange;
+  if (fraction > budget && level < CaptureLevel::ErrorsOnly && sinceChange >= kMinNanosBetweenDegrades) {
+    setLevel(static_cast<CaptureLevel>(static_cast<uint8_t>(level) + 1));
+    window.lastChange = now;
+  } else if (level > CaptureLevel::Full && window.quietBuckets >= kQuietBucketsBeforeRestore) {
+    setLevel(static_cast<CaptureLevel>(static_cast<uint8_t>(level) - 1));
+    window.lastChange = now;
+    window.quietBuckets = 0;
+  }
+}
+
+} // namespace
+
+void recordGovernedHookTime(uint64_t nowNanos, uint64_t elapsedNanos) {
+  HookTimeWindow& window = t_window;
+  if (!window.started) {
+    window.started = true;
+    window.bucketStart = nowNanos;
+    window.lastChange = nowNanos;
+  }
+  uint64_t age = nowNanos - window.bucketStart;
+  if (age >= kBucketNanos) {
+    // Skip buckets of idle time at once / 유휴 시간의 버킷을 한 번에 건너뜀
+    uint64_t steps = age / kBucketNanos;
+    size_t clears = steps < kBucketCount ? static_cast<size_t>(steps) : kBucketCount;
+    for (size_t i = 0; i < clears; ++i) {
+      window.current = (window.current + 1) % kBucketCount;
+      window.buckets[window.current] = 0;
+    }
+    window.bucketStart += steps * kBucketNanos;
+    window.completed = window.completed + clears < kBucketCount - 1 ? window.completed + clears : kBucketCount - 1;
+    evaluate(window, nowNanos, steps);
+  }
+  window.buckets[window.current] += elapsedNanos;
+}
+
+bool admitConsoleMessage(int logLevel) {
+  CaptureLevel level = captureLevel();
+  if (level == CaptureLevel::Full || logLevel >= 6) {
+    return true;
+  }
+  if (level < CaptureLevel::ErrorsOnly) {
+    if (logLevel == 5) {
+      return true;
+    }
+    // Per-thread counter, console runs on the JS thread / 스레드별 카운터, console은 JS 스레드에서 실행됨
+    thread_local uint32_t t_sampleCounter = 0;
+    if (++t_sampleCounter >= g_consoleSampleEvery.load(std::memory_order_relaxed)) {
+      t_sampleCounter = 0;
+      return true;
+    }
+  }
+  g_skippedConsoleMessages.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+bool shouldKeepResponseBody(size_t bytes) {
+  if (captureLevel() < CaptureLevel::NoLargeBodies || bytes <= g_maxResponseBodyBytes.load(std::memory_order_relaxed)) {
+    return true;
+  }
+  g_skippedResponseBodies.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+double governedHookFraction() {
+  return static_cast<double>(g_hookFractionPartsPerMillion.load(std::memory_order_relaxed)) / 1e6;
+}
+
+uint64_t skippedConsoleMessageCount() {
+  return g_skippedConsoleMessages.load(std::memory_order_relaxed);
+}
+
+uint64_t skippedResponseBodyCount() {
+  return g_skippedResponseBodies.load(std::memory_order_relaxed);
+}
+
+bool takeCaptureLevelChange() {
+  return g_levelChanged.load(std::memory_order_relaxed) && g_levelChanged.exchange(false, std::memory_order_acquire);
+}
+
+} // namespace common
+} // namespace chrome_remote_devtools
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace chrome_remote_devtools {
+namespace common {
+
+// Capture fidelity, each level keeps the reductions of the levels below it /
+// 캡처 충실도, 각 단계는 아래 단계의 축소를 모두 유지함
+enum class CaptureLevel : uint8_t {
+  Full = 0,
+  SampledConsole,  // console.log/info/debug sampled 1 in consoleSampleEvery / console.log/info/debug를 consoleSampleEvery개 중 1개만
+  NoPreviews,      // Object previews are not built / 객체 미리보기를 만들지 않음
+  NoLargeBodies,   // Response bodies above maxResponseBodyBytes are not kept / maxResponseBodyBytes 초과 응답 본문을 보관하지 않음
+  ErrorsOnly,      // Only console.error is captured / console.error만 캡처
+};
+
+const char* captureLevelName(CaptureLevel level);
+
+struct GovernorConfig {
+  // Share of JS thread time hooks may use, 0 disables the governor / 훅이 쓸 수 있는 JS 스레드 시간 비율, 0이면 거버너 비활성화
+  double budgetFraction = 0.03;
+  uint32_t consoleSampleEvery = 10;
+  size_t maxResponseBodyBytes = 64 * 1024;
+};
+
+void setGovernorConfig(const GovernorConfig& config);
+GovernorConfig governorConfig();
+
+// Adaptive overhead governor / 적응형 오버헤드 거버너
+// Time of outermost hook scopes is summed into a 1 s sliding window of 100 ms buckets on the thread that ran them.
+// When the share of that window spent in hooks exceeds the budget, capture drops one level (at most every
+// 500 ms); once it stays below half the budget for 2 s in a row, one level is restored. The window only advances when a
+// hook runs, so a quiet app pays nothing and recovers on its next hook /
+// 가장 바깥 훅 범위의 시간은 이를 실행한 스레드에서 100 ms 버킷으로 된 1초 슬라이딩 윈도에 합산됨.
+// 윈도에서 훅이 차지한 비율이 예산을 넘으면 캡처를 한 단계 낮추고 (최대 500 ms마다), 2초 연속 예산의 절반 미만이면
+// 한 단계 복원함. 윈도는 훅이 실행될 때만 진행하므로 조용한 앱은 비용이 없고 다음 훅에서 복원됨
+
+// Called by HookScope when an outermost scope ends / 가장 바깥 HookScope가 끝날 때 호출됨
+void recordGovernedHookTime(uint64_t nowNanos, uint64_t elapsedNanos);
+
+namespace detail {
+extern std::atomic<uint8_t> g_captureLevel;
+}
+
+// Single relaxed load, safe on hook hot paths / 단일 relaxed 로드, 훅 핫 경로에서 안전
+inline CaptureLevel captureLevel() {
+  return static_cast<CaptureLevel>(detail::g_captureLevel.load(std::memory_order_relaxed));
+}
+
+// Whether a console message of logLevel (6 error, 5 warn, 4 info, 3 debug) is captured at the current level /
+// 현재 단계에서 logLevel (6 error, 5 warn, 4 info, 3 debug)의 console 메시지를 캡처하는지 여부
+bool admitConsoleMessage(int logLevel);
+
+inline bool shouldGeneratePreviews() {
+  return captureLevel() < CaptureLevel::NoPreviews;
+}
+
+bool shouldKeepResponseBody(size_t bytes);
+
+// Share of the window spent in hooks at the last evaluation / 마지막 평가 시 윈도에서 훅이 차지한 비율
+double governedHookFraction();
+
+// Console messages skipped by sampling or errors-only / 샘플링 또는 errors-only로 건너뛴 console 메시지 수
+uint64_t skippedConsoleMessageCount();
+
+// Bodies not kept because of the size limit / 크기 제한으로 보관하지 않은 본문 수
+uint64_t skippedResponseBodyCount();
+
+// True once per level change, for the CDP notice / 단계가 바뀔 때마다 한 번 true, CDP 알림용
+bool takeCaptureLevelChange();
+
+} // namespace common
+} // namespace chrome_remote_devtools
@@ -11,8 +11,12 @@
 #include "ConsoleGlobals.h"
 #include "ConsoleUtils.h"
 #include "../ConsoleHook.h" // For SendCDPMessageCallback / SendCDPMessageCallback을 위해
-#include <folly/json.h>
-#include <chrono>
+#include "../transport/CDPEventSender.h"
+#include "../common/Clock.h"
+#include "../common/JsonWriter.h"
+#include "../common/JSIHandleCache.h"
+#include "../common/HookMetrics.h"
+#include <atomic>
 #include <cstring>
 
 // Platform-specific log support / 플랫폼별 로그 지원
@@ -35,7 +39,7 @@
 
 // Forward declaration / 전방 선언
 namespace chrome_remote_devtools {
-  extern SendCDPMessageCallback g_sendCDPMessageCallback;
+  extern std::atomic<SendCDPMessageCallback> g_sendCDPMessageCallback;
 }
 
 namespace chrome_remote_devtools {
@@ -46,11 +50,12 @@ static void getServerInfo(facebook::jsi::Runtime& runtime, std::string& serverHo
   serverHost = "localhost";
   serverPort = 8080;
   try {
-    facebook::jsi::Value hostValue = runtime.global().getProperty(runtime, "__ChromeRemoteDevToolsServerHost");
+    facebook::jsi::Object global = runtime.global();
+    facebook::jsi::Value hostValue = common::getCachedProperty(runtime, global, common::PropName::ServerHost);
     if (hostValue.isString()) {
       serverHost = hostValue.asString(runtime).utf8(runtime);
     }
-    facebook::jsi::Value portValue = runtime.global().getProperty(runtime, "__ChromeRemoteDevToolsServerPort");
+    facebook::jsi::Value portValue = common::getCachedProperty(runtime, global, common::PropName::ServerPort);
     if (portValue.isNumber()) {
       serverPort = static_cast<int>(portValue.asNumber());
     }
@@ -59,189 +64,113 @@ static void getServerInfo(facebook::jsi::Runtime& runtime, std::string& serverHo
   }
 }
 
+// Write primitive RemoteObject value with its JSON type / 기본 타입 RemoteObject 값을 JSON 타입에 맞게 작성
+static void writePrimitiveValue(common::JsonWriter& writer, const RemoteObject& arg) {
+  if (arg.type == "object" && arg.subtype == "null") {
+    // null: store as JSON null / null: JSON null로 저장
+    writer.key("value");
+    writer.nullValue();
+    return;
+  }
+  if (arg.value.empty()) {
+    return;
+  }
+  if (arg.type == "number") {
+    // Parse number and store as double / 숫자를 파싱하여 double로 저장
+    try {
+      double numValue = std::stod(arg.value);
+      writer.field("value", numValue);
+    } catch (...) {
+      // If parsing fails, use string / 파싱 실패 시 문자열 사용
+      writer.field("value", arg.value);
+    }
+  } else if (arg.type == "boolean" && (arg.value == "true" || arg.value == "false")) {
+    writer.field("value", arg.value == "true");
+  } else {
+    // String or other types: use string value / 문자열 또는 기타 타입: 문자열 값 사용
+    writer.field("value", arg.value);
+  }
+}
+
+// Write one RemoteObject argument / RemoteObject 인자 하나 작성
+static void writeRemoteObject(common::JsonWriter& writer, const RemoteObject& arg) {
+  writer.beginObject();
+  writer.field("type", arg.type);
+  // Always include subtype field (empty string if not set) / subtype 필드를 항상 포함 (설정되지 않았으면 빈 문자열)
+  writer.field("subtype", arg.subtype);
+  bool isObject = arg.type == "object" && arg.subtype != "null";
+  if (!isObject) {
+    // Only include value for primitive types and null / 기본 타입과 null에만 value 포함
+    writePrimitiveValue(writer, arg);
+    if (!arg.description.empty()) {
+      writer.field("description", arg.description);
+    }
+  } else {
+    // CDP spec: details go in preview, not in description or value / CDP 스펙: 상세 내용은 description이나 value가 아닌 preview에
+    if (!arg.objectId.empty()) {
+      writer.field("objectId", arg.objectId);
+    }
+    writer.field("className", arg.className.empty() ? std::string("Object") : arg.className);
+    writer.field("description", arg.description.empty() ? std::string("Object") : arg.description);
+    if (!arg.preview.empty()) {
+      // Preview is already serialized by the native walker / preview는 네이티브 순회기가 이미 직렬화함
+      writer.key("preview");
+      writer.rawValue(arg.preview);
+    }
+  }
+  writer.endObject();
+}
+
 // Send console API called event / console API 호출 이벤트 전송
 void sendConsoleAPICalled(facebook::jsi::Runtime& runtime,
                           const std::string& type,
                           const std::vector<RemoteObject>& args) {
+  common::HookScope hookScope(common::HookSite::ConsoleEvent);
   try {
-    // Create args array using folly::dynamic / folly::dynamic을 사용하여 args 배열 생성
-    folly::dynamic argsArray = folly::dynamic::array;
-    for (const auto& arg : args) {
-      folly::dynamic argObj = folly::dynamic::object;
-      argObj["type"] = arg.type;
-      // Always include subtype field (empty string if not set) / subtype 필드를 항상 포함 (설정되지 않았으면 빈 문자열)
-      argObj["subtype"] = arg.subtype.empty() ? "" : arg.subtype;
-      // For objects, do NOT include value field / 객체의 경우 value 필드를 포함하지 않음
-      // Only include value for primitive types / 기본 타입에만 value 포함
-      if (arg.type != "object" || arg.subtype == "null") {
-        // Primitive types or null: include value with correct type / 기본 타입 또는 null: 올바른 타입으로 value 포함
-        if (!arg.value.empty()) {
-          if (arg.type == "number") {
-            // Parse number and store as double / 숫자를 파싱하여 double로 저장
-            try {
-              double numValue = std::stod(arg.value);
-              argObj["value"] = numValue;
-            } catch (...) {
-              // If parsing fails, use string / 파싱 실패 시 문자열 사용
-              argObj["value"] = arg.value;
-            }
-          } else if (arg.type == "boolean") {
-            // Parse boolean and store as bool / 불린을 파싱하여 bool로 저장
-            if (arg.value == "true") {
-              argObj["value"] = true;
-            } else if (arg.value == "false") {
-              argObj["value"] = false;
-            } else {
-              // If parsing fails, use string / 파싱 실패 시 문자열 사용
-              argObj["value"] = arg.value;
-            }
-          } else if (arg.type == "object" && arg.subtype == "null") {
-            // null: store as nullptr / null: nullptr로 저장
-            argObj["value"] = nullptr;
-          } else {
-            // String or other types: use string value / 문자열 또는 기타 타입: 문자열 값 사용
-            argObj["value"] = arg.value;
-          }
-        } else if (arg.type == "object" && arg.subtype == "null") {
-          // null without value string: store as nullptr / 값 문자열이 없는 null: nullptr로 저장
-          argObj["value"] = nullptr;
-        }
-      }
-      // For objects (type == "object" && subtype != "null"), format according to CDP spec / 객체의 경우 (type == "object" && subtype != "null"), CDP 스펙에 따라 포맷팅
-      // CDP spec: Objects should use "Object" as description, not JSON string / CDP 스펙: 객체는 JSON 문자열이 아닌 "Object"를 description으로 사용해야 함
-      // Details should be in preview.properties, not in description or value / 상세 내용은 description이나 value가 아닌 preview.properties에 있어야 함
-
-      // Add description if present (for objects) / description이 있으면 추가 (객체용)
-      if (!arg.description.empty()) {
-        // For objects, try to parse description as JSON and create preview / 객체의 경우 description을 JSON으로 파싱하여 preview 생성
-        if (arg.type == "object" && arg.subtype != "null") {
-          try {
-            // Try to parse description as JSON / description을 JSON으로 파싱 시도
-            folly::dynamic parsedDesc = folly::parseJson(arg.description);
-            if (parsedDesc.isObject()) {
-              // Use objectId from RemoteObject if available, otherwise generate new one / RemoteObject에서 objectId를 사용할 수 있으면 사용, 없으면 새로 생성
-              std::string objectIdStr;
-              if (!arg.objectId.empty()) {
-                // Use existing objectId from RemoteObject / RemoteObject의 기존 objectId 사용
-                objectIdStr = arg.objectId;
-              } else {
-                // Generate unique objectId / 고유한 objectId 생성
-                size_t objectId = console::g_objectIdCounter.fetch_add(1);
-                objectIdStr = std::to_string(objectId);
-              }
-              argObj["objectId"] = objectIdStr;
+    // Wall time in milliseconds with microsecond fraction (Runtime.Timestamp) / 마이크로초 소수부를 포함한 밀리초 벽시계 시간 (Runtime.Timestamp)
+    double timestamp = common::wallTimeMillis();
 
-              // Store original JSON string for Runtime.getProperties / Runtime.getProperties를 위해 원본 JSON 문자열 저장
-              argObj["_originalDescription"] = arg.description;
-
-              // Set description to "Object" instead of JSON string / description을 JSON 문자열이 아닌 "Object"로 설정
-              argObj["description"] = "Object";
-              // Add className for better DevTools display / 더 나은 DevTools 표시를 위해 className 추가
-              argObj["className"] = "Object";
-
-              // Create preview object / preview 객체 생성
-              folly::dynamic preview = folly::dynamic::object;
-              preview["type"] = "object";
-              preview["subtype"] = ""; // Empty subtype for preview / preview를 위한 빈 subtype
-              preview["description"] = "Object";
-
-              // Extract properties from parsed JSON / 파싱된 JSON에서 속성 추출
-              folly::dynamic properties = folly::dynamic::array;
-              size_t propertyCount = 0;
-              const size_t maxProperties = 100; // Limit properties for preview / preview를 위한 속성 제한
-              for (const auto& pair : parsedDesc.items()) {
-                if (propertyCount >= maxProperties) {
-                  break;
-                }
-                propertyCount++;
-
-                folly::dynamic prop = folly::dynamic::object;
-                prop["name"] = pair.first.asString();
-
-                // Determine property type and value / 속성 타입과 값 결정
-                if (pair.second.isBool()) {
-                  prop["type"] = "boolean";
-                  prop["subtype"] = ""; // Empty subtype / 빈 subtype
-                  prop["value"] = pair.second.asBool() ? "true" : "false";
-                } else if (pair.second.isNumber()) {
-                  prop["type"] = "number";
-                  prop["subtype"] = ""; // Empty subtype / 빈 subtype
-                  prop["value"] = std::to_string(pair.second.asDouble());
-                } else if (pair.second.isString()) {
-                  prop["type"] = "string";
-                  prop["subtype"] = ""; // Empty subtype / 빈 subtype
-                  prop["value"] = pair.second.asString();
-                } else if (pair.second.isNull()) {
-                  prop["type"] = "object";
-                  prop["subtype"] = "null";
-                  prop["value"] = "null";
-                } else {
-                  prop["type"] = "object";
-                  prop["subtype"] = ""; // Empty subtype / 빈 subtype
-                  prop["value"] = "Object";
-                }
-
-                properties.push_back(prop);
-              }
-
-              preview["properties"] = properties;
-              // Set overflow flag if there are more properties / 더 많은 속성이 있으면 overflow 플래그 설정
-              preview["overflow"] = propertyCount < parsedDesc.size();
-              argObj["preview"] = preview;
-            } else {
-              // If not a valid JSON object, use description as-is / 유효한 JSON 객체가 아니면 description을 그대로 사용
-              argObj["description"] = arg.description;
-            }
-          } catch (...) {
-            // If parsing fails, use description as-is / 파싱 실패 시 description을 그대로 사용
-            argObj["description"] = arg.description;
-          }
-        } else {
-          // For non-object types, use description as-is / 객체가 아닌 타입의 경우 description을 그대로 사용
-          argObj["description"] = arg.description;
-        }
-      }
-      argsArray.push_back(argObj);
+    // Stream CDP message directly into reusable buffer / 재사용 버퍼에 CDP 메시지를 직접 스트리밍
+    std::string& cdpMessageJson = common::acquireJsonBuffer();
+    common::JsonWriter writer(cdpMessageJson);
+    writer.beginObject();
+    writer.field("method", "Runtime.consoleAPICalled");
+    writer.key("params");
+    writer.beginObject();
+    writer.field("type", type);
+    writer.key("args");
+    writer.beginArray();
+    for (const auto& arg : args) {
+      writeRemoteObject(writer, arg);
     }
-
-    // Create CDP message using folly::dynamic / folly::dynamic을 사용하여 CDP 메시지 생성
-    auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
-      std::chrono::system_clock::now().time_since_epoch()
-    ).count();
-
-    folly::dynamic params = folly::dynamic::object;
-    params["type"] = type;
-    params["args"] = argsArray;
-    params["executionContextId"] = 1;
-    params["timestamp"] = timestamp;
-    params["stackTrace"] = folly::dynamic::object("callFrames", folly::dynamic::array);
-
-    folly::dynamic cdpMessage = folly::dynamic::object;
-    cdpMessage["method"] = "Runtime.consoleAPICalled";
-    cdpMessage["params"] = params;
-
-    // Serialize to JSON string / JSON 문자열로 직렬화
-    folly::json::serialization_opts opts;
-    std::string cdpMessageJson = folly::json::serialize(cdpMessage, opts);
+    writer.endArray();
+    writer.field("executionContextId", 1);
+    writer.field("timestamp", timestamp);
+    writer.key("stackTrace");
+    writer.beginObject();
+    writer.key("callFrames");
+    writer.beginArray();
+    writer.endArray();
+    writer.endObject();
+    writer.endObject();
+    writer.endObject();
 
     // Get server info / 서버 정보 가져오기
     std::string serverHost;
     int serverPort;
     getServerInfo(runtime, serverHost, serverPort);
 
-    // Try to send via platform-specific callback first / 먼저 플랫폼별 콜백을 통해 전송 시도
+    // Hand off to sender thread when platform callback is set / 플랫폼 콜백이 설정되어 있으면 전송 스레드로 넘김
+    // JS thread only pays for the enqueue / JS 스레드는 큐 추가 비용만 부담
     if (chrome_remote_devtools::g_sendCDPMessageCallback != nullptr) {
-      try {
-        chrome_remote_devtools::g_sendCDPMessageCallback(serverHost.c_str(), serverPort, cdpMessageJson.c_str());
-        LOGI("Sending CDP message via platform callback / 플랫폼 콜백을 통해 CDP 메시지 전송");
-        return;
-      } catch (const std::exception& e) {
-        LOGE("Failed to send via platform callback: %s", e.what());
-      } catch (...) {
-        LOGE("Failed to send via platform callback (unknown exception) / 플랫폼 콜백을 통해 전송 실패 (알 수 없는 예외)");
-      }
+      bool enqueued = transport::enqueueCDPMessage(serverHost, serverPort, cdpMessageJson);
+      common::recordHookEvent(common::HookSite::ConsoleEvent, cdpMessageJson.size(), enqueued);
+      return;
     }
 
+    // Fallback calls into JS, which may re-enter console and reuse the buffer / 폴백은 JS를 호출하므로 console 재진입으로 버퍼가 재사용될 수 있음
+    std::string fallbackMessageJson = cdpMessageJson;
+
     // Fallback: Try to send via TurboModule directly from JSI / 폴백: JSI에서 TurboModule을 직접 호출하여 전송 시도
     try {
       // Get NativeModules from react-native / react-native에서 NativeModules 가져오기
@@ -289,7 +218,7 @@ void sendConsoleAPICalled(facebook::jsi::Runtime& runtime,
                       runtime.global(),
                       facebook::jsi::String::createFromUtf8(runtime, serverHost),
                       serverPort,
-                      facebook::jsi::String::createFromUtf8(runtime, cdpMessageJson)
+                      facebook::jsi::String::createFromUtf8(runtime, fallbackMessageJson)
                     );
                     LOGI("Sending CDP message via JSI TurboModule (direct) / JSI TurboModule을 통해 CDP 메시지 전송 (직접)");
                     return;
@@ -327,7 +256,7 @@ void sendConsoleAPICalled(facebook::jsi::Runtime& runtime,
                     runtime.global(),
                     facebook::jsi::String::createFromUtf8(runtime, serverHost),
                     serverPort,
-                    facebook::jsi::String::createFromUtf8(runtime, cdpMessageJson)
+                    facebook::jsi::String::createFromUtf8(runtime, fallbackMessageJson)
                   );
                   LOGI("Sending CDP message via JSI NativeModules (direct) / JSI NativeModules를 통해 CDP 메시지 전송 (직접)");
                   return;
@@ -13,7 +13,6 @@
 #include <vector>
 #include <string>
 #include "../ConsoleHook.h" // For RemoteObject / RemoteObject를 위해
-#include <folly/dynamic.h>
 
 namespace chrome_remote_devtools {
 namespace console {
@@ -10,12 +10,14 @@
 #include "ConsoleHook.h"
 #include "ConsoleUtils.h"
 #include "ConsoleEventSender.h"
-#include "ConsoleGlobals.h" // For g_objectIdCounter / g_objectIdCounter를 위해
 #include "../ConsoleHook.h" // For RemoteObject / RemoteObject를 위해
+#include "../common/JSIHandleCache.h"
+#include "../common/HookMetrics.h"
+#include "../common/OverheadGovernor.h"
+#include "../common/DomainSubscriptions.h"
+#include "../InspectorHook.h"
+#include <atomic>
 #include <cstring>
-#include <optional>
-
-using chrome_remote_devtools::console::storeObjectInCdpMap;
 
 // Platform-specific log support / 플랫폼별 로그 지원
 #ifdef __ANDROID__
@@ -38,6 +40,38 @@ using chrome_remote_devtools::console::storeObjectInCdpMap;
 namespace chrome_remote_devtools {
 namespace console {
 
+// Console message sequence for object group names / 객체 그룹 이름을 위한 console 메시지 순번
+static std::atomic<uint64_t> g_consoleMessageCounter{1};
+
+// Call the console method the hook replaced / 훅이 대체한 console 메서드 호출
+static facebook::jsi::Value callOriginalConsoleMethod(facebook::jsi::Runtime& rt,
+                                                      common::CachedFunction slot,
+                                                      const char* methodName,
+                                                      const facebook::jsi::Value* args,
+                                                      size_t count) {
+  try {
+    if (const facebook::jsi::Function* originalMethod = common::getCachedFunction(rt, slot)) {
+      return originalMethod->call(rt, args, count);
+    }
+    // Cache gone (e.g. hook reinstalled elsewhere), use backup property / 캐시 없음 (예: 다른 곳에서 훅 재설치), 백업 속성 사용
+    facebook::jsi::Value consoleValue = rt.global().getProperty(rt, "console");
+    if (consoleValue.isObject()) {
+      facebook::jsi::Object consoleObj = consoleValue.asObject(rt);
+      std::string backupPropName = std::string("__original_") + methodName;
+      facebook::jsi::Value originalMethodValue = consoleObj.getProperty(rt, backupPropName.c_str());
+      if (originalMethodValue.isObject() && originalMethodValue.asObject(rt).isFunction(rt)) {
+        auto originalMethod = originalMethodValue.asObject(rt).asFunction(rt);
+        return originalMethod.call(rt, args, count);
+      }
+    }
+  } catch (...) {
+    // Failed to call original, return undefined / 원본 호출 실패, undefined 반환
+  }
+
+  // If no original, return undefined / 원본이 없으면 undefined 반환
+  return facebook::jsi::Value::undefined();
+}
+
 bool hookConsoleMethods(facebook::jsi::Runtime& runtime) {
   try {
     // Check if already hooked by checking for backup property / 백업 속성 확인하여 이미 훅되었는지 확인
@@ -81,16 +115,25 @@ bool hookConsoleMethods(facebook::jsi::Runtime& runtime) {
 
     // Console methods to hook / 훅할 console 메서드들
     const char* methods[] = {"log", "warn", "error", "info", "debug"};
+    constexpr size_t kConsoleMethodCount = sizeof(methods) / sizeof(methods[0]);
+
+    // Original functions are also kept in the per-runtime handle cache / 원본 함수는 런타임별 핸들 캐시에도 보관
+    common::JSIHandleCache& handleCache = common::acquireHandleCache(runtime);
 
     // Backup original methods before replacing / 교체하기 전에 원본 메서드 백업
     // Store them in hidden properties on the console object / console 객체의 숨겨진 속성에 저장
-    for (const char* methodName : methods) {
+    for (size_t methodIndex = 0; methodIndex < kConsoleMethodCount; methodIndex++) {
+      const char* methodName = methods[methodIndex];
+      // methods[] follows CachedFunction::ConsoleLog... order / methods[]는 CachedFunction::ConsoleLog... 순서를 따름
+      auto slot = static_cast<common::CachedFunction>(
+        static_cast<size_t>(common::CachedFunction::ConsoleLog) + methodIndex);
       try {
         // Backup original method if exists / 원본 메서드가 있으면 백업
         if (consoleExists) {
           try {
             facebook::jsi::Value originalMethodValue = originalConsole.getProperty(runtime, methodName);
             if (originalMethodValue.isObject() && originalMethodValue.asObject(runtime).isFunction(runtime)) {
+              handleCache.setFunction(slot, originalMethodValue.asObject(runtime).asFunction(runtime));
               // Store original in a hidden property / 숨겨진 속성에 원본 저장
               std::string backupPropName = std::string("__original_") + methodName;
               originalConsole.setProperty(runtime, backupPropName.c_str(), std::move(originalMethodValue));
@@ -105,125 +148,50 @@ bool hookConsoleMethods(facebook::jsi::Runtime& runtime) {
           runtime,
           facebook::jsi::PropNameID::forAscii(runtime, methodName),
           0, // Variable arguments / 가변 인자
-          [methodName, getLogLevel](facebook::jsi::Runtime& rt,
+          [methodName, slot, getLogLevel](facebook::jsi::Runtime& rt,
                                     const facebook::jsi::Value& /* this */,
                                     const facebook::jsi::Value* args,
                                     size_t count) -> facebook::jsi::Value {
-            // 1. Add __cdpObjectId to objects and store in global Map / 객체에 __cdpObjectId 추가하고 전역 Map에 저장
-            // This allows Runtime.getProperties to find objects later / 이를 통해 Runtime.getProperties가 나중에 객체를 찾을 수 있음
-            LOGI("ConsoleHook: console.%s called with %zu arguments / console.%s가 %zu개의 인자로 호출됨", methodName, count, methodName, count);
-            try {
-              // Get or create __cdpObjects Map in global scope / 전역 스코프에서 __cdpObjects Map 가져오기 또는 생성
-              facebook::jsi::Value global = rt.global();
-              facebook::jsi::Object globalObj = global.asObject(rt);
-              facebook::jsi::Value cdpObjectsValue = globalObj.getProperty(rt, "__cdpObjects");
-              LOGI("ConsoleHook: __cdpObjects value type: %s / __cdpObjects 값 타입: %s",
-                   cdpObjectsValue.isUndefined() ? "undefined" : (cdpObjectsValue.isObject() ? "object" : "other"),
-                   cdpObjectsValue.isUndefined() ? "undefined" : (cdpObjectsValue.isObject() ? "object" : "other"));
-
-              std::optional<facebook::jsi::Object> cdpObjectsMapOpt;
-              bool mapExists = false;
-
-              if (cdpObjectsValue.isUndefined() || !cdpObjectsValue.isObject()) {
-                // Create new Map / 새 Map 생성
-                facebook::jsi::Value mapConstructorValue = globalObj.getProperty(rt, "Map");
-                if (mapConstructorValue.isObject() && mapConstructorValue.asObject(rt).isFunction(rt)) {
-                  facebook::jsi::Function mapConstructor = mapConstructorValue.asObject(rt).asFunction(rt);
-                  // callAsConstructor로 Map 인스턴스 생성 / callAsConstructor로 Map 인스턴스 생성
-                  facebook::jsi::Value mapInstance = mapConstructor.callAsConstructor(rt);
-                  if (mapInstance.isObject()) {
-                    cdpObjectsMapOpt = mapInstance.asObject(rt);
-                    globalObj.setProperty(rt, "__cdpObjects", mapInstance);
-                    mapExists = true;
-                    LOGI("ConsoleHook: Created __cdpObjects Map / __cdpObjects Map 생성");
-                  }
-                }
-              } else {
-                cdpObjectsMapOpt = cdpObjectsValue.asObject(rt);
-                mapExists = true;
-                LOGI("ConsoleHook: Using existing __cdpObjects / 기존 __cdpObjects 사용");
-              }
-
-              // Store objects in the Map / Map에 객체 저장
-              if (mapExists && cdpObjectsMapOpt.has_value()) {
-                for (size_t i = 0; i < count; i++) {
-                  try {
-                    if (args[i].isObject() && !args[i].isNull()) {
-                      auto obj = args[i].asObject(rt);
-                      // Check if object already has __cdpObjectId / 객체에 이미 __cdpObjectId가 있는지 확인
-                      facebook::jsi::Value existingId = obj.getProperty(rt, "__cdpObjectId");
-                      std::string objectIdStr;
-
-                      if (existingId.isUndefined()) {
-                        // Generate unique objectId / 고유한 objectId 생성
-                        size_t objectId = g_objectIdCounter.fetch_add(1);
-                        objectIdStr = std::to_string(objectId);
-                        // Add __cdpObjectId to the object / 객체에 __cdpObjectId 추가
-                        obj.setProperty(rt, "__cdpObjectId",
-                                        facebook::jsi::String::createFromUtf8(rt, objectIdStr));
-                        LOGI("ConsoleHook: Added __cdpObjectId=%s to object", objectIdStr.c_str());
-                      } else if (existingId.isString()) {
-                        objectIdStr = existingId.asString(rt).utf8(rt);
-                        LOGI("ConsoleHook: Object already has __cdpObjectId=%s", objectIdStr.c_str());
-                      } else {
-                        // __cdpObjectId exists but is not a string; skip using it /
-                        // __cdpObjectId가 존재하지만 문자열이 아님; 사용 건너뜀
-                        LOGW("ConsoleHook: __cdpObjectId exists but is not a string; skipping object");
-                        continue;
-                      }
-
-                      // Store object in Map using objectId as key / objectId를 키로 사용하여 Map에 객체 저장
-                      if (storeObjectInCdpMap(rt, objectIdStr, args[i])) {
-                        LOGI("ConsoleHook: Stored object with objectId=%s in __cdpObjects Map", objectIdStr.c_str());
-                      } else {
-                        LOGW("ConsoleHook: Failed to store object with objectId=%s in __cdpObjects Map", objectIdStr.c_str());
-                      }
-                    }
-                  } catch (...) {
-                    LOGW("ConsoleHook: Failed to store object in __cdpObjects Map at index %zu", i);
-                  }
-                }
-              }
-            } catch (...) {
-              // Failed to create or access __cdpObjects Map, continue / __cdpObjects Map 생성 또는 접근 실패, 계속
-            }
-
-            // 2. Convert JSI values to RemoteObjects / JSI 값을 RemoteObject로 변환
-            std::vector<RemoteObject> parsedArgs;
-            for (size_t i = 0; i < count; i++) {
-              parsedArgs.push_back(jsiValueToRemoteObject(rt, args[i]));
+            // No DevTools client has enabled Runtime, Console or Log: straight to the original /
+            // Runtime, Console, Log를 활성화한 DevTools 클라이언트 없음: 바로 원본 호출
+            if (!common::isConsoleCaptureActive()) {
+              return callOriginalConsoleMethod(rt, slot, methodName, args, count);
             }
+            LOGI("ConsoleHook: console.%s called with %zu arguments / console.%s가 %zu개의 인자로 호출됨", methodName, count, methodName, count);
+            common::HookScope hookScope(common::HookSite::ConsoleCall);
+            reportCaptureLevelChange(rt);
 
             int level = getLogLevel(methodName);
 
-            // Map log level to CDP console type / 로그 레벨을 CDP console type으로 매핑
-            std::string cdpType = "log";
-            if (level == 6) cdpType = "error";
-            else if (level == 5) cdpType = "warning";
-            else if (level == 3) cdpType = "debug";
+            // Under load the overhead governor samples or skips messages / 부하 시 오버헤드 거버너가 메시지를 샘플링하거나 건너뜀
+            if (common::admitConsoleMessage(level)) {
+              // 1. Convert JSI values to RemoteObjects / JSI 값을 RemoteObject로 변환
+              // Objects are registered in the native handle table, one object group per message /
+              // 객체는 네이티브 핸들 테이블에 메시지마다 하나의 객체 그룹으로 등록됨
+              std::string objectGroup = std::string(kConsoleObjectGroupPrefix) + ":" +
+                                        std::to_string(g_consoleMessageCounter.fetch_add(1));
+              bool generatePreview = common::shouldGeneratePreviews();
+              std::vector<RemoteObject> parsedArgs;
+              parsedArgs.reserve(count);
+              for (size_t i = 0; i < count; i++) {
+                parsedArgs.push_back(jsiValueToRemoteObject(rt, args[i], generatePreview, objectGroup));
+              }
 
-            // Send console API called event / console API 호출 이벤트 전송
-            sendConsoleAPICalled(rt, cdpType, parsedArgs);
+              // Map log level to CDP console type / 로그 레벨을 CDP console type으로 매핑
+              std::string cdpType = "log";
+              if (level == 6) cdpType = "error";
+              else if (level == 5) cdpType = "warning";
+              else if (level == 3) cdpType = "debug";
 
-            // 2. Call original method if exists / 원본 메서드가 있으면 호출
-            // Get original from backup property on console object / console 객체의 백업 속성에서 원본 가져오기
-            try {
-              facebook::jsi::Value consoleValue = rt.global().getProperty(rt, "console");
-              if (consoleValue.isObject()) {
-                facebook::jsi::Object consoleObj = consoleValue.asObject(rt);
-                std::string backupPropName = std::string("__original_") + methodName;
-                facebook::jsi::Value originalMethodValue = consoleObj.getProperty(rt, backupPropName.c_str());
-                if (originalMethodValue.isObject() && originalMethodValue.asObject(rt).isFunction(rt)) {
-                  auto originalMethod = originalMethodValue.asObject(rt).asFunction(rt);
-                  return originalMethod.call(rt, args, count);
-                }
-              }
-            } catch (...) {
-              // Failed to call original, return undefined / 원본 호출 실패, undefined 반환
+              // Send console API called event / console API 호출 이벤트 전송
+              sendConsoleAPICalled(rt, cdpType, parsedArgs);
             }
 
-            // If no original, return undefined / 원본이 없으면 undefined 반환
-            return facebook::jsi::Value::undefined();
+            // 2. Call original method if exists / 원본 메서드가 있으면 호출
+            // Captured at installation, no console/__original_* lookup per call / 설치 시 캡처되어 호출마다 console/__original_* 조회 없음
+            // The app's own logging is not inspector overhead / 앱 자체 로깅은 인스펙터 오버헤드가 아님
+            common::HookScope::Pause originalCall(hookScope);
+            return callOriginalConsoleMethod(rt, slot, methodName, args, count);
           }
         );
 
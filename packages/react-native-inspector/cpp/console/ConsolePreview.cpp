@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "ConsolePreview.h"
+#include "../common/JSIHandleCache.h"
+#include "../common/JsonWriter.h"
+#include <algorithm>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "ConsolePreview"
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#else
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+namespace console {
+
+// Preview bounds / preview 제한
+static constexpr size_t kMaxPreviewProperties = 100;      // Top-level properties / 최상위 속성 수
+static constexpr size_t kMaxNestedPreviewProperties = 5;  // Properties in nested valuePreview / 중첩 valuePreview의 속성 수
+static constexpr int kMaxPreviewDepth = 2;                // Top level + one nested level / 최상위 + 중첩 한 단계
+static constexpr size_t kMaxPreviewStringLength = 100;    // Abbreviate long strings / 긴 문자열 축약
+
+ObjectDescription describeObject(facebook::jsi::Runtime& runtime, const facebook::jsi::Object& object) {
+  ObjectDescription result;
+  try {
+    if (object.isArray(runtime)) {
+      size_t length = object.getArray(runtime).size(runtime);
+      result.subtype = "array";
+      result.className = "Array";
+      result.description = "Array(" + std::to_string(length) + ")";
+      return result;
+    }
+
+    if (object.isFunction(runtime)) {
+      result.subtype = "function";
+      result.className = "Function";
+      facebook::jsi::Value nameValue = common::getCachedProperty(runtime, object, common::PropName::Name);
+      if (nameValue.isString()) {
+        result.description = "f " + nameValue.getString(runtime).utf8(runtime) + "()";
+      } else {
+        result.description = "f ()";
+      }
+      return result;
+    }
+
+    // Constructor name, e.g. "Object", "Map", "MyClass" / 생성자 이름, 예: "Object", "Map", "MyClass"
+    result.className = "Object";
+    facebook::jsi::Value constructorValue = common::getCachedProperty(runtime, object, common::PropName::Constructor);
+    if (constructorValue.isObject()) {
+      facebook::jsi::Value nameValue = common::getCachedProperty(runtime, constructorValue.getObject(runtime), common::PropName::Name);
+      if (nameValue.isString()) {
+        std::string name = nameValue.getString(runtime).utf8(runtime);
+        if (!name.empty()) {
+          result.className = name;
+        }
+      }
+    }
+    result.description = result.className;
+
+    // Errors: show stack (or "Name: message") like DevTools does / 에러: DevTools처럼 stack(또는 "Name: message") 표시
+    const std::string& className = result.className;
+    if (className.size() >= 5 && className.compare(className.size() - 5, 5, "Error") == 0) {
+      result.subtype = "error";
+      facebook::jsi::Value stackValue = common::getCachedProperty(runtime, object, common::PropName::Stack);
+      if (stackValue.isString()) {
+        result.description = stackValue.getString(runtime).utf8(runtime);
+      } else {
+        facebook::jsi::Value messageValue = common::getCachedProperty(runtime, object, common::PropName::Message);
+        if (messageValue.isString()) {
+          result.description = className + ": " + messageValue.getString(runtime).utf8(runtime);
+        }
+      }
+    }
+  } catch (...) {
+    // Exotic object (throwing getters, proxies) / 특이 객체 (예외를 던지는 getter, proxy)
+    if (result.description.empty()) {
+      result.className = "Object";
+      result.description = "Object";
+    }
+  }
+  return result;
+}
+
+static void writePreview(facebook::jsi::Runtime& runtime,
+                         common::JsonWriter& writer,
+                         const facebook::jsi::Object& object,
+                         const ObjectDescription& description,
+                         int depth);
+
+// Cut text to at most maxBytes without splitting a UTF-8 sequence / UTF-8 시퀀스를 나누지 않고 최대 maxBytes로 자름
+static void truncateUtf8(std::string& text, size_t maxBytes) {
+  size_t cut = maxBytes;
+  // Back up over continuation bytes (10xxxxxx) to the start of the cut character / 연속 바이트(10xxxxxx)를 건너 잘린 문자의 시작으로 이동
+  while (cut > 0 && (static_cast<unsigned char>(text[cut]) & 0xC0) == 0x80) {
+    cut--;
+  }
+  text.resize(cut);
+}
+
+// Write one CDP PropertyPreview / CDP PropertyPreview 하나 작성
+// Everything that can throw is resolved before the first byte is written / 예외가 발생할 수 있는 작업은 첫 바이트 작성 전에 모두 처리
+static void writePropertyPreview(facebook::jsi::Runtime& runtime,
+                                 common::JsonWriter& writer,
+                                 const std::string& name,
+                                 const facebook::jsi::Value& value,
+                                 int depth) {
+  std::string type = "undefined";
+  std::string subtype;
+  std::string text;
+  bool nestedPreview = false;
+  ObjectDescription childDescription;
+
+  if (value.isString()) {
+    type = "string";
+    text = value.getString(runtime).utf8(runtime);
+    if (text.size() > kMaxPreviewStringLength) {
+      truncateUtf8(text, kMaxPreviewStringLength);
+      text += "…";
+    }
+  } else if (value.isNumber()) {
+    type = "number";
+    common::appendNumber(text, value.getNumber());
+  } else if (value.isBool()) {
+    type = "boolean";
+    text = value.getBool() ? "true" : "false";
+  } else if (value.isUndefined()) {
+    text = "undefined";
+  } else if (value.isNull()) {
+    type = "object";
+    subtype = "null";
+    text = "null";
+  } else if (value.isSymbol()) {
+    type = "symbol";
+    text = value.getSymbol(runtime).toString(runtime);
+  } else if (value.isBigInt()) {
+    type = "bigint";
+    text = "BigInt";
+  } else if (value.isObject()) {
+    childDescription = describeObject(runtime, value.getObject(runtime));
+    if (childDescription.subtype == "function") {
+      type = "function";
+    } else {
+      type = "object";
+      subtype = childDescription.subtype;
+      text = childDescription.description;
+      nestedPreview = depth + 1 < kMaxPreviewDepth;
+    }
+  }
+
+  writer.beginObject();
+  writer.field("name", name);
+  writer.field("type", type);
+  if (!subtype.empty()) {
+    writer.field("subtype", subtype);
+  }
+  writer.field("value", text);
+  if (nestedPreview) {
+    writer.key("valuePreview");
+    writePreview(runtime, writer, value.getObject(runtime), childDescription, depth + 1);
+  }
+  writer.endObject();
+}
+
+// Write CDP ObjectPreview for object / 객체의 CDP ObjectPreview 작성
+static void writePreview(facebook::jsi::Runtime& runtime,
+                         common::JsonWriter& writer,
+                         const facebook::jsi::Object& object,
+                         const ObjectDescription& description,
+                         int depth) {
+  size_t maxProperties = depth == 0 ? kMaxPreviewProperties : kMaxNestedPreviewProperties;
+  bool overflow = false;
+
+  writer.beginObject();
+  writer.field("type", "object");
+  if (!description.subtype.empty()) {
+    writer.field("subtype", description.subtype);
+  }
+  writer.field("description", description.description);
+  writer.key("properties");
+  writer.beginArray();
+  try {
+    if (description.subtype == "array") {
+      // Arrays: read indices directly, no name list needed / 배열: 이름 목록 없이 인덱스를 직접 읽음
+      facebook::jsi::Array array = object.getArray(runtime);
+      size_t length = array.size(runtime);
+      size_t count = std::min(length, maxProperties);
+      for (size_t i = 0; i < count; i++) {
+        try {
+          writePropertyPreview(runtime, writer, std::to_string(i), array.getValueAtIndex(runtime, i), depth);
+        } catch (...) {
+          // Skip unreadable element / 읽을 수 없는 요소 건너뜀
+        }
+      }
+      overflow = length > count;
+    } else {
+      facebook::jsi::Array names = object.getPropertyNames(runtime);
+      size_t nameCount = names.size(runtime);
+      size_t written = 0;
+      for (size_t i = 0; i < nameCount; i++) {
+        if (written >= maxProperties) {
+          overflow = true;
+          break;
+        }
+        try {
+          facebook::jsi::Value nameValue = names.getValueAtIndex(runtime, i);
+          if (!nameValue.isString()) {
+            continue;
+          }
+          facebook::jsi::String nameString = nameValue.getString(runtime);
+          std::string name = nameString.utf8(runtime);
+          writePropertyPreview(runtime, writer, name, object.getProperty(runtime, nameString), depth);
+          written++;
+        } catch (...) {
+          // Throwing getter, skip property / 예외를 던지는 getter, 속성 건너뜀
+        }
+      }
+    }
+  } catch (...) {
+    LOGW("ConsolePreview: Failed to walk object properties / 객체 속성 순회 실패");
+  }
+  writer.endArray();
+  writer.field("overflow", overflow);
+  writer.endObject();
+}
+
+std::string buildObjectPreview(facebook::jsi::Runtime& runtime,
+                               const facebook::jsi::Object& object,
+                               const ObjectDescription& description) {
+  std::string preview;
+  common::JsonWriter writer(preview);
+  writePreview(runtime, writer, object, description, 0);
+  return preview;
+}
+
+} // namespace console
+} // namespace chrome_remote_devtools
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <string>
+
+namespace chrome_remote_devtools {
+namespace console {
+
+// Object description for CDP RemoteObject / CDP RemoteObject를 위한 객체 설명
+struct ObjectDescription {
+  std::string subtype;      // "array", "error", "function" or empty / "array", "error", "function" 또는 빈 문자열
+  std::string className;    // Constructor name / 생성자 이름
+  std::string description;  // e.g. "Object", "Array(3)", "f name()" / 예: "Object", "Array(3)", "f name()"
+};
+
+// Describe object without serializing it / 객체를 직렬화하지 않고 설명
+ObjectDescription describeObject(facebook::jsi::Runtime& runtime, const facebook::jsi::Object& object);
+
+// Build serialized CDP ObjectPreview by walking properties through JSI / JSI로 속성을 순회하여 직렬화된 CDP ObjectPreview 생성
+// Walk is bounded in depth and breadth, so cost does not grow with the object size /
+// 순회는 깊이와 너비가 제한되므로 비용이 객체 크기에 따라 증가하지 않음
+std::string buildObjectPreview(facebook::jsi::Runtime& runtime,
+                               const facebook::jsi::Object& object,
+                               const ObjectDescription& description);
+
+} // namespace console
+} // namespace chrome_remote_devtools
@@ -15,7 +15,7 @@
 namespace chrome_remote_devtools {
 namespace console {
 
-// Find object by __cdpObjectId in runtime / 런타임에서 __cdpObjectId로 객체 찾기
+// Find object by objectId in native handle table / 네이티브 핸들 테이블에서 objectId로 객체 찾기
 facebook::jsi::Value findObjectById(facebook::jsi::Runtime& runtime, const std::string& objectId);
 
 // Get object properties for Runtime.getProperties / Runtime.getProperties를 위한 객체 속성 가져오기
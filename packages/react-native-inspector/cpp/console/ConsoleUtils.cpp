@@ -8,7 +8,9 @@
  */
 
 #include "ConsoleUtils.h"
-#include "ConsoleGlobals.h"
+#include "ConsolePreview.h"
+#include "ObjectHandleTable.h"
+#include "../common/HookMetrics.h"
 
 // Platform-specific log support / 플랫폼별 로그 지원
 #ifdef __ANDROID__
@@ -24,47 +26,15 @@
 namespace chrome_remote_devtools {
 namespace console {
 
-// Store object in __cdpObjects Map / __cdpObjects Map에 객체 저장
-bool storeObjectInCdpMap(facebook::jsi::Runtime& runtime, const std::string& objectIdStr, const facebook::jsi::Value& value) {
-  try {
-    auto globalObj = runtime.global();
-    // Check if Map exists immediately before use to avoid race conditions /
-    // race condition을 피하기 위해 사용 직전에 Map 존재 여부 확인
-    facebook::jsi::Value cdpObjectsValue = globalObj.getProperty(runtime, "__cdpObjects");
-    if (cdpObjectsValue.isUndefined() || !cdpObjectsValue.isObject()) {
-      // Create new Map if doesn't exist / 없으면 새 Map 생성
-      facebook::jsi::Value mapConstructorValue = globalObj.getProperty(runtime, "Map");
-      if (mapConstructorValue.isObject() && mapConstructorValue.asObject(runtime).isFunction(runtime)) {
-        facebook::jsi::Function mapConstructor = mapConstructorValue.asObject(runtime).asFunction(runtime);
-        facebook::jsi::Value mapInstance = mapConstructor.callAsConstructor(runtime);
-        if (mapInstance.isObject()) {
-          globalObj.setProperty(runtime, "__cdpObjects", mapInstance);
-          // Get the newly created Map / 새로 생성된 Map 가져오기
-          cdpObjectsValue = globalObj.getProperty(runtime, "__cdpObjects");
-        }
-      }
-    }
-
-    if (cdpObjectsValue.isObject()) {
-      facebook::jsi::Object cdpObjectsMap = cdpObjectsValue.asObject(runtime);
-      facebook::jsi::Value setMethod = cdpObjectsMap.getProperty(runtime, "set");
-      if (setMethod.isObject() && setMethod.asObject(runtime).isFunction(runtime)) {
-        facebook::jsi::Function setFunc = setMethod.asObject(runtime).asFunction(runtime);
-        setFunc.callWithThis(runtime, cdpObjectsMap,
-                             facebook::jsi::String::createFromUtf8(runtime, objectIdStr),
-                             value);
-        return true;
-      }
-    }
-    return false;
-  } catch (...) {
-    LOGW("ConsoleUtils: Failed to store object with id %s in __cdpObjects Map", objectIdStr.c_str());
-    return false;
-  }
-}
-
 // Convert JSI value to RemoteObject / JSI 값을 RemoteObject로 변환
-RemoteObject jsiValueToRemoteObject(facebook::jsi::Runtime& runtime, const facebook::jsi::Value& value) {
+// Fixed per-object estimate (handle, table entry, JS object header) / 객체당 고정 추정치 (핸들, 테이블 항목, JS 객체 헤더)
+static constexpr size_t kRetainedObjectOverheadBytes = 128;
+
+RemoteObject jsiValueToRemoteObject(facebook::jsi::Runtime& runtime,
+                                    const facebook::jsi::Value& value,
+                                    bool generatePreview,
+                                    const std::string& objectGroup) {
+  common::HookScope hookScope(common::HookSite::RemoteObject);
   RemoteObject result;
   try {
     if (value.isString()) {
@@ -85,102 +55,31 @@ RemoteObject jsiValueToRemoteObject(facebook::jsi::Runtime& runtime, const faceb
     } else if (value.isObject()) {
       result.type = "object";
       // For objects, do NOT set value field / 객체의 경우 value 필드를 설정하지 않음
-      // Only set description with JSON stringified value / description에만 JSON 문자열화된 값을 설정
-      // This allows DevTools to display it as an object, not a string / 이를 통해 DevTools가 문자열이 아닌 객체로 표시할 수 있음
+      // DevTools renders objects from description + preview / DevTools는 description + preview로 객체를 표시
 
-      // Always generate objectId for objects and store in Map (like web CDP client) / 객체에 대해 항상 objectId 생성하고 Map에 저장 (웹 CDP 클라이언트처럼)
+      // Describe and preview natively, without serializing the whole object /
+      // 전체 객체를 직렬화하지 않고 네이티브로 설명 및 미리보기 생성
       try {
         auto obj = value.asObject(runtime);
-        facebook::jsi::Value cdpIdValue = obj.getProperty(runtime, "__cdpObjectId");
-        std::string objectIdStr;
-
-        if (cdpIdValue.isString()) {
-          // Use existing objectId / 기존 objectId 사용
-          objectIdStr = cdpIdValue.asString(runtime).utf8(runtime);
-          result.objectId = objectIdStr;
-        } else {
-          // Generate new objectId / 새 objectId 생성
-          size_t objectId = console::g_objectIdCounter.fetch_add(1);
-          objectIdStr = std::to_string(objectId);
-
-          // Add __cdpObjectId to object / 객체에 __cdpObjectId 추가
-          obj.setProperty(runtime, "__cdpObjectId",
-                          facebook::jsi::String::createFromUtf8(runtime, objectIdStr));
-
-          // Store in __cdpObjects Map / __cdpObjects Map에 저장
-          storeObjectInCdpMap(runtime, objectIdStr, value);
-
-          result.objectId = objectIdStr;
+        ObjectDescription objectDescription = describeObject(runtime, obj);
+        result.subtype = objectDescription.subtype;
+        result.className = objectDescription.className;
+        result.description = objectDescription.description;
+        if (generatePreview && objectDescription.subtype != "function") {
+          result.preview = buildObjectPreview(runtime, obj, objectDescription);
         }
       } catch (...) {
-        LOGW("ConsoleUtils: Failed to process __cdpObjectId in jsiValueToRemoteObject");
+        result.description = "Object";
       }
 
-      // Try to stringify object using JSON.stringify / JSON.stringify를 사용하여 객체 문자열화 시도
+      // Retain in native handle table; the object itself is not modified /
+      // 네이티브 핸들 테이블에 보유, 객체 자체는 수정하지 않음
+      // Retained size is approximated by what we serialized for it / 보유 크기는 직렬화한 내용으로 근사
       try {
-        auto jsonObj = runtime.global().getPropertyAsObject(runtime, "JSON");
-        auto jsonStringify = jsonObj.getPropertyAsFunction(runtime, "stringify");
-        auto jsonValue = jsonStringify.call(runtime, value);
-        if (jsonValue.isString()) {
-          result.description = jsonValue.asString(runtime).utf8(runtime);
-        }
-      } catch (...) {
-        // JSON.stringify failed, use default / JSON.stringify 실패, 기본값 사용
-        result.description = "[object Object]";
-      }
-
-      // Check if it's an array / 배열인지 확인
-      try {
-        auto obj = value.asObject(runtime);
-        if (obj.isArray(runtime)) {
-          result.subtype = "array";
-          // Try to get array length / 배열 길이 가져오기 시도
-          try {
-            auto lengthProp = obj.getProperty(runtime, "length");
-            if (lengthProp.isNumber()) {
-              int length = static_cast<int>(lengthProp.asNumber());
-              if (result.description.empty()) {
-                result.description = "Array(" + std::to_string(length) + ")";
-              }
-            }
-          } catch (...) {
-            // Failed to get length / 길이 가져오기 실패
-          }
-        } else if (obj.isFunction(runtime)) {
-          result.subtype = "function";
-          // Try to get function name / 함수 이름 가져오기 시도
-          try {
-            auto nameProp = obj.getProperty(runtime, "name");
-            if (nameProp.isString()) {
-              result.description = "f " + nameProp.asString(runtime).utf8(runtime) + "()";
-            } else {
-              result.description = "f ()";
-            }
-          } catch (...) {
-            result.description = "f ()";
-          }
-        } else {
-          // Generic object / 일반 객체
-          // Try to get constructor name / 생성자 이름 가져오기 시도
-          try {
-            auto constructorValue = obj.getProperty(runtime, "constructor");
-            if (constructorValue.isObject()) {
-              auto constructorObj = constructorValue.asObject(runtime);
-              auto nameValue = constructorObj.getProperty(runtime, "name");
-              if (nameValue.isString()) {
-                std::string name = nameValue.asString(runtime).utf8(runtime);
-                if (name != "Object") {
-                  // Custom constructor / 커스텀 생성자
-                  // Keep JSON stringified description for better preview / 더 나은 미리보기를 위해 JSON 문자열화된 description 유지
-                }
-              }
-            }
-          } catch (...) {
-            // Ignore / 무시
-          }
-        }
+        size_t approxBytes = kRetainedObjectOverheadBytes + result.preview.size() + result.description.size();
+        result.objectId = registerObject(runtime, value.getObject(runtime), objectGroup, approxBytes);
       } catch (...) {
-        // Not an array or function / 배열이나 함수가 아님
+        LOGW("ConsoleUtils: Failed to register object in jsiValueToRemoteObject");
       }
     }
   } catch (...) {
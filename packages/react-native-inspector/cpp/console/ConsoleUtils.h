@@ -11,16 +11,19 @@
 
 #include <jsi/jsi.h>
 #include "../ConsoleHook.h" // For RemoteObject / RemoteObject를 위해
+#include "ObjectHandleTable.h"
+#include <string>
 
 namespace chrome_remote_devtools {
 namespace console {
 
 // Convert JSI value to RemoteObject / JSI 값을 RemoteObject로 변환
-RemoteObject jsiValueToRemoteObject(facebook::jsi::Runtime& runtime, const facebook::jsi::Value& value);
-
-// Store object in __cdpObjects Map / __cdpObjects Map에 객체 저장
-// Returns true if successful, false otherwise / 성공하면 true, 실패하면 false 반환
-bool storeObjectInCdpMap(facebook::jsi::Runtime& runtime, const std::string& objectIdStr, const facebook::jsi::Value& value);
+// generatePreview: build bounded ObjectPreview for objects / generatePreview: 객체에 대해 제한된 ObjectPreview 생성
+// objectGroup: group objects are retained in until released / objectGroup: 해제될 때까지 객체가 보유되는 그룹
+RemoteObject jsiValueToRemoteObject(facebook::jsi::Runtime& runtime,
+                                    const facebook::jsi::Value& value,
+                                    bool generatePreview = true,
+                                    const std::string& objectGroup = kConsoleObjectGroupPrefix);
 
 } // namespace console
 } // namespace chrome_remote_devtools
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "ObjectHandleTable.h"
+#include "ConsoleGlobals.h"
+#include "../common/JSIHandleCache.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "ObjectHandleTable"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "ObjectHandleTable"
+#define LOGI(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+namespace console {
+
+// Raw pointer on purpose: a table of a reloaded runtime must never be destroyed /
+// 의도적으로 raw 포인터 사용: 리로드된 런타임의 테이블은 절대 파괴되면 안 됨
+static ObjectHandleTable* g_objectTable = nullptr;
+
+// Budget may be set from any thread / 예산은 모든 스레드에서 설정 가능
+static std::atomic<size_t> g_maxRetainedObjects{ObjectRetentionBudget().maxObjects};
+static std::atomic<size_t> g_maxRetainedBytes{ObjectRetentionBudget().maxBytes};
+
+uint64_t ObjectHandleTable::add(facebook::jsi::Object object, const std::string& group, size_t approxBytes) {
+  // Ids stay unique across tables so stale DevTools ids never hit a new object /
+  // 오래된 DevTools id가 새 객체를 가리키지 않도록 id는 테이블 간에도 고유함
+  uint64_t id = g_objectIdCounter.fetch_add(1);
+  lru_.push_front(id);
+  entries_.emplace(id, Entry{std::move(object), group, approxBytes, lru_.begin()});
+  groups_[group].push_back(id);
+  retainedBytes_ += approxBytes;
+  return id;
+}
+
+const facebook::jsi::Object* ObjectHandleTable::find(uint64_t id) {
+  auto it = entries_.find(id);
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  // Expanded objects are kept over untouched ones / 펼친 객체는 손대지 않은 객체보다 오래 유지
+  lru_.splice(lru_.begin(), lru_, it->second.lruPosition);
+  return &it->second.object;
+}
+
+const std::string* ObjectHandleTable::groupOf(uint64_t id) const {
+  auto it = entries_.find(id);
+  return it != entries_.end() ? &it->second.group : nullptr;
+}
+
+void ObjectHandleTable::erase(std::unordered_map<uint64_t, Entry>::iterator it) {
+  uint64_t id = it->first;
+  Entry& entry = it->second;
+  auto group = groups_.find(entry.group);
+  if (group != groups_.end()) {
+    auto& ids = group->second;
+    ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+    if (ids.empty()) {
+      groups_.erase(group);
+    }
+  }
+  lru_.erase(entry.lruPosition);
+  retainedBytes_ -= entry.bytes;
+  entries_.erase(it);
+}
+
+bool ObjectHandleTable::release(uint64_t id) {
+  auto it = entries_.find(id);
+  if (it == entries_.end()) {
+    return false;
+  }
+  erase(it);
+  return true;
+}
+
+size_t ObjectHandleTable::releaseGroup(const std::string& group) {
+  auto groupIt = groups_.find(group);
+  if (groupIt == groups_.end()) {
+    return 0;
+  }
+  std::vector<uint64_t> ids = std::move(groupIt->second);
+  groups_.erase(groupIt);
+  size_t released = 0;
+  for (uint64_t id : ids) {
+    auto it = entries_.find(id);
+    if (it != entries_.end()) {
+      lru_.erase(it->second.lruPosition);
+      retainedBytes_ -= it->second.bytes;
+      entries_.erase(it);
+      released++;
+    }
+  }
+  return released;
+}
+
+size_t ObjectHandleTable::releaseGroupsWithPrefix(const std::string& prefix) {
+  std::vector<std::string> matching;
+  for (const auto& group : groups_) {
+    if (group.first.compare(0, prefix.size(), prefix) == 0) {
+      matching.push_back(group.first);
+    }
+  }
+  size_t released = 0;
+  for (const auto& group : matching) {
+    released += releaseGroup(group);
+  }
+  return released;
+}
+
+void ObjectHandleTable::enforceBudget(const ObjectRetentionBudget& budget) {
+  // The most recent object is always kept so its objectId stays valid / 가장 최근 객체는 objectId가 유효하도록 항상 유지
+  while (lru_.size() > 1 && (entries_.size() > budget.maxObjects || retainedBytes_ > budget.maxBytes)) {
+    auto it = entries_.find(lru_.back());
+    if (it == entries_.end()) {
+      lru_.pop_back();
+      continue;
+    }
+    erase(it);
+  }
+}
+
+void ObjectHandleTable::clear() {
+  entries_.clear();
+  lru_.clear();
+  groups_.clear();
+  retainedBytes_ = 0;
+}
+
+// Table of runtime's current hook generation / 런타임의 현재 훅 세대 테이블
+// create=false only returns an existing table / create=false이면 기존 테이블만 반환
+static ObjectHandleTable* getObjectTable(facebook::jsi::Runtime& runtime, bool create) {
+  common::JSIHandleCache* handleCache = common::getHandleCache(runtime);
+  if (handleCache == nullptr) {
+    return nullptr;
+  }
+  if (g_objectTable != nullptr && g_objectTable->generation() == handleCache->generation()) {
+    return g_objectTable;
+  }
+  if (!create) {
+    return nullptr;
+  }
+  if (g_objectTable != nullptr) {
+    // Belongs to a previous runtime, its handles cannot be released safely /
+    // 이전 런타임에 속하므로 핸들을 안전하게 해제할 수 없음
+    LOGW("ObjectHandleTable: Abandoning table of previous runtime / 이전 런타임의 테이블 폐기");
+  }
+  g_objectTable = new ObjectHandleTable(handleCache->generation());
+  return g_objectTable;
+}
+
+// Parse numeric objectId / 숫자 objectId 파싱
+static bool parseObjectId(const std::string& objectId, uint64_t& id) {
+  if (objectId.empty()) {
+    return false;
+  }
+  char* end = nullptr;
+  errno = 0;
+  unsigned long long parsed = std::strtoull(objectId.c_str(), &end, 10);
+  if (errno != 0 || end == nullptr || *end != '\0') {
+    return false;
+  }
+  id = static_cast<uint64_t>(parsed);
+  return true;
+}
+
+std::string registerObject(facebook::jsi::Runtime& runtime,
+                           const facebook::jsi::Object& object,
+                           const std::string& group,
+                           size_t approxBytes) {
+  ObjectHandleTable* table = getObjectTable(runtime, true);
+  if (table == nullptr) {
+    return std::string();
+  }
+  // Value round trip clones the handle / Value 왕복으로 핸들 복제
+  facebook::jsi::Object retained = facebook::jsi::Value(runtime, object).getObject(runtime);
+  uint64_t id = table->add(std::move(retained), group, approxBytes);
+  table->enforceBudget(getObjectRetentionBudget());
+  return std::to_string(id);
+}
+
+facebook::jsi::Value lookupObject(facebook::jsi::Runtime& runtime, const std::string& objectId) {
+  uint64_t id = 0;
+  if (!parseObjectId(objectId, id)) {
+    return facebook::jsi::Value::undefined();
+  }
+  ObjectHandleTable* table = getObjectTable(runtime, false);
+  if (table == nullptr) {
+    return facebook::jsi::Value::undefined();
+  }
+  const facebook::jsi::Object* object = table->find(id);
+  if (object == nullptr) {
+    return facebook::jsi::Value::undefined();
+  }
+  return facebook::jsi::Value(runtime, *object);
+}
+
+std::string lookupObjectGroup(facebook::jsi::Runtime& runtime, const std::string& objectId) {
+  uint64_t id = 0;
+  ObjectHandleTable* table = getObjectTable(runtime, false);
+  if (table == nullptr || !parseObjectId(objectId, id)) {
+    return std::string();
+  }
+  const std::string* group = table->groupOf(id);
+  return group != nullptr ? *group : std::string();
+}
+
+void releaseObject(facebook::jsi::Runtime& runtime, const std::string& objectId) {
+  uint64_t id = 0;
+  ObjectHandleTable* table = getObjectTable(runtime, false);
+  if (table != nullptr && parseObjectId(objectId, id)) {
+    table->release(id);
+  }
+}
+
+void releaseObjectGroup(facebook::jsi::Runtime& runtime, const std::string& group) {
+  ObjectHandleTable* table = getObjectTable(runtime, false);
+  if (table == nullptr) {
+    return;
+  }
+  size_t released = table->releaseGroup(group);
+  if (group == kConsoleObjectGroupPrefix) {
+    // Only per-message groups, not unrelated groups such as "consoleFoo" / "consoleFoo" 같은 무관한 그룹이 아닌 메시지별 그룹만
+    released += table->releaseGroupsWithPrefix(group + ":");
+  }
+  LOGI("ObjectHandleTable: Released %zu objects of group %s / 그룹 %s의 객체 %zu개 해제",
+       released, group.c_str(), group.c_str(), released);
+  (void)released;  // Only used for logging / 로그에만 사용
+}
+
+void discardConsoleEntries(facebook::jsi::Runtime& runtime) {
+  releaseObjectGroup(runtime, kConsoleObjectGroupPrefix);
+}
+
+void setObjectRetentionBudget(const ObjectRetentionBudget& budget) {
+  g_maxRetainedObjects.store(budget.maxObjects);
+  g_maxRetainedBytes.store(budget.maxBytes);
+}
+
+ObjectRetentionBudget getObjectRetentionBudget() {
+  ObjectRetentionBudget budget;
+  budget.maxObjects = g_maxRetainedObjects.load();
+  budget.maxBytes = g_maxRetainedBytes.load();
+  return budget;
+}
+
+size_t retainedObjectCount(facebook::jsi::Runtime& runtime) {
+  ObjectHandleTable* table = getObjectTable(runtime, false);
+  return table != nullptr ? table->size() : 0;
+}
+
+void clearObjectTable(facebook::jsi::Runtime& runtime) {
+  ObjectHandleTable* table = getObjectTable(runtime, false);
+  if (table == nullptr) {
+    return;
+  }
+  LOGI("ObjectHandleTable: Releasing %zu objects / %zu개 객체 해제", table->size(), table->size());
+  delete table;
+  g_objectTable = nullptr;
+}
+
+} // namespace console
+} // namespace chrome_remote_devtools
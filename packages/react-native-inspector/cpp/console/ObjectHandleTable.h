@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace chrome_remote_devtools {
+namespace console {
+
+// Object group of console messages; each message gets "console:<n>" and "console" releases them all /
+// console 메시지의 객체 그룹, 메시지마다 "console:<n>"을 사용하며 "console"은 모두 해제
+constexpr const char* kConsoleObjectGroupPrefix = "console";
+
+// Retention budget for inspectable objects / 검사 가능 객체의 보유 예산
+struct ObjectRetentionBudget {
+  size_t maxObjects = 5000;              // Retained object count / 보유 객체 수
+  size_t maxBytes = 8 * 1024 * 1024;     // Approximate retained bytes / 대략적인 보유 바이트
+};
+
+// Native table of inspectable objects, keyed by objectId / objectId로 조회하는 검사 가능 객체의 네이티브 테이블
+// User objects are never modified (no hidden class transitions). JS thread only /
+// 사용자 객체는 수정되지 않음 (hidden class 전환 없음). JS 스레드 전용
+// Least recently used objects are evicted once the budget is exceeded / 예산을 초과하면 가장 오래 사용되지 않은 객체부터 제거
+class ObjectHandleTable {
+public:
+  explicit ObjectHandleTable(uint64_t generation) : generation_(generation) {}
+
+  // Handle cache generation this table belongs to / 이 테이블이 속한 핸들 캐시 세대
+  uint64_t generation() const { return generation_; }
+
+  // Retain object in group, return its new id / 그룹에 객체를 보유하고 새 id 반환
+  uint64_t add(facebook::jsi::Object object, const std::string& group, size_t approxBytes);
+
+  // Retained object (marked as recently used), or nullptr / 보유 중인 객체 (최근 사용으로 표시), 없으면 nullptr
+  const facebook::jsi::Object* find(uint64_t id);
+
+  // Group of retained object, or nullptr / 보유 중인 객체의 그룹, 없으면 nullptr
+  const std::string* groupOf(uint64_t id) const;
+
+  bool release(uint64_t id);
+  size_t releaseGroup(const std::string& group);
+  // Release every group starting with prefix / prefix로 시작하는 모든 그룹 해제
+  size_t releaseGroupsWithPrefix(const std::string& prefix);
+
+  // Evict least recently used objects until within budget / 예산 이내가 될 때까지 가장 오래 사용되지 않은 객체 제거
+  void enforceBudget(const ObjectRetentionBudget& budget);
+
+  void clear();
+  size_t size() const { return entries_.size(); }
+  size_t retainedBytes() const { return retainedBytes_; }
+
+private:
+  struct Entry {
+    facebook::jsi::Object object;
+    std::string group;
+    size_t bytes;
+    std::list<uint64_t>::iterator lruPosition;
+  };
+
+  void erase(std::unordered_map<uint64_t, Entry>::iterator it);
+
+  uint64_t generation_;
+  std::unordered_map<uint64_t, Entry> entries_;
+  std::list<uint64_t> lru_;  // Front is most recently used / 앞쪽이 가장 최근 사용
+  std::unordered_map<std::string, std::vector<uint64_t>> groups_;
+  size_t retainedBytes_ = 0;
+};
+
+// Retain object for Runtime.getProperties, return objectId (empty if hooks are not installed) /
+// Runtime.getProperties를 위해 객체를 보유하고 objectId 반환 (훅이 설치되지 않았으면 빈 문자열)
+std::string registerObject(facebook::jsi::Runtime& runtime,
+                           const facebook::jsi::Object& object,
+                           const std::string& group,
+                           size_t approxBytes);
+
+// Object for objectId, or undefined / objectId의 객체, 없으면 undefined
+facebook::jsi::Value lookupObject(facebook::jsi::Runtime& runtime, const std::string& objectId);
+
+// Group of objectId, or empty / objectId의 그룹, 없으면 빈 문자열
+std::string lookupObjectGroup(facebook::jsi::Runtime& runtime, const std::string& objectId);
+
+// Runtime.releaseObject / Runtime.releaseObjectGroup / Runtime.discardConsoleEntries
+void releaseObject(facebook::jsi::Runtime& runtime, const std::string& objectId);
+void releaseObjectGroup(facebook::jsi::Runtime& runtime, const std::string& group);
+void discardConsoleEntries(facebook::jsi::Runtime& runtime);
+
+// Retention budget, applied on the next registration (any thread) / 보유 예산, 다음 등록 시 적용 (모든 스레드)
+void setObjectRetentionBudget(const ObjectRetentionBudget& budget);
+ObjectRetentionBudget getObjectRetentionBudget();
+
+// Number of objects retained for the inspector / 인스펙터를 위해 보유 중인 객체 수
+size_t retainedObjectCount(facebook::jsi::Runtime& runtime);
+
+// Release all retained objects while the runtime is alive / 런타임이 살아 있는 동안 보유 중인 모든 객체 해제
+void clearObjectTable(facebook::jsi::Runtime& runtime);
+
+} // namespace console
+} // namespace chrome_remote_devtools
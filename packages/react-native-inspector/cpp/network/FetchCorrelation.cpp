@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "FetchCorrelation.h"
+#include <algorithm>
+#include <cctype>
+
+namespace chrome_remote_devtools {
+namespace network {
+
+// Method is upper-cased like the fetch polyfill does / fetch polyfill처럼 method를 대문자로 변환
+static std::string makeKey(const std::string& method, const std::string& url) {
+  std::string key;
+  key.reserve(method.size() + url.size() + 1);
+  for (char c : method) {
+    key.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
+  }
+  key.push_back(' ');
+  key.append(url);
+  return key;
+}
+
+// whatwg-fetch adds "_=<timestamp>" to GET/HEAD URLs for cache: 'no-store' / 'no-cache'. It replaces the value of
+// the first "?_=" or "&_=" parameter, or appends one when there is none /
+// whatwg-fetch는 cache: 'no-store' / 'no-cache'인 GET/HEAD URL에 "_=<timestamp>"를 추가함. 첫 번째 "?_=" 또는 "&_="
+// 파라미터의 값을 바꾸고, 없으면 하나를 끝에 추가함
+static size_t findCacheBuster(const std::string& url) {
+  for (size_t pos = url.find_first_of("?&"); pos != std::string::npos; pos = url.find_first_of("?&", pos + 1)) {
+    if (url.compare(pos + 1, 2, "_=") == 0) {
+      return pos;
+    }
+  }
+  return std::string::npos;
+}
+
+// URL with the value of the cache buster at pos left out / pos의 캐시 버스터 값을 제외한 URL
+static std::string withoutCacheBusterValue(const std::string& url, size_t pos) {
+  size_t valueStart = pos + 3;
+  size_t valueEnd = url.find('&', valueStart);
+  if (valueEnd == std::string::npos) {
+    return url.substr(0, valueStart);
+  }
+  return url.substr(0, valueStart) + url.substr(valueEnd);
+}
+
+// The URL the polyfill would open for url, with the timestamp left out / polyfill이 url에 대해 열 URL, 타임스탬프 제외
+static std::string cacheBustedUrl(const std::string& url) {
+  size_t pos = findCacheBuster(url);
+  if (pos != std::string::npos) {
+    return withoutCacheBusterValue(url, pos);
+  }
+  return url + (url.find('?') != std::string::npos ? "&_=" : "?_=");
+}
+
+uint64_t FetchCorrelationRegistry::push(const std::string& method, const std::string& url, const std::string& requestId,
+                                        int64_t requestTime) {
+  uint64_t token = nextToken_++;
+  PendingFetch fetch{requestId, requestTime, makeKey(method, url), makeKey(method, cacheBustedUrl(url))};
+  byKey_[fetch.key].push_back(token);
+  byCacheBustedKey_[fetch.cacheBustedKey].push_back(token);
+  fetches_.emplace(token, std::move(fetch));
+  order_.push_back(token);
+
+  // Fetches whose XHR never opened are dropped oldest first / XHR이 열리지 않은 fetch는 가장 오래된 것부터 삭제
+  while (fetches_.size() > kMaxPending && !order_.empty()) {
+    uint64_t oldest = order_.front();
+    order_.pop_front();
+    cancel(oldest);
+  }
+  // Claimed tokens stay in order_ until compacted / 가져간 토큰은 정리될 때까지 order_에 남음
+  if (order_.size() > kMaxPending * 2) {
+    order_.erase(std::remove_if(order_.begin(), order_.end(),
+                                [this](uint64_t t) { return fetches_.find(t) == fetches_.end(); }),
+                 order_.end());
+  }
+  return token;
+}
+
+bool FetchCorrelationRegistry::claim(const std::string& method, const std::string& url, std::string& requestId,
+                                     int64_t& requestTime) {
+  if (fetches_.empty()) {
+    return false;
+  }
+  if (claimFrom(byKey_, makeKey(method, url), requestId, requestTime)) {
+    return true;
+  }
+  // The XHR URL carries the polyfill's cache buster as its first "_=" parameter / XHR URL의 첫 "_=" 파라미터가 polyfill의 캐시 버스터임
+  size_t pos = findCacheBuster(url);
+  return pos != std::string::npos &&
+         claimFrom(byCacheBustedKey_, makeKey(method, withoutCacheBusterValue(url, pos)), requestId, requestTime);
+}
+
+bool FetchCorrelationRegistry::claimFrom(TokenIndex& index, const std::string& key, std::string& requestId,
+                                         int64_t& requestTime) {
+  auto it = index.find(key);
+  if (it == index.end() || it->second.empty()) {
+    return false;
+  }
+  uint64_t token = it->second.front();
+  auto fetchIt = fetches_.find(token);
+  if (fetchIt == fetches_.end()) {
+    return false;
+  }
+  requestId = std::move(fetchIt->second.requestId);
+  requestTime = fetchIt->second.requestTime;
+  erase(token);
+  return true;
+}
+
+void FetchCorrelationRegistry::cancel(uint64_t token) {
+  erase(token);
+}
+
+void FetchCorrelationRegistry::erase(uint64_t token) {
+  auto it = fetches_.find(token);
+  if (it == fetches_.end()) {
+    return;
+  }
+  removeToken(byKey_, it->second.key, token);
+  removeToken(byCacheBustedKey_, it->second.cacheBustedKey, token);
+  fetches_.erase(it);
+}
+
+void FetchCorrelationRegistry::removeToken(TokenIndex& index, const std::string& key, uint64_t token) {
+  auto it = index.find(key);
+  if (it == index.end()) {
+    return;
+  }
+  auto& tokens = it->second;
+  tokens.erase(std::remove(tokens.begin(), tokens.end(), token), tokens.end());
+  if (tokens.empty()) {
+    index.erase(it);
+  }
+}
+
+void FetchCorrelationRegistry::clear() {
+  fetches_.clear();
+  byKey_.clear();
+  byCacheBustedKey_.clear();
+  order_.clear();
+}
+
+} // namespace network
+} // namespace chrome_remote_devtools
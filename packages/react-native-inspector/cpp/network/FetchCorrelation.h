@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+namespace chrome_remote_devtools {
+namespace network {
+
+// Correlates fetch() calls with the XMLHttpRequest the fetch polyfill opens for them /
+// fetch() 호출과 fetch polyfill이 이를 위해 여는 XMLHttpRequest를 연결
+// Every fetch pushes a pending context keyed by method + URL, and XHR open claims the oldest one with
+// the same key, so overlapping fetches are never mixed up / 각 fetch는 method + URL을 키로 대기 컨텍스트를
+// 추가하고, XHR open은 같은 키의 가장 오래된 컨텍스트를 가져가므로 겹치는 fetch가 섞이지 않음
+// Each context is also keyed by the URL the polyfill produces when it adds its "_=<timestamp>" cache buster,
+// with the timestamp left out, so only that exact parameter is ignored /
+// 각 컨텍스트는 polyfill이 "_=<timestamp>" 캐시 버스터를 추가했을 때의 URL(타임스탬프 제외)로도 조회되므로
+// 정확히 그 파라미터만 무시됨
+// JS thread only, no locking / JS 스레드 전용, 잠금 없음
+class FetchCorrelationRegistry {
+public:
+  // Register fetch before calling the original fetch, returns token for cancel /
+  // 원본 fetch 호출 전에 fetch 등록, cancel용 토큰 반환
+  // @param requestTime Monotonic micros of the fetch() call / fetch() 호출의 모노토닉 마이크로초
+  uint64_t push(const std::string& method, const std::string& url, const std::string& requestId, int64_t requestTime);
+
+  // Claim pending fetch for XHR open / XHR open에서 대기 중인 fetch 가져오기
+  // @return false if the XHR does not belong to a fetch / XHR이 fetch에 속하지 않으면 false
+  bool claim(const std::string& method, const std::string& url, std::string& requestId, int64_t& requestTime);
+
+  // Drop context that was never claimed (fetch settled or failed) / 가져가지 않은 컨텍스트 삭제 (fetch 완료 또는 실패)
+  void cancel(uint64_t token);
+
+  void clear();
+  size_t size() const { return fetches_.size(); }
+
+private:
+  using TokenIndex = std::unordered_map<std::string, std::deque<uint64_t>>;
+
+  struct PendingFetch {
+    std::string requestId;
+    int64_t requestTime;
+    std::string key;              // Method + URL as passed to fetch() / fetch()에 전달된 method + URL
+    std::string cacheBustedKey;   // Method + URL with the polyfill's cache buster, value left out / polyfill 캐시 버스터가 붙은 method + URL, 값 제외
+  };
+
+  bool claimFrom(TokenIndex& index, const std::string& key, std::string& requestId, int64_t& requestTime);
+  void erase(uint64_t token);
+  static void removeToken(TokenIndex& index, const std::string& key, uint64_t token);
+
+  // Upper bound of unclaimed contexts, oldest are dropped beyond it / 가져가지 않은 컨텍스트의 상한, 초과 시 가장 오래된 것부터 삭제
+  static constexpr size_t kMaxPending = 1024;
+
+  std::unordered_map<uint64_t, PendingFetch> fetches_;
+  TokenIndex byKey_;             // Oldest token first / 가장 오래된 토큰이 앞
+  TokenIndex byCacheBustedKey_;  // Oldest token first / 가장 오래된 토큰이 앞
+  std::deque<uint64_t> order_;  // Tokens in push order / push 순서의 토큰
+  uint64_t nextToken_ = 1;
+};
+
+} // namespace network
+} // namespace chrome_remote_devtools
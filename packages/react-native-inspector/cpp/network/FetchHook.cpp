@@ -13,6 +13,12 @@
 #include "NetworkInfoCollector.h"
 #include "NetworkEventSender.h"
 #include "NetworkGlobals.h"
+#include "../common/Clock.h"
+#include "../common/JSIHandleCache.h"
+#include "../common/HookMetrics.h"
+#include "../common/OverheadGovernor.h"
+#include "../common/DomainSubscriptions.h"
+#include <optional>
 
 // Platform-specific log support / 플랫폼별 로그 지원
 #ifdef __ANDROID__
@@ -35,6 +41,21 @@
 namespace chrome_remote_devtools {
 namespace network {
 
+// Original fetch, captured at installation; __original_fetch is only a fallback /
+// 설치 시 캡처된 원본 fetch, __original_fetch는 대체 수단일 뿐임
+static const facebook::jsi::Function* findOriginalFetch(facebook::jsi::Runtime& rt,
+                                                        std::optional<facebook::jsi::Function>& backupFetch) {
+  if (const facebook::jsi::Function* originalFetch = common::getCachedFunction(rt, common::CachedFunction::Fetch)) {
+    return originalFetch;
+  }
+  facebook::jsi::Value originalFetchValue = rt.global().getProperty(rt, "__original_fetch");
+  if (originalFetchValue.isObject() && originalFetchValue.asObject(rt).isFunction(rt)) {
+    backupFetch = originalFetchValue.asObject(rt).asFunction(rt);
+    return &*backupFetch;
+  }
+  return nullptr;
+}
+
 bool hookFetch(facebook::jsi::Runtime& runtime) {
   try {
     // Check if already hooked by checking for backup property / 백업 속성 확인하여 이미 훅되었는지 확인
@@ -46,7 +67,9 @@ bool hookFetch(facebook::jsi::Runtime& runtime) {
 
     facebook::jsi::Value fetchValue = runtime.global().getProperty(runtime, "fetch");
     if (fetchValue.isObject() && fetchValue.asObject(runtime).isFunction(runtime)) {
-      // Store original fetch in backup property / 백업 속성에 원본 fetch 저장
+      // Store original fetch in backup property and handle cache / 백업 속성과 핸들 캐시에 원본 fetch 저장
+      common::acquireHandleCache(runtime).setFunction(common::CachedFunction::Fetch,
+                                                      fetchValue.asObject(runtime).asFunction(runtime));
       runtime.global().setProperty(runtime, "__original_fetch", std::move(fetchValue));
 
       // Create hooked fetch function / 훅된 fetch 함수 생성
@@ -58,58 +81,58 @@ bool hookFetch(facebook::jsi::Runtime& runtime) {
            const facebook::jsi::Value&,
            const facebook::jsi::Value* args,
            size_t count) -> facebook::jsi::Value {
+          // No DevTools client has enabled Network: straight to the original / Network를 활성화한 DevTools 클라이언트 없음: 바로 원본 호출
+          if (!common::isNetworkCaptureActive()) {
+            std::optional<facebook::jsi::Function> backupFetch;
+            const facebook::jsi::Function* originalFetch = findOriginalFetch(rt, backupFetch);
+            return originalFetch != nullptr ? originalFetch->call(rt, args, count) : facebook::jsi::Value::undefined();
+          }
+          common::HookScope hookScope(common::HookSite::Fetch);
+          int64_t requestTime = common::monotonicMicros();
+
           // Collect request info / 요청 정보 수집
           RequestInfo requestInfo = collectFetchRequestInfo(rt, args, count);
           std::string requestId = std::to_string(g_requestIdCounter.fetch_add(1));
 
-          // Set global flag to indicate fetch request is active / Fetch 요청이 활성화되었음을 나타내는 전역 플래그 설정
-          {
-            std::lock_guard<std::mutex> lock(g_fetchRequestMutex);
-            g_isFetchRequestActive.store(true);
-            g_activeFetchRequestId = requestId;
-          }
+          // Register pending fetch so the polyfill's XHR open can claim it / polyfill의 XHR open이 가져갈 수 있도록 대기 중인 fetch 등록
+          uint64_t correlationToken = g_fetchCorrelation.push(requestInfo.method, requestInfo.url, requestId, requestTime);
 
           // Send requestWillBeSent event only / requestWillBeSent 이벤트만 전송
-          sendRequestWillBeSent(rt, requestId, requestInfo, "Fetch");
+          sendRequestWillBeSent(rt, requestId, requestInfo, "Fetch", requestTime);
 
           // Call original fetch / 원본 fetch 호출
           facebook::jsi::Value fetchResult = facebook::jsi::Value::undefined();
           try {
-            facebook::jsi::Value originalFetchValue = rt.global().getProperty(rt, "__original_fetch");
-            if (originalFetchValue.isObject() && originalFetchValue.asObject(rt).isFunction(rt)) {
-              fetchResult = originalFetchValue.asObject(rt).asFunction(rt).call(rt, args, count);
+            std::optional<facebook::jsi::Function> backupFetch;
+            const facebook::jsi::Function* originalFetch = findOriginalFetch(rt, backupFetch);
+            if (originalFetch != nullptr) {
+              // Polyfill XHR hooks under the original fetch measure themselves / 원본 fetch 아래의 polyfill XHR 훅은 스스로 측정함
+              common::HookScope::Pause originalCall(hookScope);
+              fetchResult = originalFetch->call(rt, args, count);
             } else {
               // __original_fetch not found - this should not happen / __original_fetch를 찾을 수 없음 - 이는 발생하지 않아야 함
               LOGE("__original_fetch not found, cannot call original fetch / __original_fetch를 찾을 수 없어 원본 fetch를 호출할 수 없음");
-              // Clear flag on error / 에러 시 플래그 지우기
-              {
-                std::lock_guard<std::mutex> lock(g_fetchRequestMutex);
-                g_isFetchRequestActive.store(false);
-                g_activeFetchRequestId.clear();
-              }
+              // Drop pending context on error / 에러 시 대기 컨텍스트 삭제
+              g_fetchCorrelation.cancel(correlationToken);
               // Return undefined to fail the request / 요청을 실패시키기 위해 undefined 반환
               return facebook::jsi::Value::undefined();
             }
           } catch (const std::exception& e) {
             LOGE("Failed to call original fetch: %s", e.what());
-            // Clear flag on error / 에러 시 플래그 지우기
-            {
-              std::lock_guard<std::mutex> lock(g_fetchRequestMutex);
-              g_isFetchRequestActive.store(false);
-              g_activeFetchRequestId.clear();
-            }
+            // Drop pending context on error / 에러 시 대기 컨텍스트 삭제
+            g_fetchCorrelation.cancel(correlationToken);
             return facebook::jsi::Value::undefined();
           }
 
-          // Note: We keep the flag active until Promise resolution to handle potential race conditions
-          // where XHR open() might be called asynchronously after fetch() returns
-          // The flag will be cleared in the Promise handlers (onFulfilled/onRejected)
-          // 참고: Promise 해결까지 플래그를 활성 상태로 유지하여 fetch() 반환 후 비동기적으로 호출될 수 있는
-          // XHR open()의 잠재적 race condition을 처리합니다. 플래그는 Promise 핸들러(onFulfilled/onRejected)에서 지워집니다
+          // Note: The pending context stays until Promise resolution in case XHR open() is called
+          // asynchronously after fetch() returns. It is cancelled in the Promise handlers if never claimed
+          // 참고: fetch() 반환 후 XHR open()이 비동기적으로 호출될 수 있으므로 Promise 해결까지 대기 컨텍스트를 유지합니다.
+          // 가져가지 않은 경우 Promise 핸들러에서 취소됩니다
 
           // Ensure fetchResult is a valid Promise / fetchResult가 유효한 Promise인지 확인
           if (!fetchResult.isObject()) {
             LOGE("Original fetch did not return a Promise / 원본 fetch가 Promise를 반환하지 않음");
+            g_fetchCorrelation.cancel(correlationToken);
             // Return the result as-is (might be undefined or error) / 결과를 그대로 반환 (undefined이거나 에러일 수 있음)
             return fetchResult;
           }
@@ -124,7 +147,7 @@ bool hookFetch(facebook::jsi::Runtime& runtime) {
             rt,
             facebook::jsi::PropNameID::forAscii(rt, "onFulfilled"),
             1,
-            [capturedRequestId, capturedRequestInfo](facebook::jsi::Runtime& runtime,
+            [capturedRequestId, capturedRequestInfo, correlationToken](facebook::jsi::Runtime& runtime,
                                                const facebook::jsi::Value&,
                                                const facebook::jsi::Value* args,
                                                size_t count) -> facebook::jsi::Value {
@@ -268,9 +291,9 @@ bool hookFetch(facebook::jsi::Runtime& runtime) {
                                   }
 
                                   // Store response data only (XHR hook handles responseReceived and loadingFinished) / 응답 데이터만 저장 (XHR 훅이 responseReceived와 loadingFinished 처리)
-                                  {
-                                    std::lock_guard<std::mutex> lock(g_responseDataMutex);
-                                    g_responseData[capturedRequestId] = responseText;
+                                  // Bodies over the governor's limit are dropped under load / 부하 시 거버너 제한을 넘는 본문은 버림
+                                  if (common::shouldKeepResponseBody(responseText.size())) {
+                                    g_responseBodyStore.put(capturedRequestId, responseText);
                                   }
 
                                   LOGI("FetchHook: Response body stored for requestId=%s, length=%zu / FetchHook: requestId=%s에 대한 응답 본문 저장, 길이=%zu", capturedRequestId.c_str(), responseText.length(), capturedRequestId.c_str(), responseText.length());
@@ -305,13 +328,9 @@ bool hookFetch(facebook::jsi::Runtime& runtime) {
                 // Return original response / 원본 응답 반환
                 // In Promise then callback, we need to return the value as-is / Promise then 콜백에서는 값을 그대로 반환해야 함
                 // This is critical for the Promise chain to work correctly / Promise 체인이 올바르게 동작하려면 이것이 중요함
-                // Clear flag after Promise is fulfilled (XHR should have detected it by now)
-                // Promise가 완료된 후 플래그 지우기 (XHR이 이미 감지했을 것임)
-                {
-                  std::lock_guard<std::mutex> lock(g_fetchRequestMutex);
-                  g_isFetchRequestActive.store(false);
-                  g_activeFetchRequestId.clear();
-                }
+                // Drop pending context after Promise is fulfilled (XHR should have claimed it by now)
+                // Promise가 완료된 후 대기 컨텍스트 삭제 (XHR이 이미 가져갔을 것임)
+                g_fetchCorrelation.cancel(correlationToken);
 
                 LOGI("FetchHook: onFulfilled returning original response / FetchHook: onFulfilled가 원본 응답 반환");
                 if (count > 0) {
@@ -329,7 +348,7 @@ bool hookFetch(facebook::jsi::Runtime& runtime) {
               rt,
               facebook::jsi::PropNameID::forAscii(rt, "onRejected"),
               1,
-              [capturedRequestId](facebook::jsi::Runtime& runtime,
+              [capturedRequestId, correlationToken](facebook::jsi::Runtime& runtime,
                          const facebook::jsi::Value&,
                          const facebook::jsi::Value* args,
                          size_t count) -> facebook::jsi::Value {
@@ -352,13 +371,9 @@ bool hookFetch(facebook::jsi::Runtime& runtime) {
                   }
                 }
 
-                // Clear flag after Promise is rejected
-                // Promise가 거부된 후 플래그 지우기
-                {
-                  std::lock_guard<std::mutex> lock(g_fetchRequestMutex);
-                  g_isFetchRequestActive.store(false);
-                  g_activeFetchRequestId.clear();
-                }
+                // Drop pending context after Promise is rejected
+                // Promise가 거부된 후 대기 컨텍스트 삭제
+                g_fetchCorrelation.cancel(correlationToken);
 
                 // Send loadingFailed event / loadingFailed 이벤트 전송
                 LOGE("Fetch request failed - sending loadingFailed: %s", errorText.c_str());
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "HttpHeaders.h"
+
+namespace chrome_remote_devtools {
+namespace network {
+
+// Indexed by HeaderName / HeaderName으로 인덱싱
+static constexpr std::string_view kHeaderNames[] = {
+  "",
+  "Accept",
+  "Accept-Encoding",
+  "Accept-Language",
+  "Accept-Ranges",
+  "Access-Control-Allow-Origin",
+  "Age",
+  "Authorization",
+  "Cache-Control",
+  "Connection",
+  "Content-Disposition",
+  "Content-Encoding",
+  "Content-Length",
+  "Content-Type",
+  "Cookie",
+  "Date",
+  "ETag",
+  "Expires",
+  "Host",
+  "If-Modified-Since",
+  "If-None-Match",
+  "Last-Modified",
+  "Location",
+  "Origin",
+  "Pragma",
+  "Referer",
+  "Server",
+  "Set-Cookie",
+  "Strict-Transport-Security",
+  "Transfer-Encoding",
+  "User-Agent",
+  "Vary",
+  "Via",
+  "X-Requested-With",
+};
+static_assert(sizeof(kHeaderNames) / sizeof(kHeaderNames[0]) == static_cast<size_t>(HeaderName::Count),
+              "kHeaderNames must match HeaderName / kHeaderNames는 HeaderName과 일치해야 함");
+
+static inline char toLowerAscii(char c) {
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+}
+
+static bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (toLowerAscii(a[i]) != toLowerAscii(b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static inline bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static std::string_view trim(std::string_view text) {
+  size_t start = 0;
+  size_t end = text.size();
+  while (start < end && isSpace(text[start])) {
+    ++start;
+  }
+  while (end > start && isSpace(text[end - 1])) {
+    --end;
+  }
+  return text.substr(start, end - start);
+}
+
+std::string_view headerNameString(HeaderName name) {
+  size_t index = static_cast<size_t>(name);
+  return index < static_cast<size_t>(HeaderName::Count) ? kHeaderNames[index] : std::string_view();
+}
+
+HeaderName internHeaderName(std::string_view name) {
+  // Length check rejects almost every candidate before comparing / 길이 확인으로 비교 전에 대부분의 후보 제외
+  for (size_t i = 1; i < static_cast<size_t>(HeaderName::Count); ++i) {
+    if (kHeaderNames[i].size() == name.size() && equalsIgnoreCase(kHeaderNames[i], name)) {
+      return static_cast<HeaderName>(i);
+    }
+  }
+  return HeaderName::Custom;
+}
+
+HttpHeader* HttpHeaders::find(HeaderName id, std::string_view name) {
+  for (auto& header : headers_) {
+    if (header.id == id && (id != HeaderName::Custom || equalsIgnoreCase(header.customName, name))) {
+      return &header;
+    }
+  }
+  return nullptr;
+}
+
+const HttpHeader* HttpHeaders::find(HeaderName id, std::string_view name) const {
+  return const_cast<HttpHeaders*>(this)->find(id, name);
+}
+
+void HttpHeaders::set(std::string_view name, std::string_view value) {
+  HeaderName id = internHeaderName(name);
+  if (HttpHeader* existing = find(id, name)) {
+    existing->value.assign(value.data(), value.size());
+    return;
+  }
+  HttpHeader header;
+  header.id = id;
+  if (id == HeaderName::Custom) {
+    header.customName.assign(name.data(), name.size());
+  }
+  header.value.assign(value.data(), value.size());
+  headers_.push_back(std::move(header));
+}
+
+void HttpHeaders::append(std::string_view name, std::string_view value) {
+  HeaderName id = internHeaderName(name);
+  if (HttpHeader* existing = find(id, name)) {
+    existing->value.push_back('\n');
+    existing->value.append(value.data(), value.size());
+    return;
+  }
+  HttpHeader header;
+  header.id = id;
+  if (id == HeaderName::Custom) {
+    header.customName.assign(name.data(), name.size());
+  }
+  header.value.assign(value.data(), value.size());
+  headers_.push_back(std::move(header));
+}
+
+std::string_view HttpHeaders::get(HeaderName name) const {
+  const HttpHeader* header = find(name, std::string_view());
+  return header ? std::string_view(header->value) : std::string_view();
+}
+
+std::string_view HttpHeaders::get(std::string_view name) const {
+  const HttpHeader* header = find(internHeaderName(name), name);
+  return header ? std::string_view(header->value) : std::string_view();
+}
+
+void parseHeaderBlock(std::string_view block, HttpHeaders& headers) {
+  size_t position = 0;
+  while (position < block.size()) {
+    size_t lineEnd = block.find('\n', position);
+    if (lineEnd == std::string_view::npos) {
+      lineEnd = block.size();
+    }
+    std::string_view line = block.substr(position, lineEnd - position);
+    position = lineEnd + 1;
+
+    size_t colon = line.find(':');
+    if (colon == std::string_view::npos) {
+      continue;
+    }
+    std::string_view name = trim(line.substr(0, colon));
+    if (!name.empty()) {
+      headers.append(name, trim(line.substr(colon + 1)));
+    }
+  }
+}
+
+} // namespace network
+} // namespace chrome_remote_devtools
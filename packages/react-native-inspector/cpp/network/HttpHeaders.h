@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace chrome_remote_devtools {
+namespace network {
+
+// Interned names of common headers / 자주 쓰이는 헤더의 인턴된 이름
+// Headers with these names store no name string at all / 이 이름의 헤더는 이름 문자열을 저장하지 않음
+enum class HeaderName : uint8_t {
+  Custom = 0,
+  Accept,
+  AcceptEncoding,
+  AcceptLanguage,
+  AcceptRanges,
+  AccessControlAllowOrigin,
+  Age,
+  Authorization,
+  CacheControl,
+  Connection,
+  ContentDisposition,
+  ContentEncoding,
+  ContentLength,
+  ContentType,
+  Cookie,
+  Date,
+  ETag,
+  Expires,
+  Host,
+  IfModifiedSince,
+  IfNoneMatch,
+  LastModified,
+  Location,
+  Origin,
+  Pragma,
+  Referer,
+  Server,
+  SetCookie,
+  StrictTransportSecurity,
+  TransferEncoding,
+  UserAgent,
+  Vary,
+  Via,
+  XRequestedWith,
+  Count
+};
+
+// Canonical spelling of interned name / 인턴된 이름의 표준 표기
+std::string_view headerNameString(HeaderName name);
+
+// Look up name case-insensitively / 대소문자 구분 없이 이름 조회
+// @return HeaderName::Custom if not interned / 인턴되지 않았으면 HeaderName::Custom
+HeaderName internHeaderName(std::string_view name);
+
+struct HttpHeader {
+  HeaderName id = HeaderName::Custom;
+  std::string customName;  // Only set for HeaderName::Custom / HeaderName::Custom일 때만 설정
+  std::string value;
+
+  std::string_view name() const {
+    return id == HeaderName::Custom ? std::string_view(customName) : headerNameString(id);
+  }
+};
+
+// Compact header list of a captured request or response / 캡처된 요청 또는 응답의 간결한 헤더 목록
+// Names compare case-insensitively, insertion order is kept / 이름은 대소문자 구분 없이 비교되며 삽입 순서 유지
+class HttpHeaders {
+public:
+  // Replace value of name (setRequestHeader semantics in React Native) / name의 값 대체 (React Native의 setRequestHeader 의미)
+  void set(std::string_view name, std::string_view value);
+
+  // Add value, repeated names are joined with '\n' like Chrome does / 값 추가, 반복된 이름은 Chrome처럼 '\n'으로 연결
+  void append(std::string_view name, std::string_view value);
+
+  // Value of header, or empty / 헤더 값, 없으면 빈 값
+  std::string_view get(HeaderName name) const;
+  std::string_view get(std::string_view name) const;
+
+  bool empty() const { return headers_.empty(); }
+  size_t size() const { return headers_.size(); }
+  void clear() { headers_.clear(); }
+
+  std::vector<HttpHeader>::const_iterator begin() const { return headers_.begin(); }
+  std::vector<HttpHeader>::const_iterator end() const { return headers_.end(); }
+
+private:
+  HttpHeader* find(HeaderName id, std::string_view name);
+  const HttpHeader* find(HeaderName id, std::string_view name) const;
+
+  std::vector<HttpHeader> headers_;
+};
+
+// Parse getAllResponseHeaders() output ("Name: value\r\n" lines) in a single pass without copying lines /
+// getAllResponseHeaders() 출력("Name: value\r\n" 줄)을 줄 복사 없이 한 번에 파싱
+void parseHeaderBlock(std::string_view block, HttpHeaders& headers);
+
+} // namespace network
+} // namespace chrome_remote_devtools
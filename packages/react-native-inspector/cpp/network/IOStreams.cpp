@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "IOStreams.h"
+#include "NetworkGlobals.h"
+#include "../common/Base64.h"
+#include "../common/JsonWriter.h"
+
+namespace chrome_remote_devtools {
+namespace network {
+
+// Longest UTF-8 sequence / 가장 긴 UTF-8 시퀀스
+constexpr size_t kMaxUtf8SequenceBytes = 4;
+
+// Bytes to drop from chunk end so it does not cut a UTF-8 sequence / 청크 끝이 UTF-8 시퀀스를 자르지 않도록 제거할 바이트 수
+static size_t incompleteUtf8Tail(const std::string& chunk) {
+  size_t checked = 0;
+  for (size_t i = chunk.size(); i > 0 && checked < kMaxUtf8SequenceBytes; --i, ++checked) {
+    unsigned char c = static_cast<unsigned char>(chunk[i - 1]);
+    if ((c & 0xC0) == 0x80) {
+      continue; // Continuation byte / 연속 바이트
+    }
+    size_t expected = (c & 0x80) == 0x00 ? 1 : (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : (c & 0xF8) == 0xF0 ? 4 : 1;
+    size_t available = chunk.size() - (i - 1);
+    return available < expected ? available : 0;
+  }
+  return 0;
+}
+
+// A body that yields no bytes before its recorded size was truncated or replaced; reporting eof: false
+// with empty data would make DevTools read forever / 기록된 크기 전에 바이트가 나오지 않는 본문은 잘렸거나 교체된
+// 것이며, 빈 데이터와 eof: false를 보고하면 DevTools가 끝없이 읽게 됨
+bool IOStreamRegistry::isShortRead(const Stream& stream, const std::string& chunk) {
+  return chunk.empty() && stream.position < stream.size;
+}
+
+std::string IOStreamRegistry::open(const std::string& requestId) {
+  size_t size = 0;
+  if (!g_responseBodyStore.size(requestId, size)) {
+    return "";
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  while (streams_.size() >= kMaxOpenStreams) {
+    g_responseBodyStore.erase(streams_.front().requestId);
+    streams_.pop_front();
+  }
+  Stream stream;
+  stream.handle = "response-body-" + std::to_string(nextHandle_++);
+  stream.requestId = requestId;
+  stream.size = size;
+  stream.binary = g_responseBodyStore.isBinary(requestId);
+  streams_.push_back(std::move(stream));
+  return streams_.back().handle;
+}
+
+std::list<IOStreamRegistry::Stream>::iterator IOStreamRegistry::findLocked(const std::string& handle) {
+  for (auto it = streams_.begin(); it != streams_.end(); ++it) {
+    if (it->handle == handle) {
+      return it;
+    }
+  }
+  return streams_.end();
+}
+
+bool IOStreamRegistry::read(const std::string& handle, int64_t offset, size_t size, std::string& data, bool& base64Encoded, bool& eof) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = findLocked(handle);
+  if (it == streams_.end()) {
+    return false;
+  }
+  if (offset >= 0) {
+    it->position = static_cast<size_t>(offset);
+  }
+  size_t length = size > 0 ? size : kIOReadChunkBytes;
+  base64Encoded = it->binary;
+  if (it->binary) {
+    // Whole 3-byte groups so encoded chunks concatenate into valid base64 / 인코딩된 청크를 이어도 유효한 base64가 되도록 3바이트 단위
+    length = length / 4 * 3;
+    if (length == 0) {
+      length = 3;
+    }
+    std::string raw;
+    if (!g_responseBodyStore.read(it->requestId, it->position, length, raw) || isShortRead(*it, raw)) {
+      return false;
+    }
+    it->position += raw.size();
+    eof = it->position >= it->size;
+    data = common::base64Encode(raw.data(), raw.size());
+    return true;
+  }
+  if (!g_responseBodyStore.read(it->requestId, it->position, length, data) || isShortRead(*it, data)) {
+    return false;
+  }
+  if (it->position + data.size() < it->size) {
+    size_t tail = incompleteUtf8Tail(data);
+    if (tail == data.size() && length < kMaxUtf8SequenceBytes) {
+      // Chunk is only the start of one sequence, widen it to the whole sequence / 청크가 시퀀스 시작 부분뿐이면 시퀀스 전체로 확장
+      if (!g_responseBodyStore.read(it->requestId, it->position, kMaxUtf8SequenceBytes, data) || isShortRead(*it, data)) {
+        return false;
+      }
+      tail = it->position + data.size() < it->size ? incompleteUtf8Tail(data) : 0;
+    }
+    if (tail < data.size()) {
+      data.resize(data.size() - tail);
+    }
+  }
+  it->position += data.size();
+  eof = it->position >= it->size;
+  return true;
+}
+
+void IOStreamRegistry::close(const std::string& handle) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = findLocked(handle);
+  if (it == streams_.end()) {
+    return;
+  }
+  // Body was handed to DevTools, like Network.getResponseBody / Network.getResponseBody처럼 본문이 DevTools로 전달됨
+  g_responseBodyStore.erase(it->requestId);
+  streams_.erase(it);
+}
+
+void IOStreamRegistry::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  streams_.clear();
+}
+
+std::string buildIOReadResponse(IOStreamRegistry& streams,
+                                int64_t messageId,
+                                const std::string& handle,
+                                int64_t offset,
+                                size_t size) {
+  std::string data;
+  bool base64Encoded = false;
+  bool eof = false;
+  bool found = streams.read(handle, offset, size, data, base64Encoded, eof);
+
+  std::string response;
+  response.reserve(data.size() + data.size() / 8 + 96);
+  common::JsonWriter writer(response);
+  writer.beginObject();
+  writer.field("id", static_cast<long long>(messageId));
+  if (found) {
+    writer.key("result");
+    writer.beginObject();
+    writer.field("data", data);
+    writer.field("eof", eof);
+    writer.field("base64Encoded", base64Encoded);
+    writer.endObject();
+  } else {
+    writer.key("error");
+    writer.beginObject();
+    writer.field("code", -32000);
+    writer.field("message", "Invalid stream handle or body was evicted");
+    writer.endObject();
+  }
+  writer.endObject();
+  return response;
+}
+
+} // namespace network
+} // namespace chrome_remote_devtools
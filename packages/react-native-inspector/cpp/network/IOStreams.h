@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+
+namespace chrome_remote_devtools {
+namespace network {
+
+// Bodies at least this large are served through IO.read instead of inline / 이 크기 이상의 본문은 인라인 대신 IO.read로 제공
+constexpr size_t kResponseBodyStreamThresholdBytes = 1024 * 1024;
+// Default IO.read chunk size / 기본 IO.read 청크 크기
+constexpr size_t kIOReadChunkBytes = 64 * 1024;
+
+// CDP IO stream handles over stored response bodies / 저장된 응답 본문에 대한 CDP IO 스트림 핸들
+// Reads copy one bounded chunk out of the body store, the body itself is never copied whole /
+// 읽기는 본문 저장소에서 제한된 청크 하나만 복사하며, 본문 전체는 복사되지 않음
+// Thread-safe (called from the platform WebSocket threads) / 스레드 안전 (플랫폼 WebSocket 스레드에서 호출)
+class IOStreamRegistry {
+public:
+  // Open stream over body of requestId / requestId 본문에 대한 스트림 열기
+  // @return handle, or empty if no body is stored / 핸들, 저장된 본문이 없으면 빈 문자열
+  std::string open(const std::string& requestId);
+
+  // IO.read: offset < 0 continues at the current position, size 0 uses the default chunk size /
+  // IO.read: offset < 0이면 현재 위치에서 계속, size 0이면 기본 청크 크기 사용
+  // Text chunks never end inside a UTF-8 sequence. Binary bodies are returned base64-encoded, size then
+  // bounds the encoded chunk / 텍스트 청크는 UTF-8 시퀀스 중간에서 끝나지 않음. 바이너리 본문은 base64로
+  // 인코딩되어 반환되며, 이때 size는 인코딩된 청크의 상한임
+  // @return false if handle is unknown, body was evicted, or body ended before its recorded size /
+  //         핸들을 모르거나, 본문이 제거되었거나, 본문이 기록된 크기 전에 끝났으면 false
+  bool read(const std::string& handle, int64_t offset, size_t size, std::string& data, bool& base64Encoded, bool& eof);
+
+  // IO.close: drop stream and its body / IO.close: 스트림과 본문 삭제
+  void close(const std::string& handle);
+
+  void clear();
+
+private:
+  struct Stream {
+    std::string handle;
+    std::string requestId;
+    size_t position = 0;
+    size_t size = 0;
+    bool binary = false;
+  };
+
+  // Streams DevTools never closed are dropped oldest first / DevTools가 닫지 않은 스트림은 가장 오래된 것부터 삭제
+  static constexpr size_t kMaxOpenStreams = 16;
+
+  std::list<Stream>::iterator findLocked(const std::string& handle);
+  static bool isShortRead(const Stream& stream, const std::string& chunk);
+
+  std::mutex mutex_;
+  std::list<Stream> streams_;
+  uint64_t nextHandle_ = 1;
+};
+
+// Build complete IO.read response message / 완전한 IO.read 응답 메시지 생성
+std::string buildIOReadResponse(IOStreamRegistry& streams,
+                                int64_t messageId,
+                                const std::string& handle,
+                                int64_t offset,
+                                size_t size);
+
+} // namespace network
+} // namespace chrome_remote_devtools
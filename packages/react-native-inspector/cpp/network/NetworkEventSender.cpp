@@ -10,7 +10,13 @@
 #include "NetworkEventSender.h"
 #include "NetworkUtils.h"
 #include "../ConsoleHook.h" // For SendCDPMessageCallback / SendCDPMessageCallback을 위해
-#include <folly/json.h>
+#include "../InspectorHook.h"
+#include "../transport/CDPEventSender.h"
+#include "../common/Clock.h"
+#include "../common/JsonWriter.h"
+#include "../common/HookMetrics.h"
+#include <algorithm>
+#include <atomic>
 
 // Platform-specific log support / 플랫폼별 로그 지원
 #ifdef __ANDROID__
@@ -32,7 +38,7 @@
 
 // Forward declaration / 전방 선언
 namespace chrome_remote_devtools {
-  extern SendCDPMessageCallback g_sendCDPMessageCallback;
+  extern std::atomic<SendCDPMessageCallback> g_sendCDPMessageCallback;
 }
 
 namespace chrome_remote_devtools {
@@ -43,28 +49,19 @@ namespace network {
 // We access it via chrome_remote_devtools::g_sendCDPMessageCallback / chrome_remote_devtools::g_sendCDPMessageCallback을 통해 접근
 
 // Send CDP network event / CDP 네트워크 이벤트 전송
-void sendCDPNetworkEvent(facebook::jsi::Runtime& runtime, const folly::dynamic& event) {
+void sendCDPNetworkEvent(facebook::jsi::Runtime& runtime, const std::string& message) {
+  reportCaptureLevelChange(runtime);
   try {
-    // Serialize to JSON string / JSON 문자열로 직렬화
-    folly::json::serialization_opts opts;
-    std::string cdpMessageJson = folly::json::serialize(event, opts);
-
     // Get server info / 서버 정보 가져오기
     std::string serverHost;
     int serverPort;
     getServerInfo(runtime, serverHost, serverPort);
 
-    // Send via platform-specific callback only / 플랫폼별 콜백만 사용하여 전송
-    // Access g_sendCDPMessageCallback from parent namespace / 부모 네임스페이스에서 g_sendCDPMessageCallback 접근
+    // Hand off to sender thread; JS thread only pays for the enqueue / 전송 스레드로 넘김, JS 스레드는 큐 추가 비용만 부담
+    // Copying out of the reusable buffer is a single exact-size allocation / 재사용 버퍼에서 복사는 정확한 크기의 단일 할당
     if (chrome_remote_devtools::g_sendCDPMessageCallback != nullptr) {
-      try {
-        chrome_remote_devtools::g_sendCDPMessageCallback(serverHost.c_str(), serverPort, cdpMessageJson.c_str());
-        LOGI("Sending CDP network event via platform callback / 플랫폼 콜백을 통해 CDP 네트워크 이벤트 전송");
-      } catch (const std::exception& e) {
-        LOGE("Failed to send CDP network event via platform callback: %s", e.what());
-      } catch (...) {
-        LOGE("Failed to send CDP network event via platform callback (unknown exception) / 플랫폼 콜백을 통해 CDP 네트워크 이벤트 전송 실패 (알 수 없는 예외)");
-      }
+      bool enqueued = transport::enqueueCDPMessage(serverHost, serverPort, message);
+      common::recordHookEvent(common::HookSite::NetworkEvent, message.size(), enqueued);
     } else {
       LOGE("Platform callback not available for CDP network event (g_sendCDPMessageCallback is nullptr) / CDP 네트워크 이벤트를 위한 플랫폼 콜백을 사용할 수 없음 (g_sendCDPMessageCallback이 nullptr)");
     }
@@ -75,33 +72,75 @@ void sendCDPNetworkEvent(facebook::jsi::Runtime& runtime, const folly::dynamic&
   }
 }
 
+// Write headers object / 헤더 객체 작성
+static void writeHeaders(common::JsonWriter& writer, const HttpHeaders& headers) {
+  writer.beginObject();
+  for (const auto& header : headers) {
+    writer.key(header.name());
+    writer.value(header.value);
+  }
+  writer.endObject();
+}
+
+// Offset of phase from requestTime in milliseconds, -1 if not reached (CDP convention) /
+// requestTime 기준 단계의 밀리초 오프셋, 도달하지 않았으면 -1 (CDP 규칙)
+static double phaseOffset(int64_t requestTime, int64_t phase) {
+  return phase == 0 ? -1.0 : static_cast<double>(phase - requestTime) / 1e3;
+}
+
+// Write ResourceTiming object / ResourceTiming 객체 작성
+static void writeResourceTiming(common::JsonWriter& writer, const RequestTiming& timing) {
+  writer.beginObject();
+  writer.field("requestTime", common::monotonicSeconds(timing.requestTime));
+  // Not observable from JS / JS에서 관찰할 수 없음
+  static constexpr const char* kUnknownPhases[] = {
+    "proxyStart", "proxyEnd", "dnsStart", "dnsEnd", "connectStart", "connectEnd", "sslStart", "sslEnd",
+    "workerStart", "workerReady", "workerFetchStart", "workerRespondWithSettled", "pushStart", "pushEnd",
+  };
+  for (const char* phase : kUnknownPhases) {
+    writer.field(phase, -1);
+  }
+  writer.field("sendStart", phaseOffset(timing.requestTime, timing.sendStart));
+  writer.field("sendEnd", phaseOffset(timing.requestTime, timing.sendEnd));
+  writer.field("receiveHeadersEnd", phaseOffset(timing.requestTime, timing.receiveHeadersEnd));
+  writer.endObject();
+}
+
 // Send requestWillBeSent event / requestWillBeSent 이벤트 전송
 void sendRequestWillBeSent(facebook::jsi::Runtime& runtime,
                            const std::string& requestId,
                            const RequestInfo& requestInfo,
-                           const std::string& type) {
-  folly::dynamic requestObj = folly::dynamic::object;
-  requestObj["url"] = requestInfo.url;
-  requestObj["method"] = requestInfo.method;
-  requestObj["headers"] = requestInfo.headers;
+                           const std::string& type,
+                           int64_t requestTime) {
+  common::HookScope hookScope(common::HookSite::NetworkEvent);
+  std::string& buffer = common::acquireJsonBuffer();
+  common::JsonWriter writer(buffer);
+  writer.beginObject();
+  writer.field("method", "Network.requestWillBeSent");
+  writer.key("params");
+  writer.beginObject();
+  writer.field("requestId", requestId);
+  writer.field("loaderId", requestId);
+  writer.field("documentURL", requestInfo.url);
+  writer.key("request");
+  writer.beginObject();
+  writer.field("url", requestInfo.url);
+  writer.field("method", requestInfo.method);
+  writer.key("headers");
+  writeHeaders(writer, requestInfo.headers);
+  writer.key("postData");
   if (!requestInfo.postData.empty()) {
-    requestObj["postData"] = requestInfo.postData;
+    writer.value(requestInfo.postData);
   } else {
-    requestObj["postData"] = nullptr;
+    writer.nullValue();
   }
-
-  folly::dynamic params = folly::dynamic::object;
-  params["requestId"] = requestId;
-  params["loaderId"] = requestId;
-  params["documentURL"] = requestInfo.url;
-  params["request"] = requestObj;
-  params["timestamp"] = getTimestamp();
-  params["type"] = type;
-
-  folly::dynamic event = folly::dynamic::object;
-  event["method"] = "Network.requestWillBeSent";
-  event["params"] = params;
-  sendCDPNetworkEvent(runtime, event);
+  writer.endObject();
+  writer.field("timestamp", common::monotonicSeconds(requestTime));
+  writer.field("wallTime", common::wallTimeSeconds(requestTime));
+  writer.field("type", type);
+  writer.endObject();
+  writer.endObject();
+  sendCDPNetworkEvent(runtime, buffer);
 }
 
 // Send responseReceived event / responseReceived 이벤트 전송
@@ -109,42 +148,91 @@ void sendResponseReceived(facebook::jsi::Runtime& runtime,
                          const std::string& requestId,
                          const std::string& url,
                          const ResponseInfo& responseInfo,
-                         const std::string& type) {
-  folly::dynamic responseObj = folly::dynamic::object;
-  responseObj["url"] = url;
-  responseObj["status"] = responseInfo.status;
-  responseObj["statusText"] = responseInfo.statusText;
-  responseObj["headers"] = responseInfo.headers;
-  responseObj["mimeType"] = responseInfo.contentType.empty() ? "text/plain" : responseInfo.contentType;
-  responseObj["body"] = responseInfo.responseText;
-
-  folly::dynamic responseParams = folly::dynamic::object;
-  responseParams["requestId"] = requestId;
-  responseParams["loaderId"] = requestId;
-  responseParams["timestamp"] = getTimestamp();
-  responseParams["type"] = type;
-  responseParams["response"] = responseObj;
-
-  folly::dynamic responseEvent = folly::dynamic::object;
-  responseEvent["method"] = "Network.responseReceived";
-  responseEvent["params"] = responseParams;
-  sendCDPNetworkEvent(runtime, responseEvent);
+                         const std::string& type,
+                         const RequestTiming& timing) {
+  common::HookScope hookScope(common::HookSite::NetworkEvent);
+  std::string& buffer = common::acquireJsonBuffer();
+  common::JsonWriter writer(buffer);
+  writer.beginObject();
+  writer.field("method", "Network.responseReceived");
+  writer.key("params");
+  writer.beginObject();
+  writer.field("requestId", requestId);
+  writer.field("loaderId", requestId);
+  writer.field("timestamp", timing.receiveHeadersEnd != 0 ? common::monotonicSeconds(timing.receiveHeadersEnd) : getTimestamp());
+  writer.field("type", type);
+  writer.key("response");
+  writer.beginObject();
+  writer.field("url", url);
+  writer.field("status", responseInfo.status);
+  writer.field("statusText", responseInfo.statusText);
+  writer.key("headers");
+  writeHeaders(writer, responseInfo.headers);
+  writer.field("mimeType", responseInfo.contentType.empty() ? std::string("text/plain") : responseInfo.contentType);
+  if (timing.requestTime != 0) {
+    writer.key("timing");
+    writeResourceTiming(writer, timing);
+  }
+  writer.endObject();
+  writer.endObject();
+  writer.endObject();
+  sendCDPNetworkEvent(runtime, buffer);
+}
+
+// Chunk size of dataReceived events / dataReceived 이벤트의 청크 크기
+static constexpr size_t kDataReceivedChunkBytes = 64 * 1024;
+// Larger bodies use bigger chunks so one response never floods the socket / 큰 본문은 더 큰 청크를 사용하여 하나의 응답이 소켓을 채우지 않도록 함
+static constexpr size_t kMaxDataReceivedEvents = 64;
+
+// Send dataReceived events / dataReceived 이벤트 전송
+void sendDataReceived(facebook::jsi::Runtime& runtime,
+                      const std::string& requestId,
+                      size_t dataLength) {
+  common::HookScope hookScope(common::HookSite::NetworkEvent);
+  if (dataLength == 0) {
+    return;
+  }
+  size_t chunkBytes = kDataReceivedChunkBytes;
+  if (dataLength / chunkBytes >= kMaxDataReceivedEvents) {
+    chunkBytes = (dataLength + kMaxDataReceivedEvents - 1) / kMaxDataReceivedEvents;
+  }
+  double timestamp = getTimestamp();
+  for (size_t offset = 0; offset < dataLength; offset += chunkBytes) {
+    size_t chunkLength = std::min(chunkBytes, dataLength - offset);
+    std::string& buffer = common::acquireJsonBuffer();
+    common::JsonWriter writer(buffer);
+    writer.beginObject();
+    writer.field("method", "Network.dataReceived");
+    writer.key("params");
+    writer.beginObject();
+    writer.field("requestId", requestId);
+    writer.field("timestamp", timestamp);
+    writer.field("dataLength", chunkLength);
+    writer.field("encodedDataLength", chunkLength);
+    writer.endObject();
+    writer.endObject();
+    sendCDPNetworkEvent(runtime, buffer);
+  }
 }
 
 // Send loadingFinished event / loadingFinished 이벤트 전송
 void sendLoadingFinished(facebook::jsi::Runtime& runtime,
                          const std::string& requestId,
-                         const std::string& responseText) {
-  size_t encodedDataLength = calculateEncodedDataLength("", responseText);
-  folly::dynamic loadingParams = folly::dynamic::object;
-  loadingParams["requestId"] = requestId;
-  loadingParams["timestamp"] = getTimestamp();
-  loadingParams["encodedDataLength"] = encodedDataLength;
-
-  folly::dynamic loadingEvent = folly::dynamic::object;
-  loadingEvent["method"] = "Network.loadingFinished";
-  loadingEvent["params"] = loadingParams;
-  sendCDPNetworkEvent(runtime, loadingEvent);
+                         size_t encodedDataLength,
+                         int64_t finishedTime) {
+  common::HookScope hookScope(common::HookSite::NetworkEvent);
+  std::string& buffer = common::acquireJsonBuffer();
+  common::JsonWriter writer(buffer);
+  writer.beginObject();
+  writer.field("method", "Network.loadingFinished");
+  writer.key("params");
+  writer.beginObject();
+  writer.field("requestId", requestId);
+  writer.field("timestamp", common::monotonicSeconds(finishedTime));
+  writer.field("encodedDataLength", encodedDataLength);
+  writer.endObject();
+  writer.endObject();
+  sendCDPNetworkEvent(runtime, buffer);
 }
 
 // Send loadingFailed event / loadingFailed 이벤트 전송
@@ -152,17 +240,21 @@ void sendLoadingFailed(facebook::jsi::Runtime& runtime,
                        const std::string& requestId,
                        const std::string& errorText,
                        const std::string& type) {
-  folly::dynamic failedParams = folly::dynamic::object;
-  failedParams["requestId"] = requestId;
-  failedParams["timestamp"] = getTimestamp();
-  failedParams["type"] = type;
-  failedParams["errorText"] = errorText.empty() ? "Network error" : errorText;
-  failedParams["canceled"] = false;
-
-  folly::dynamic failedEvent = folly::dynamic::object;
-  failedEvent["method"] = "Network.loadingFailed";
-  failedEvent["params"] = failedParams;
-  sendCDPNetworkEvent(runtime, failedEvent);
+  common::HookScope hookScope(common::HookSite::NetworkEvent);
+  std::string& buffer = common::acquireJsonBuffer();
+  common::JsonWriter writer(buffer);
+  writer.beginObject();
+  writer.field("method", "Network.loadingFailed");
+  writer.key("params");
+  writer.beginObject();
+  writer.field("requestId", requestId);
+  writer.field("timestamp", getTimestamp());
+  writer.field("type", type);
+  writer.field("errorText", errorText.empty() ? std::string("Network error") : errorText);
+  writer.field("canceled", false);
+  writer.endObject();
+  writer.endObject();
+  sendCDPNetworkEvent(runtime, buffer);
 }
 
 } // namespace network
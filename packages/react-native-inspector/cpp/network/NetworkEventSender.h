@@ -10,32 +10,44 @@
 #pragma once
 
 #include <jsi/jsi.h>
+#include <cstdint>
 #include <string>
 #include "NetworkTypes.h"
 
 namespace chrome_remote_devtools {
 namespace network {
 
-// Send CDP network event / CDP 네트워크 이벤트 전송
-void sendCDPNetworkEvent(facebook::jsi::Runtime& runtime, const folly::dynamic& event);
+// Send serialized CDP network event / 직렬화된 CDP 네트워크 이벤트 전송
+void sendCDPNetworkEvent(facebook::jsi::Runtime& runtime, const std::string& message);
 
-// Send requestWillBeSent event / requestWillBeSent 이벤트 전송
+// Send requestWillBeSent event with wallTime / wallTime을 포함한 requestWillBeSent 이벤트 전송
+// @param requestTime Monotonic micros the request started at / 요청이 시작된 모노토닉 마이크로초
 void sendRequestWillBeSent(facebook::jsi::Runtime& runtime,
                            const std::string& requestId,
                            const RequestInfo& requestInfo,
-                           const std::string& type);
+                           const std::string& type,
+                           int64_t requestTime);
 
-// Send responseReceived event / responseReceived 이벤트 전송
+// Send responseReceived event (without body, see Network.getResponseBody) / responseReceived 이벤트 전송 (본문 제외, Network.getResponseBody 참고)
+// response.timing is included when timing.requestTime is set / timing.requestTime이 설정되면 response.timing 포함
 void sendResponseReceived(facebook::jsi::Runtime& runtime,
                          const std::string& requestId,
                          const std::string& url,
                          const ResponseInfo& responseInfo,
-                         const std::string& type);
+                         const std::string& type,
+                         const RequestTiming& timing);
+
+// Send dataReceived events for body, split into chunks / 본문에 대한 dataReceived 이벤트를 청크로 나누어 전송
+void sendDataReceived(facebook::jsi::Runtime& runtime,
+                      const std::string& requestId,
+                      size_t dataLength);
 
 // Send loadingFinished event / loadingFinished 이벤트 전송
+// @param finishedTime Monotonic micros the response completed at / 응답이 완료된 모노토닉 마이크로초
 void sendLoadingFinished(facebook::jsi::Runtime& runtime,
                          const std::string& requestId,
-                         const std::string& responseText);
+                         size_t encodedDataLength,
+                         int64_t finishedTime);
 
 // Send loadingFailed event / loadingFailed 이벤트 전송
 void sendLoadingFailed(facebook::jsi::Runtime& runtime,
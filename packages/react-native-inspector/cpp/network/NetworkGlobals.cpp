@@ -15,16 +15,17 @@ namespace network {
 // Global request ID counter / 전역 요청 ID 카운터
 std::atomic<size_t> g_requestIdCounter{1};
 
-// Store response data by requestId / requestId별로 응답 데이터 저장
-std::map<std::string, std::string> g_responseData;
+// Response bodies by requestId / requestId별 응답 본문
+ResponseBodyStore g_responseBodyStore;
 
-// Mutex for thread-safe access to g_responseData / g_responseData에 대한 스레드 안전 접근을 위한 mutex
-std::mutex g_responseDataMutex;
+// IO.read streams over large response bodies / 큰 응답 본문에 대한 IO.read 스트림
+IOStreamRegistry g_ioStreams;
 
-// Track active fetch requests for XHR hook detection / XHR 훅 감지를 위한 활성 fetch 요청 추적
-std::atomic<bool> g_isFetchRequestActive{false};
-std::string g_activeFetchRequestId;
-std::mutex g_fetchRequestMutex;
+// Pending fetch requests for XHR hook detection / XHR 훅 감지를 위한 대기 중인 fetch 요청
+FetchCorrelationRegistry g_fetchCorrelation;
+
+// Native state of tracked XHRs / 추적 중인 XHR의 네이티브 상태
+XHRStateTable g_xhrStates;
 
 } // namespace network
 } // namespace chrome_remote_devtools
@@ -9,9 +9,11 @@
 
 #pragma once
 
+#include "FetchCorrelation.h"
+#include "IOStreams.h"
+#include "ResponseBodyStore.h"
+#include "XHRStateTable.h"
 #include <atomic>
-#include <map>
-#include <mutex>
 #include <string>
 
 namespace chrome_remote_devtools {
@@ -20,16 +22,17 @@ namespace network {
 // Global request ID counter / 전역 요청 ID 카운터
 extern std::atomic<size_t> g_requestIdCounter;
 
-// Store response data by requestId / requestId별로 응답 데이터 저장
-// Thread-safe access via g_responseDataMutex / g_responseDataMutex를 통한 스레드 안전 접근
-extern std::map<std::string, std::string> g_responseData;
-extern std::mutex g_responseDataMutex;
+// Response bodies by requestId (bounded, thread-safe) / requestId별 응답 본문 (제한됨, 스레드 안전)
+extern ResponseBodyStore g_responseBodyStore;
 
-// Track active fetch requests for XHR hook detection / XHR 훅 감지를 위한 활성 fetch 요청 추적
-extern std::atomic<bool> g_isFetchRequestActive;
-// Must be accessed only while holding g_fetchRequestMutex / g_fetchRequestMutex를 보유한 상태에서만 접근해야 함
-extern std::string g_activeFetchRequestId;
-extern std::mutex g_fetchRequestMutex;
+// IO.read streams over large response bodies / 큰 응답 본문에 대한 IO.read 스트림
+extern IOStreamRegistry g_ioStreams;
+
+// Pending fetch requests for XHR hook detection (JS thread only) / XHR 훅 감지를 위한 대기 중인 fetch 요청 (JS 스레드 전용)
+extern FetchCorrelationRegistry g_fetchCorrelation;
+
+// Native state of tracked XHRs (JS thread only) / 추적 중인 XHR의 네이티브 상태 (JS 스레드 전용)
+extern XHRStateTable g_xhrStates;
 
 } // namespace network
 } // namespace chrome_remote_devtools
@@ -9,6 +9,8 @@
 
 #include "NetworkInfoCollector.h"
 #include "NetworkUtils.h"
+#include "../common/Base64.h"
+#include "../common/JSIHandleCache.h"
 #include <string>
 
 // Platform-specific log support / 플랫폼별 로그 지원
@@ -31,30 +33,16 @@
 namespace chrome_remote_devtools {
 namespace network {
 
-// Collect XHR request info from metadata / 메타데이터에서 XHR 요청 정보 수집
-RequestInfo collectXHRRequestInfo(facebook::jsi::Runtime& runtime,
-                                  facebook::jsi::Object& metadata,
-                                  const facebook::jsi::Value* args,
-                                  size_t count) {
-  RequestInfo info;
-  info.method = metadata.getProperty(runtime, "method").asString(runtime).utf8(runtime);
-  info.url = metadata.getProperty(runtime, "url").asString(runtime).utf8(runtime);
-  info.headers = getDefaultHeaders(runtime);
-
-  // Get headers from metadata / 메타데이터에서 헤더 가져오기
-  facebook::jsi::Value headersValue = metadata.getProperty(runtime, "headers");
-  if (headersValue.isObject()) {
-    facebook::jsi::Object headersObj = headersValue.asObject(runtime);
-    facebook::jsi::Array propNames = headersObj.getPropertyNames(runtime);
-    for (size_t i = 0; i < propNames.size(runtime); i++) {
-      facebook::jsi::Value keyValue = propNames.getValueAtIndex(runtime, i);
-      if (keyValue.isString()) {
-        std::string key = keyValue.asString(runtime).utf8(runtime);
-        facebook::jsi::Value valueValue = headersObj.getProperty(runtime, key.c_str());
-        if (valueValue.isString()) {
-          info.headers[key] = valueValue.asString(runtime).utf8(runtime);
-        }
-      }
+// Complete XHR request info at send / send 시 XHR 요청 정보 완성
+void collectXHRRequestInfo(facebook::jsi::Runtime& runtime,
+                           RequestInfo& info,
+                           const facebook::jsi::Value* args,
+                           size_t count) {
+  // Default headers never override headers set by the app / 기본 헤더는 앱이 설정한 헤더를 덮어쓰지 않음
+  HttpHeaders defaults = getDefaultHeaders(runtime);
+  for (const auto& header : defaults) {
+    if (info.headers.get(header.name()).empty()) {
+      info.headers.set(header.name(), header.value);
     }
   }
 
@@ -76,8 +64,6 @@ RequestInfo collectXHRRequestInfo(facebook::jsi::Runtime& runtime,
       }
     }
   }
-
-  return info;
 }
 
 // Collect XHR response info / XHR 응답 정보 수집
@@ -155,15 +141,30 @@ ResponseInfo collectXHRResponseInfo(facebook::jsi::Runtime& runtime,
           }
         }
       }
-      // Case 4: responseType is 'arraybuffer' - use internal _response / 케이스 4: responseType이 'arraybuffer' - 내부 _response 사용
+      // Case 4: responseType is 'arraybuffer' - copy bytes straight out of the ArrayBuffer /
+      // 케이스 4: responseType이 'arraybuffer' - ArrayBuffer에서 바이트를 바로 복사
+      // Bytes are stored raw and base64-encoded only if DevTools asks for the body /
+      // 바이트는 원시 형태로 저장되며 DevTools가 본문을 요청할 때만 base64로 인코딩됨
       else if (responseType == "arraybuffer") {
-        // For arraybuffer, access internal _response property / arraybuffer의 경우 내부 _response 속성에 접근
-        // Check if _response property exists before accessing / 접근 전에 _response 속성이 존재하는지 확인
-        if (xhrObj.hasProperty(runtime, "_response")) {
+        if (responseValue.isObject() && responseValue.getObject(runtime).isArrayBuffer(runtime)) {
+          facebook::jsi::ArrayBuffer buffer = responseValue.getObject(runtime).getArrayBuffer(runtime);
+          size_t size = buffer.size(runtime);
+          if (size > 0) {
+            info.responseText.assign(reinterpret_cast<const char*>(buffer.data(runtime)), size);
+          }
+          info.binary = true;
+          LOGI("NetworkInfoCollector: Collected response (arraybuffer): length=%zu / 응답 수집됨 (arraybuffer): 길이=%zu", size, size);
+        } else if (xhrObj.hasProperty(runtime, "_response")) {
+          // Native networking delivers arraybuffer bodies base64-encoded in _response / 네이티브 네트워킹은 arraybuffer 본문을 _response에 base64로 전달함
           facebook::jsi::Value internalResponseValue = xhrObj.getProperty(runtime, "_response");
           if (internalResponseValue.isString()) {
-            info.responseText = internalResponseValue.asString(runtime).utf8(runtime);
-            LOGI("NetworkInfoCollector: Collected response (arraybuffer): length=%zu / 응답 수집됨 (arraybuffer): 길이=%zu", info.responseText.length(), info.responseText.length());
+            std::string encoded = internalResponseValue.asString(runtime).utf8(runtime);
+            if (common::base64Decode(encoded.data(), encoded.size(), info.responseText)) {
+              info.binary = true;
+            } else {
+              info.responseText.clear();
+              LOGW("NetworkInfoCollector: _response for arraybuffer is not base64 / arraybuffer용 _response가 base64가 아님");
+            }
           } else {
             LOGW("NetworkInfoCollector: _response for arraybuffer is not a string / arraybuffer용 _response가 문자열이 아님");
           }
@@ -200,7 +201,7 @@ ResponseInfo collectXHRResponseInfo(facebook::jsi::Runtime& runtime,
     // Get headers / 헤더 가져오기
     std::string allHeaders;
     try {
-      facebook::jsi::Value getAllResponseHeadersValue = xhrObj.getProperty(runtime, "getAllResponseHeaders");
+      facebook::jsi::Value getAllResponseHeadersValue = common::getCachedProperty(runtime, xhrObj, common::PropName::GetAllResponseHeaders);
       if (getAllResponseHeadersValue.isObject() && getAllResponseHeadersValue.asObject(runtime).isFunction(runtime)) {
         facebook::jsi::Function getAllResponseHeaders = getAllResponseHeadersValue.asObject(runtime).asFunction(runtime);
         facebook::jsi::Value headersValue = getAllResponseHeaders.callWithThis(runtime, xhrObj);
@@ -226,15 +227,8 @@ ResponseInfo collectXHRResponseInfo(facebook::jsi::Runtime& runtime,
     }
     info.headers = formatResponseHeaders(allHeaders);
 
-    // Get content type / Content-Type 가져오기
-    facebook::jsi::Value getResponseHeaderValue = xhrObj.getProperty(runtime, "getResponseHeader");
-    if (getResponseHeaderValue.isObject() && getResponseHeaderValue.asObject(runtime).isFunction(runtime)) {
-      facebook::jsi::Function getResponseHeader = getResponseHeaderValue.asObject(runtime).asFunction(runtime);
-      facebook::jsi::Value contentTypeValue = getResponseHeader.call(runtime, facebook::jsi::String::createFromUtf8(runtime, "content-type"));
-      if (contentTypeValue.isString()) {
-        info.contentType = contentTypeValue.asString(runtime).utf8(runtime);
-      }
-    }
+    // Get content type from parsed headers, no extra getResponseHeader call / 파싱된 헤더에서 Content-Type 가져오기, 추가 getResponseHeader 호출 없음
+    info.contentType = std::string(info.headers.get(HeaderName::ContentType));
   } catch (...) {
     // Failed to get response properties / 응답 속성 가져오기 실패
   }
@@ -275,7 +269,7 @@ RequestInfo collectFetchRequestInfo(facebook::jsi::Runtime& runtime,
           std::string key = keyValue.asString(runtime).utf8(runtime);
           facebook::jsi::Value valueValue = headersObj.getProperty(runtime, key.c_str());
           if (valueValue.isString()) {
-            info.headers[key] = valueValue.asString(runtime).utf8(runtime);
+            info.headers.set(key, valueValue.asString(runtime).utf8(runtime));
           }
         }
       }
@@ -299,7 +293,7 @@ RequestInfo collectFetchRequestInfo(facebook::jsi::Runtime& runtime,
           std::string key = keyValue.asString(runtime).utf8(runtime);
           facebook::jsi::Value valueValue = headersObj.getProperty(runtime, key.c_str());
           if (valueValue.isString()) {
-            info.headers[key] = valueValue.asString(runtime).utf8(runtime);
+            info.headers.set(key, valueValue.asString(runtime).utf8(runtime));
           }
         }
       }
@@ -334,7 +328,6 @@ ResponseInfo collectFetchResponseInfo(facebook::jsi::Runtime& runtime,
   info.statusText = "";
   info.responseText = "";
   info.contentType = "";
-  info.headers = folly::dynamic::object;
 
   try {
     facebook::jsi::Value statusValue = response.getProperty(runtime, "status");
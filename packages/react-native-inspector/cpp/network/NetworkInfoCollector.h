@@ -15,11 +15,13 @@
 namespace chrome_remote_devtools {
 namespace network {
 
-// Collect XHR request info from metadata / 메타데이터에서 XHR 요청 정보 수집
-RequestInfo collectXHRRequestInfo(facebook::jsi::Runtime& runtime,
-                                  facebook::jsi::Object& metadata,
-                                  const facebook::jsi::Value* args,
-                                  size_t count);
+// Complete XHR request info at send with default headers and post data / send 시 기본 헤더와 POST 데이터로 XHR 요청 정보 완성
+// Method, URL and headers were already recorded natively by open and setRequestHeader /
+// method, URL, 헤더는 open과 setRequestHeader에서 이미 네이티브로 기록됨
+void collectXHRRequestInfo(facebook::jsi::Runtime& runtime,
+                           RequestInfo& info,
+                           const facebook::jsi::Value* args,
+                           size_t count);
 
 // Collect XHR response info / XHR 응답 정보 수집
 ResponseInfo collectXHRResponseInfo(facebook::jsi::Runtime& runtime,
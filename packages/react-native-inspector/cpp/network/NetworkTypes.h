@@ -9,8 +9,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
-#include <folly/dynamic.h>
+#include "HttpHeaders.h"
 
 namespace chrome_remote_devtools {
 namespace network {
@@ -19,17 +20,30 @@ namespace network {
 struct RequestInfo {
   std::string method;
   std::string url;
-  folly::dynamic headers;
+  HttpHeaders headers;
   std::string postData;
 };
 
+// Phase times of a request in monotonic microseconds (common::monotonicMicros), 0 if not reached /
+// 요청 단계별 시간 (common::monotonicMicros 기준 마이크로초), 도달하지 않았으면 0
+// Emitted as CDP ResourceTiming, phases below the JS layer (DNS, connect, TLS) are not observable /
+// CDP ResourceTiming으로 전송되며, JS 계층 아래 단계 (DNS, 연결, TLS)는 관찰할 수 없음
+struct RequestTiming {
+  int64_t requestTime = 0;        // fetch() or XHR send() called / fetch() 또는 XHR send() 호출
+  int64_t sendStart = 0;          // Original send() entered / 원본 send() 진입
+  int64_t sendEnd = 0;            // Original send() returned, request handed to native networking / 원본 send() 반환, 네이티브 네트워킹에 요청 전달
+  int64_t receiveHeadersEnd = 0;  // readyState HEADERS_RECEIVED (2) / readyState HEADERS_RECEIVED (2)
+  int64_t finished = 0;           // readyState DONE (4) / readyState DONE (4)
+};
+
 // Response info structure / 응답 정보 구조체
 struct ResponseInfo {
   int status;
   std::string statusText;
   std::string responseText;
-  folly::dynamic headers;
+  HttpHeaders headers;
   std::string contentType;
+  bool binary = false;  // responseText holds raw bytes (arraybuffer) / responseText가 원시 바이트를 담음 (arraybuffer)
 };
 
 } // namespace network
@@ -8,8 +8,8 @@
  */
 
 #include "NetworkUtils.h"
-#include <chrono>
-#include <sstream>
+#include "../common/Clock.h"
+#include "../common/JSIHandleCache.h"
 #include <string>
 
 // Platform-specific log support / 플랫폼별 로그 지원
@@ -33,11 +33,9 @@
 namespace chrome_remote_devtools {
 namespace network {
 
-// Get timestamp in seconds / 초 단위 타임스탬프 가져오기
+// Get monotonic timestamp in seconds / 모노토닉 초 단위 타임스탬프 가져오기
 double getTimestamp() {
-  return std::chrono::duration_cast<std::chrono::milliseconds>(
-    std::chrono::system_clock::now().time_since_epoch()
-  ).count() / 1000.0;
+  return common::monotonicSeconds();
 }
 
 // Get server host and port from global / 전역에서 서버 호스트와 포트 가져오기
@@ -45,11 +43,12 @@ void getServerInfo(facebook::jsi::Runtime& runtime, std::string& serverHost, int
   serverHost = "localhost";
   serverPort = 8080;
   try {
-    facebook::jsi::Value hostValue = runtime.global().getProperty(runtime, "__ChromeRemoteDevToolsServerHost");
+    facebook::jsi::Object global = runtime.global();
+    facebook::jsi::Value hostValue = common::getCachedProperty(runtime, global, common::PropName::ServerHost);
     if (hostValue.isString()) {
       serverHost = hostValue.asString(runtime).utf8(runtime);
     }
-    facebook::jsi::Value portValue = runtime.global().getProperty(runtime, "__ChromeRemoteDevToolsServerPort");
+    facebook::jsi::Value portValue = common::getCachedProperty(runtime, global, common::PropName::ServerPort);
     if (portValue.isNumber()) {
       serverPort = static_cast<int>(portValue.asNumber());
     }
@@ -59,8 +58,8 @@ void getServerInfo(facebook::jsi::Runtime& runtime, std::string& serverHost, int
 }
 
 // Get default headers / 기본 헤더 가져오기
-folly::dynamic getDefaultHeaders(facebook::jsi::Runtime& runtime) {
-  folly::dynamic headers = folly::dynamic::object;
+HttpHeaders getDefaultHeaders(facebook::jsi::Runtime& runtime) {
+  HttpHeaders headers;
   try {
     // Try to get User-Agent from navigator / navigator에서 User-Agent 가져오기 시도
     facebook::jsi::Value navigatorValue = runtime.global().getProperty(runtime, "navigator");
@@ -68,37 +67,20 @@ folly::dynamic getDefaultHeaders(facebook::jsi::Runtime& runtime) {
       facebook::jsi::Object navigator = navigatorValue.asObject(runtime);
       facebook::jsi::Value userAgentValue = navigator.getProperty(runtime, "userAgent");
       if (userAgentValue.isString()) {
-        headers["User-Agent"] = userAgentValue.asString(runtime).utf8(runtime);
+        headers.set("User-Agent", userAgentValue.asString(runtime).utf8(runtime));
       }
     }
   } catch (...) {
     // Use default / 기본값 사용
-    headers["User-Agent"] = "ReactNative";
+    headers.set("User-Agent", "ReactNative");
   }
   return headers;
 }
 
 // Format response headers / 응답 헤더 포맷팅
-folly::dynamic formatResponseHeaders(const std::string& headerString) {
-  folly::dynamic headers = folly::dynamic::object;
-  std::istringstream stream(headerString);
-  std::string line;
-  while (std::getline(stream, line)) {
-    if (line.empty() || line == "\r") continue;
-    size_t colonPos = line.find(':');
-    if (colonPos != std::string::npos) {
-      std::string key = line.substr(0, colonPos);
-      std::string value = line.substr(colonPos + 1);
-      // Trim whitespace / 공백 제거
-      key.erase(0, key.find_first_not_of(" \t\r\n"));
-      key.erase(key.find_last_not_of(" \t\r\n") + 1);
-      value.erase(0, value.find_first_not_of(" \t\r\n"));
-      value.erase(value.find_last_not_of(" \t\r\n") + 1);
-      if (!key.empty()) {
-        headers[key] = value;
-      }
-    }
-  }
+HttpHeaders formatResponseHeaders(const std::string& headerString) {
+  HttpHeaders headers;
+  parseHeaderBlock(headerString, headers);
   return headers;
 }
 
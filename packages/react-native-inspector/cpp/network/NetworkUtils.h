@@ -11,22 +11,22 @@
 
 #include <jsi/jsi.h>
 #include <string>
-#include <folly/dynamic.h>
+#include "HttpHeaders.h"
 
 namespace chrome_remote_devtools {
 namespace network {
 
-// Get timestamp in seconds / 초 단위 타임스탬프 가져오기
+// Get monotonic timestamp in seconds (CDP MonotonicTime, see common/Clock.h) / 모노토닉 초 단위 타임스탬프 가져오기 (CDP MonotonicTime, common/Clock.h 참고)
 double getTimestamp();
 
 // Get server host and port from global / 전역에서 서버 호스트와 포트 가져오기
 void getServerInfo(facebook::jsi::Runtime& runtime, std::string& serverHost, int& serverPort);
 
 // Get default headers / 기본 헤더 가져오기
-folly::dynamic getDefaultHeaders(facebook::jsi::Runtime& runtime);
+HttpHeaders getDefaultHeaders(facebook::jsi::Runtime& runtime);
 
 // Format response headers / 응답 헤더 포맷팅
-folly::dynamic formatResponseHeaders(const std::string& headerString);
+HttpHeaders formatResponseHeaders(const std::string& headerString);
 
 // Calculate encoded data length / 인코딩된 데이터 길이 계산
 size_t calculateEncodedDataLength(const std::string& contentLength, const std::string& body);
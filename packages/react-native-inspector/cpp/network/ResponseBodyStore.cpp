@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "ResponseBodyStore.h"
+#include "../common/Base64.h"
+#include "../common/Hash64.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <iterator>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "ResponseBodyStore"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "ResponseBodyStore"
+#define LOGI(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+namespace network {
+
+// Spill files live in their own subdirectory of the cache directory / spill 파일은 캐시 디렉토리의 별도 하위 디렉토리에 있음
+static constexpr const char* kSpillSubdirectory = "chrome-remote-devtools-bodies";
+static constexpr const char* kSpillFilePrefix = "body-";
+
+ResponseBodyStore::~ResponseBodyStore() {
+  clear();
+}
+
+void ResponseBodyStore::put(const std::string& requestId, std::string body, bool binary) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  putLocked(requestId, std::move(body), binary);
+}
+
+void ResponseBodyStore::putIfAbsent(const std::string& requestId, std::string body, bool binary) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(requestId);
+  if (it != entries_.end() && it->second.blob->size > 0) {
+    return;
+  }
+  putLocked(requestId, std::move(body), binary);
+}
+
+bool ResponseBodyStore::size(const std::string& requestId, size_t& size) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(requestId);
+  if (it == entries_.end()) {
+    return false;
+  }
+  size = it->second.blob->size;
+  return true;
+}
+
+bool ResponseBodyStore::isBinary(const std::string& requestId) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(requestId);
+  return it != entries_.end() && it->second.binary;
+}
+
+std::string ResponseBodyStore::take(const std::string& requestId, bool& base64Encoded) {
+  base64Encoded = false;
+  std::string body;
+  bool binary = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(requestId);
+    if (it == entries_.end()) {
+      return "";
+    }
+    Blob* blob = it->second.blob;
+    binary = it->second.binary;
+    if (blob->refs == 1 && !blob->spilled()) {
+      // Last reference, no copy needed / 마지막 참조이므로 복사 불필요
+      body = std::move(blob->body);
+    } else {
+      body.assign(blob->data(), blob->size);
+    }
+    eraseLocked(it);
+  }
+  if (!binary) {
+    return body;
+  }
+  // Encoding a large body takes far longer than the copy, keep it out of the lock /
+  // 큰 본문의 인코딩은 복사보다 훨씬 오래 걸리므로 잠금 밖에서 수행
+  base64Encoded = true;
+  return common::base64Encode(body.data(), body.size());
+}
+
+bool ResponseBodyStore::read(const std::string& requestId, size_t offset, size_t length, std::string& out) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(requestId);
+  if (it == entries_.end()) {
+    return false;
+  }
+  const Blob* blob = it->second.blob;
+  if (offset >= blob->size) {
+    out.clear();
+    return true;
+  }
+  // Spilled bodies are read straight from the mapping / spill된 본문은 매핑에서 바로 읽음
+  out.assign(blob->data() + offset, std::min(length, blob->size - offset));
+  return true;
+}
+
+void ResponseBodyStore::erase(const std::string& requestId) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(requestId);
+  if (it != entries_.end()) {
+    eraseLocked(it);
+  }
+}
+
+void ResponseBodyStore::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  while (!entries_.empty()) {
+    eraseLocked(entries_.begin());
+  }
+}
+
+void ResponseBodyStore::setBudget(const ResponseBodyBudget& budget) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  budget_ = budget;
+}
+
+ResponseBodyBudget ResponseBodyStore::budget() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return budget_;
+}
+
+void ResponseBodyStore::setSpillDirectory(const std::string& directory) {
+  std::string spillDirectory;
+  if (!directory.empty()) {
+    spillDirectory = directory + "/" + kSpillSubdirectory;
+    if (::mkdir(spillDirectory.c_str(), 0700) != 0 && errno != EEXIST) {
+      LOGW("Failed to create spill directory, spilling disabled / spill 디렉토리 생성 실패, spill 비활성화: %s",
+           spillDirectory.c_str());
+      spillDirectory.clear();
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (spillDirectory == spillDirectory_) {
+    return;
+  }
+  spillDirectory_ = spillDirectory;
+  if (spillDirectory_.empty()) {
+    return;
+  }
+
+  // Remove files left by a previous process; files of this process are always mapped /
+  // 이전 프로세스가 남긴 파일 삭제, 이 프로세스의 파일은 항상 매핑되어 있음
+  if (DIR* dir = ::opendir(spillDirectory_.c_str())) {
+    size_t prefixLength = std::strlen(kSpillFilePrefix);
+    while (struct dirent* file = ::readdir(dir)) {
+      if (std::strncmp(file->d_name, kSpillFilePrefix, prefixLength) != 0) {
+        continue;
+      }
+      std::string path = spillDirectory_ + "/" + file->d_name;
+      bool inUse = false;
+      for (const auto& blob : blobs_) {
+        if (blob.second->spillPath == path) {
+          inUse = true;
+          break;
+        }
+      }
+      if (!inUse) {
+        ::unlink(path.c_str());
+      }
+    }
+    ::closedir(dir);
+  }
+  LOGI("Spilling large response bodies to / 큰 응답 본문 spill 위치: %s", spillDirectory_.c_str());
+}
+
+size_t ResponseBodyStore::memoryBytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return memoryBytes_;
+}
+
+size_t ResponseBodyStore::spillBytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return spillBytes_;
+}
+
+void ResponseBodyStore::putLocked(const std::string& requestId, std::string body, bool binary) {
+  auto existing = entries_.find(requestId);
+  if (existing != entries_.end()) {
+    eraseLocked(existing);
+  }
+
+  size_t size = body.size();
+  Blob* blob = acquireBlobLocked(std::move(body));
+  if (blob == nullptr) {
+    LOGW("Dropping body larger than budget / 예산보다 큰 본문 삭제: %s, %zu bytes", requestId.c_str(), size);
+    (void)size;
+    return;
+  }
+
+  lru_.push_front(requestId);
+  entries_.emplace(requestId, Entry{blob, lru_.begin(), binary});
+  enforceBudgetLocked();
+}
+
+ResponseBodyStore::Blob* ResponseBodyStore::acquireBlobLocked(std::string body) {
+  uint64_t hash = common::hash64(body.data(), body.size());
+
+  // Same content already stored: share it / 같은 내용이 이미 저장됨: 공유
+  // Bytes are compared as well, a hash collision must never mix up bodies / 바이트도 비교하여 해시 충돌로 본문이 섞이지 않도록 함
+  auto range = blobs_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    Blob* blob = it->second.get();
+    if (blob->size == body.size() && std::memcmp(blob->data(), body.data(), body.size()) == 0) {
+      blob->refs++;
+      return blob;
+    }
+  }
+
+  size_t size = body.size();
+  bool spill = size > budget_.spillThresholdBytes && !spillDirectory_.empty();
+  if (spill && size > budget_.maxSpillBytes) {
+    return nullptr;
+  }
+
+  auto blob = std::make_unique<Blob>();
+  blob->size = size;
+  blob->hash = hash;
+  blob->refs = 1;
+  blob->body = std::move(body);
+  if (spill && spillLocked(*blob)) {
+    std::string().swap(blob->body);
+    spillBytes_ += size;
+  } else {
+    if (size > budget_.maxMemoryBytes) {
+      return nullptr;
+    }
+    memoryBytes_ += size;
+  }
+
+  Blob* raw = blob.get();
+  blobs_.emplace(hash, std::move(blob));
+  return raw;
+}
+
+void ResponseBodyStore::releaseBlobLocked(Blob* blob) {
+  if (--blob->refs > 0) {
+    return;
+  }
+  if (blob->spilled()) {
+    spillBytes_ -= blob->size;
+    unmap(*blob);
+  } else {
+    memoryBytes_ -= blob->size;
+  }
+  auto range = blobs_.equal_range(blob->hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second.get() == blob) {
+      blobs_.erase(it);
+      break;
+    }
+  }
+}
+
+void ResponseBodyStore::eraseLocked(std::unordered_map<std::string, Entry>::iterator it) {
+  releaseBlobLocked(it->second.blob);
+  lru_.erase(it->second.lruPosition);
+  entries_.erase(it);
+}
+
+void ResponseBodyStore::enforceBudgetLocked() {
+  // Walk from the least recently stored request and only evict the kind that is over budget.
+  // A shared body is freed once its last request is evicted /
+  // 가장 오래전에 저장된 요청부터 순회하며 예산을 초과한 종류만 제거.
+  // 공유된 본문은 마지막 요청이 제거될 때 해제됨
+  auto position = lru_.end();
+  while ((memoryBytes_ > budget_.maxMemoryBytes || spillBytes_ > budget_.maxSpillBytes) && position != lru_.begin()) {
+    --position;
+    auto it = entries_.find(*position);
+    if (it == entries_.end()) {
+      continue;
+    }
+    bool overBudget = it->second.blob->spilled() ? spillBytes_ > budget_.maxSpillBytes
+                                                 : memoryBytes_ > budget_.maxMemoryBytes;
+    if (!overBudget) {
+      continue;
+    }
+    // Erasing invalidates position, continue from its successor / 삭제하면 position이 무효화되므로 다음 원소부터 계속
+    auto next = std::next(position);
+    eraseLocked(it);
+    position = next;
+  }
+}
+
+bool ResponseBodyStore::spillLocked(Blob& blob) {
+  const std::string& body = blob.body;
+  if (spillDirectory_.empty() || body.empty()) {
+    return false;
+  }
+
+  std::string path = spillDirectory_ + "/" + kSpillFilePrefix + std::to_string(++spillFileCounter_);
+  int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  if (fd < 0) {
+    LOGW("Failed to create spill file / spill 파일 생성 실패: %s", path.c_str());
+    return false;
+  }
+
+  // write() instead of writing through the mapping, so a full disk fails here instead of raising SIGBUS /
+  // 디스크가 가득 찬 경우 SIGBUS 대신 여기서 실패하도록 매핑이 아닌 write() 사용
+  size_t written = 0;
+  while (written < body.size()) {
+    ssize_t result = ::write(fd, body.data() + written, body.size() - written);
+    if (result < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+    written += static_cast<size_t>(result);
+  }
+
+  void* mapping = MAP_FAILED;
+  if (written == body.size()) {
+    mapping = ::mmap(nullptr, body.size(), PROT_READ, MAP_SHARED, fd, 0);
+  }
+  ::close(fd);
+
+  if (mapping == MAP_FAILED) {
+    LOGW("Failed to spill body, keeping it in memory / 본문 spill 실패, 메모리에 유지: %s", path.c_str());
+    ::unlink(path.c_str());
+    return false;
+  }
+
+  blob.mapped = static_cast<const char*>(mapping);
+  blob.spillPath = std::move(path);
+  return true;
+}
+
+void ResponseBodyStore::unmap(Blob& blob) {
+  if (blob.mapped != nullptr) {
+    ::munmap(const_cast<char*>(blob.mapped), blob.size);
+    blob.mapped = nullptr;
+  }
+  if (!blob.spillPath.empty()) {
+    ::unlink(blob.spillPath.c_str());
+    blob.spillPath.clear();
+  }
+}
+
+} // namespace network
+} // namespace chrome_remote_devtools
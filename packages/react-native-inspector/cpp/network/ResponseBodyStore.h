@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace chrome_remote_devtools {
+namespace network {
+
+// Budget of the response body store / 응답 본문 저장소의 예산
+struct ResponseBodyBudget {
+  size_t maxMemoryBytes = 32 * 1024 * 1024;   // Bodies kept in native heap / 네이티브 힙에 보관되는 본문
+  size_t spillThresholdBytes = 256 * 1024;    // Larger bodies go to disk / 이보다 큰 본문은 디스크로
+  size_t maxSpillBytes = 128 * 1024 * 1024;   // Bodies kept on disk / 디스크에 보관되는 본문
+};
+
+// Response bodies by requestId until Network.getResponseBody takes them / Network.getResponseBody가 가져갈 때까지 requestId별 응답 본문
+// Bodies are content-addressed: identical payloads (polled endpoints) share one refcounted copy, and
+// budgets count each distinct body once / 본문은 내용 주소 기반: 동일한 페이로드(폴링 엔드포인트)는
+// 참조 카운트된 하나의 복사본을 공유하며, 예산은 고유 본문마다 한 번만 계산됨
+// Least recently stored requests are evicted once the budget is exceeded. Large bodies spill to an
+// mmap'd file in the spill directory (app cache directory) so they do not stay in the native heap /
+// 예산을 초과하면 가장 오래전에 저장된 요청부터 제거. 큰 본문은 네이티브 힙에 남지 않도록
+// spill 디렉토리(앱 캐시 디렉토리)의 mmap 파일로 옮겨짐
+// Thread-safe / 스레드 안전
+class ResponseBodyStore {
+public:
+  ResponseBodyStore() = default;
+  ~ResponseBodyStore();
+
+  ResponseBodyStore(const ResponseBodyStore&) = delete;
+  ResponseBodyStore& operator=(const ResponseBodyStore&) = delete;
+
+  // Store body, replacing any previous body of requestId / 본문 저장, requestId의 이전 본문은 대체
+  // Binary bodies (arraybuffer) are kept as raw bytes and base64-encoded only when taken /
+  // 바이너리 본문(arraybuffer)은 원시 바이트로 보관되며 가져갈 때만 base64 인코딩됨
+  void put(const std::string& requestId, std::string body, bool binary = false);
+
+  // Store body unless a non-empty body is already stored / 비어 있지 않은 본문이 이미 있으면 저장하지 않음
+  void putIfAbsent(const std::string& requestId, std::string body, bool binary = false);
+
+  // Size of stored body / 저장된 본문 크기
+  // @return false if not stored / 저장되지 않았으면 false
+  bool size(const std::string& requestId, size_t& size) const;
+
+  // Whether stored body is binary / 저장된 본문이 바이너리인지 여부
+  bool isBinary(const std::string& requestId) const;
+
+  // Remove and return body as DevTools expects it, or empty string / 본문을 제거하고 DevTools가 기대하는 형태로 반환, 없으면 빈 문자열
+  // Binary bodies are base64-encoded after the lock is released, so put() is never held up by an encode /
+  // 바이너리 본문은 잠금 해제 후 base64 인코딩되므로 put()이 인코딩 때문에 지연되지 않음
+  std::string take(const std::string& requestId, bool& base64Encoded);
+
+  // Copy up to length raw bytes starting at offset, without removing the body (IO.read) /
+  // 본문을 제거하지 않고 offset부터 최대 length 원시 바이트 복사 (IO.read)
+  // @return false if not stored / 저장되지 않았으면 false
+  bool read(const std::string& requestId, size_t offset, size_t length, std::string& out) const;
+
+  // Remove body / 본문 제거
+  void erase(const std::string& requestId);
+
+  // Drop all bodies and spill files / 모든 본문과 spill 파일 삭제
+  void clear();
+
+  // Budget, applied on the next put / 예산, 다음 put 시 적용
+  void setBudget(const ResponseBodyBudget& budget);
+  ResponseBodyBudget budget() const;
+
+  // Directory for spill files, empty disables spilling / spill 파일 디렉토리, 비어 있으면 spill 비활성화
+  void setSpillDirectory(const std::string& directory);
+
+  // Bytes of distinct bodies / 고유 본문의 바이트
+  size_t memoryBytes() const;
+  size_t spillBytes() const;
+
+private:
+  // One distinct body, shared by every request that returned it / 하나의 고유 본문, 이를 반환한 모든 요청이 공유
+  struct Blob {
+    std::string body;              // In-memory body / 메모리 본문
+    const char* mapped = nullptr;  // Read-only mapping of spill file / spill 파일의 읽기 전용 매핑
+    size_t size = 0;
+    uint64_t hash = 0;
+    size_t refs = 0;
+    std::string spillPath;
+
+    bool spilled() const { return mapped != nullptr; }
+    const char* data() const { return spilled() ? mapped : body.data(); }
+  };
+
+  struct Entry {
+    Blob* blob;
+    std::list<std::string>::iterator lruPosition;
+    bool binary;
+  };
+
+  void putLocked(const std::string& requestId, std::string body, bool binary);
+  Blob* acquireBlobLocked(std::string body);
+  void releaseBlobLocked(Blob* blob);
+  void eraseLocked(std::unordered_map<std::string, Entry>::iterator it);
+  void enforceBudgetLocked();
+  bool spillLocked(Blob& blob);
+  static void unmap(Blob& blob);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+  std::unordered_multimap<uint64_t, std::unique_ptr<Blob>> blobs_;  // Keyed by content hash / 내용 해시로 조회
+  std::list<std::string> lru_;  // Front is most recently stored / 앞쪽이 가장 최근 저장
+  ResponseBodyBudget budget_;
+  std::string spillDirectory_;
+  size_t memoryBytes_ = 0;
+  size_t spillBytes_ = 0;
+  uint64_t spillFileCounter_ = 0;
+};
+
+} // namespace network
+} // namespace chrome_remote_devtools
@@ -13,6 +13,12 @@
 #include "NetworkInfoCollector.h"
 #include "NetworkEventSender.h"
 #include "NetworkGlobals.h"
+#include "../common/Clock.h"
+#include "../common/JSIHandleCache.h"
+#include "../common/HookMetrics.h"
+#include "../common/OverheadGovernor.h"
+#include "../common/DomainSubscriptions.h"
+#include <memory>
 #include <vector>
 
 // Platform-specific log support / 플랫폼별 로그 지원
@@ -36,6 +42,128 @@
 namespace chrome_remote_devtools {
 namespace network {
 
+// Call original XMLHttpRequest.prototype method / 원본 XMLHttpRequest.prototype 메서드 호출
+// Uses the function captured at installation; the prototype backup is only a fallback /
+// 설치 시 캡처된 함수를 사용하며, prototype 백업은 대체 수단일 뿐임
+static facebook::jsi::Value callOriginalXHRMethod(facebook::jsi::Runtime& rt,
+                                                  common::CachedFunction slot,
+                                                  const char* backupPropName,
+                                                  const facebook::jsi::Value& thisVal,
+                                                  const facebook::jsi::Value* args,
+                                                  size_t count) {
+  facebook::jsi::Object xhr = thisVal.asObject(rt);
+  if (const facebook::jsi::Function* original = common::getCachedFunction(rt, slot)) {
+    return original->callWithThis(rt, xhr, args, count);
+  }
+  facebook::jsi::Value xhrConstructorValue = rt.global().getProperty(rt, "XMLHttpRequest");
+  if (xhrConstructorValue.isObject()) {
+    facebook::jsi::Object xhrConstructor = xhrConstructorValue.asObject(rt);
+    facebook::jsi::Value prototypeValue = xhrConstructor.getProperty(rt, "prototype");
+    if (prototypeValue.isObject()) {
+      facebook::jsi::Object prototype = prototypeValue.asObject(rt);
+      facebook::jsi::Value originalValue = prototype.getProperty(rt, backupPropName);
+      if (originalValue.isObject() && originalValue.asObject(rt).isFunction(rt)) {
+        facebook::jsi::Function original = originalValue.asObject(rt).asFunction(rt);
+        return original.callWithThis(rt, xhr, args, count);
+      }
+    }
+  }
+  return facebook::jsi::Value::undefined();
+}
+
+// Key of native state stored on XHR instance, 0 if untracked / XHR 인스턴스에 저장된 네이티브 상태 키, 추적하지 않으면 0
+static uint32_t getStateKey(facebook::jsi::Runtime& rt, const facebook::jsi::Object& xhr) {
+  facebook::jsi::Value keyValue = common::getCachedProperty(rt, xhr, common::PropName::CdpNetworkState);
+  return keyValue.isNumber() ? static_cast<uint32_t>(keyValue.getNumber()) : 0;
+}
+
+// Reason of a DONE transition with status 0 / status 0인 DONE 전환의 원인
+// React Native's XMLHttpRequest sets _timedOut / _aborted before DONE / React Native의 XMLHttpRequest는 DONE 전에 _timedOut / _aborted를 설정함
+static const char* failureText(facebook::jsi::Runtime& rt, const facebook::jsi::Object& xhr) {
+  try {
+    facebook::jsi::Value timedOut = xhr.getProperty(rt, "_timedOut");
+    if (timedOut.isBool() && timedOut.getBool()) {
+      return "Request timeout";
+    }
+    facebook::jsi::Value aborted = xhr.getProperty(rt, "_aborted");
+    if (aborted.isBool() && aborted.getBool()) {
+      return "Request aborted";
+    }
+  } catch (...) {
+    // Fall back to generic error / 일반 에러로 대체
+  }
+  return "Network error";
+}
+
+// Shared readystatechange handler, collects the response once at DONE / 공유 readystatechange 핸들러, DONE에서 응답을 한 번 수집
+// Follows React Native's XHRInterceptor, which also reads the response at DONE / DONE에서 응답을 읽는 React Native의 XHRInterceptor를 따름
+static void handleReadyStateChange(facebook::jsi::Runtime& runtime, facebook::jsi::Object& xhrObj) {
+  // readystatechange fires for every progress event, only HEADERS_RECEIVED (2) and DONE (4) matter /
+  // readystatechange는 진행 이벤트마다 발생하며 HEADERS_RECEIVED (2)와 DONE (4)만 중요함
+  int64_t now = common::monotonicMicros();
+  facebook::jsi::Value readyStateValue = common::getCachedProperty(runtime, xhrObj, common::PropName::ReadyState);
+  if (!readyStateValue.isNumber()) {
+    return;
+  }
+  double readyState = readyStateValue.getNumber();
+  if (readyState != 2 && readyState != 4) {
+    return;
+  }
+  uint32_t key = getStateKey(runtime, xhrObj);
+  XHRState* state = g_xhrStates.find(key);
+  if (state == nullptr || !state->sent) {
+    return;
+  }
+  if (readyState == 2) {
+    state->timing.receiveHeadersEnd = now;
+    return;
+  }
+  std::string requestId = std::move(state->requestId);
+  std::string url = std::move(state->request.url);
+  bool isFetchRequest = state->isFetchRequest;
+  RequestTiming timing = state->timing;
+  timing.finished = now;
+  if (timing.receiveHeadersEnd == 0) {
+    // Headers and body arrived in the same tick / 헤더와 본문이 같은 틱에 도착함
+    timing.receiveHeadersEnd = now;
+  }
+  g_xhrStates.erase(key);
+
+  // Status, headers and body in a single pass / 상태, 헤더, 본문을 한 번에 수집
+  ResponseInfo responseInfo = collectXHRResponseInfo(runtime, xhrObj);
+
+  // XHR status is 0 for network errors, timeouts and aborts / 네트워크 에러, 타임아웃, 중단 시 XHR status는 0
+  if (responseInfo.status == 0) {
+    const char* errorText = failureText(runtime, xhrObj);
+    LOGI("XHR failed (status=0) - sending loadingFailed: %s / XHR 실패 (status=0) - loadingFailed 전송: %s", errorText, errorText);
+    sendLoadingFailed(runtime, requestId, errorText, "XHR");
+    return;
+  }
+
+  // Body is only served on demand by Network.getResponseBody, events carry its length /
+  // 본문은 Network.getResponseBody 요청 시에만 제공되며 이벤트에는 길이만 포함됨
+  size_t bodyLength = 0;
+  if (isFetchRequest) {
+    // For fetch requests, body is stored by Fetch hook / Fetch 요청의 경우 본문은 Fetch 훅에서 저장
+    // It may not be stored yet, the polyfill's responseText has the same length /
+    // 아직 저장되지 않았을 수 있으며, polyfill의 responseText 길이가 동일함
+    if (!g_responseBodyStore.size(requestId, bodyLength)) {
+      bodyLength = responseInfo.responseText.size();
+    }
+  } else {
+    // Store response data for regular XHR requests / 일반 XHR 요청에 대한 응답 데이터 저장
+    bodyLength = responseInfo.responseText.size();
+    if (!responseInfo.responseText.empty() && common::shouldKeepResponseBody(bodyLength)) {
+      g_responseBodyStore.put(requestId, std::move(responseInfo.responseText), responseInfo.binary);
+    }
+  }
+
+  // Use "Fetch" for fetch requests, "XHR" for regular XHR requests / Fetch 요청에는 "Fetch", 일반 XHR 요청에는 "XHR" 사용
+  sendResponseReceived(runtime, requestId, url, responseInfo, isFetchRequest ? "Fetch" : "XHR", timing);
+  sendDataReceived(runtime, requestId, bodyLength);
+  sendLoadingFinished(runtime, requestId, bodyLength, timing.finished);
+}
+
 bool hookXHR(facebook::jsi::Runtime& runtime) {
   try {
     facebook::jsi::Value xhrValue = runtime.global().getProperty(runtime, "XMLHttpRequest");
@@ -55,21 +183,49 @@ bool hookXHR(facebook::jsi::Runtime& runtime) {
         }
 
         // Store original methods in prototype backup properties / prototype의 백업 속성에 원본 메서드 저장
+        // and in the per-runtime handle cache for the wrappers / 그리고 래퍼를 위해 런타임별 핸들 캐시에 저장
+        common::JSIHandleCache& handleCache = common::acquireHandleCache(runtime);
         originalOpenValue = xhrPrototype.getProperty(runtime, "open");
         if (originalOpenValue.isObject() && originalOpenValue.asObject(runtime).isFunction(runtime)) {
+          handleCache.setFunction(common::CachedFunction::XHROpen, originalOpenValue.asObject(runtime).asFunction(runtime));
           xhrPrototype.setProperty(runtime, "__original_open", std::move(originalOpenValue));
         }
 
         facebook::jsi::Value originalSendValue = xhrPrototype.getProperty(runtime, "send");
         if (originalSendValue.isObject() && originalSendValue.asObject(runtime).isFunction(runtime)) {
+          handleCache.setFunction(common::CachedFunction::XHRSend, originalSendValue.asObject(runtime).asFunction(runtime));
           xhrPrototype.setProperty(runtime, "__original_send", std::move(originalSendValue));
         }
 
         facebook::jsi::Value originalSetRequestHeaderValue = xhrPrototype.getProperty(runtime, "setRequestHeader");
         if (originalSetRequestHeaderValue.isObject() && originalSetRequestHeaderValue.asObject(runtime).isFunction(runtime)) {
+          handleCache.setFunction(common::CachedFunction::XHRSetRequestHeader, originalSetRequestHeaderValue.asObject(runtime).asFunction(runtime));
           xhrPrototype.setProperty(runtime, "__original_setRequestHeader", std::move(originalSetRequestHeaderValue));
         }
 
+        // Shared readystatechange listener, registered on every tracked XHR / 추적되는 모든 XHR에 등록되는 공유 readystatechange 리스너
+        handleCache.setFunction(common::CachedFunction::XHRReadyStateListener,
+                                facebook::jsi::Function::createFromHostFunction(
+                                  runtime,
+                                  facebook::jsi::PropNameID::forAscii(runtime, "cdpReadyStateListener"),
+                                  0,
+                                  [](facebook::jsi::Runtime& rt,
+                                     const facebook::jsi::Value& thisVal,
+                                     const facebook::jsi::Value*,
+                                     size_t) -> facebook::jsi::Value {
+                                    // Requests in flight when Network was disabled are left to table eviction /
+                                    // Network 비활성화 시 진행 중이던 요청은 테이블 제거에 맡김
+                                    if (!common::isNetworkCaptureActive()) {
+                                      return facebook::jsi::Value::undefined();
+                                    }
+                                    common::HookScope hookScope(common::HookSite::XHRReadyStateChange);
+                                    if (thisVal.isObject()) {
+                                      facebook::jsi::Object xhr = thisVal.asObject(rt);
+                                      handleReadyStateChange(rt, xhr);
+                                    }
+                                    return facebook::jsi::Value::undefined();
+                                  }));
+
         // Hook open / open 훅
         auto hookedOpen = facebook::jsi::Function::createFromHostFunction(
           runtime,
@@ -79,36 +235,34 @@ bool hookXHR(facebook::jsi::Runtime& runtime) {
             const facebook::jsi::Value& thisVal,
             const facebook::jsi::Value* args,
             size_t count) -> facebook::jsi::Value {
-            if (count >= 2 && thisVal.isObject()) {
+            // Not tracked while no DevTools client has enabled Network; send then treats the XHR as untracked /
+            // Network를 활성화한 DevTools 클라이언트가 없으면 추적하지 않음, send는 추적되지 않은 XHR로 처리
+            if (!common::isNetworkCaptureActive()) {
+              return thisVal.isObject()
+                       ? callOriginalXHRMethod(rt, common::CachedFunction::XHROpen, "__original_open", thisVal, args, count)
+                       : facebook::jsi::Value::undefined();
+            }
+            common::HookScope hookScope(common::HookSite::XHROpen);
+            if (count >= 2 && thisVal.isObject() && args[0].isString() && args[1].isString()) {
               facebook::jsi::Object xhr = thisVal.asObject(rt);
-              std::string method = args[0].asString(rt).utf8(rt);
-              std::string url = args[1].asString(rt).utf8(rt);
 
-              // Check if this is a fetch request / Fetch 요청인지 확인
-              bool isFetchRequest = false;
-              std::string fetchRequestId;
-              {
-                std::lock_guard<std::mutex> lock(g_fetchRequestMutex);
-                if (g_isFetchRequestActive.load()) {
-                  isFetchRequest = true;
-                  fetchRequestId = g_activeFetchRequestId;
-                }
+              // Re-opened XHR drops its previous state / 다시 열린 XHR은 이전 상태를 삭제
+              uint32_t previousKey = getStateKey(rt, xhr);
+              if (previousKey != 0) {
+                g_xhrStates.erase(previousKey);
               }
 
-              // Store metadata in hidden property / 숨겨진 속성에 메타데이터 저장
-              facebook::jsi::Object metadata = facebook::jsi::Object(rt);
-              metadata.setProperty(rt, "method", facebook::jsi::String::createFromUtf8(rt, method));
-              metadata.setProperty(rt, "url", facebook::jsi::String::createFromUtf8(rt, url));
-              metadata.setProperty(rt, "headers", facebook::jsi::Object(rt));
-              if (isFetchRequest) {
-                // Mark as fetch request and store fetch requestId / Fetch 요청으로 표시하고 fetch requestId 저장
-                metadata.setProperty(rt, "__isFetchRequest", facebook::jsi::Value(true));
-                metadata.setProperty(rt, "__fetchRequestId", facebook::jsi::String::createFromUtf8(rt, fetchRequestId));
-                LOGI("XHRHook: Detected fetch request, will use fetch requestId=%s / XHRHook: Fetch 요청 감지, fetch requestId=%s 사용", fetchRequestId.c_str(), fetchRequestId.c_str());
-              } else {
-                metadata.setProperty(rt, "__isFetchRequest", facebook::jsi::Value(false));
-              }
-              xhr.setProperty(rt, "__cdpNetworkMetadata", metadata);
+              uint32_t key = g_xhrStates.create();
+              XHRState* state = g_xhrStates.find(key);
+              state->request.method = args[0].asString(rt).utf8(rt);
+              state->request.url = args[1].asString(rt).utf8(rt);
+
+              // Check if this is a fetch request / Fetch 요청인지 확인
+              state->isFetchRequest = g_fetchCorrelation.claim(state->request.method, state->request.url, state->requestId,
+                                                                state->timing.requestTime);
+
+              // Only a number is stored on the instance / 인스턴스에는 숫자만 저장됨
+              common::setCachedProperty(rt, xhr, common::PropName::CdpNetworkState, facebook::jsi::Value(static_cast<double>(key)));
             }
 
             // Get original function from prototype / prototype에서 원본 함수 가져오기
@@ -116,20 +270,8 @@ bool hookXHR(facebook::jsi::Runtime& runtime) {
               if (!thisVal.isObject()) {
                 return facebook::jsi::Value::undefined();
               }
-              // Get XMLHttpRequest constructor from global / 전역에서 XMLHttpRequest constructor 가져오기
-              facebook::jsi::Value xhrConstructorValue = rt.global().getProperty(rt, "XMLHttpRequest");
-              if (xhrConstructorValue.isObject()) {
-                facebook::jsi::Object xhrConstructor = xhrConstructorValue.asObject(rt);
-                facebook::jsi::Value prototypeValue = xhrConstructor.getProperty(rt, "prototype");
-                if (prototypeValue.isObject()) {
-                  facebook::jsi::Object prototype = prototypeValue.asObject(rt);
-                  facebook::jsi::Value originalOpenValue = prototype.getProperty(rt, "__original_open");
-                  if (originalOpenValue.isObject() && originalOpenValue.asObject(rt).isFunction(rt)) {
-                    facebook::jsi::Function originalOpen = originalOpenValue.asObject(rt).asFunction(rt);
-                    return originalOpen.callWithThis(rt, thisVal.asObject(rt), args, count);
-                  }
-                }
-              }
+              common::HookScope::Pause originalCall(hookScope);
+              return callOriginalXHRMethod(rt, common::CachedFunction::XHROpen, "__original_open", thisVal, args, count);
             } catch (const std::exception& e) {
               LOGE("Failed to call original XMLHttpRequest.open: %s", e.what());
             }
@@ -147,18 +289,10 @@ bool hookXHR(facebook::jsi::Runtime& runtime) {
             const facebook::jsi::Value& thisVal,
             const facebook::jsi::Value* args,
             size_t count) -> facebook::jsi::Value {
-            if (count >= 2 && thisVal.isObject()) {
+            if (count >= 2 && thisVal.isObject() && args[0].isString() && common::isNetworkCaptureActive()) {
               facebook::jsi::Object xhr = thisVal.asObject(rt);
-              facebook::jsi::Value metadataValue = xhr.getProperty(rt, "__cdpNetworkMetadata");
-              if (metadataValue.isObject()) {
-                facebook::jsi::Object metadata = metadataValue.asObject(rt);
-                facebook::jsi::Value headersValue = metadata.getProperty(rt, "headers");
-                if (headersValue.isObject()) {
-                  facebook::jsi::Object headers = headersValue.asObject(rt);
-                  std::string name = args[0].asString(rt).utf8(rt);
-                  std::string value = args[1].asString(rt).utf8(rt);
-                  headers.setProperty(rt, name.c_str(), facebook::jsi::String::createFromUtf8(rt, value));
-                }
+              if (XHRState* state = g_xhrStates.find(getStateKey(rt, xhr))) {
+                state->request.headers.set(args[0].asString(rt).utf8(rt), args[1].toString(rt).utf8(rt));
               }
             }
 
@@ -167,20 +301,7 @@ bool hookXHR(facebook::jsi::Runtime& runtime) {
               if (!thisVal.isObject()) {
                 return facebook::jsi::Value::undefined();
               }
-              // Get XMLHttpRequest constructor from global / 전역에서 XMLHttpRequest constructor 가져오기
-              facebook::jsi::Value xhrConstructorValue = rt.global().getProperty(rt, "XMLHttpRequest");
-              if (xhrConstructorValue.isObject()) {
-                facebook::jsi::Object xhrConstructor = xhrConstructorValue.asObject(rt);
-                facebook::jsi::Value prototypeValue = xhrConstructor.getProperty(rt, "prototype");
-                if (prototypeValue.isObject()) {
-                  facebook::jsi::Object prototype = prototypeValue.asObject(rt);
-                  facebook::jsi::Value originalSetRequestHeaderValue = prototype.getProperty(rt, "__original_setRequestHeader");
-                  if (originalSetRequestHeaderValue.isObject() && originalSetRequestHeaderValue.asObject(rt).isFunction(rt)) {
-                    facebook::jsi::Function originalSetRequestHeader = originalSetRequestHeaderValue.asObject(rt).asFunction(rt);
-                    return originalSetRequestHeader.callWithThis(rt, thisVal.asObject(rt), args, count);
-                  }
-                }
-              }
+              return callOriginalXHRMethod(rt, common::CachedFunction::XHRSetRequestHeader, "__original_setRequestHeader", thisVal, args, count);
             } catch (const std::exception& e) {
               LOGE("Failed to call original XMLHttpRequest.setRequestHeader: %s", e.what());
             }
@@ -201,386 +322,67 @@ bool hookXHR(facebook::jsi::Runtime& runtime) {
             if (!thisVal.isObject()) {
               return facebook::jsi::Value::undefined();
             }
+            if (!common::isNetworkCaptureActive()) {
+              return callOriginalXHRMethod(rt, common::CachedFunction::XHRSend, "__original_send", thisVal, args, count);
+            }
+            common::HookScope hookScope(common::HookSite::XHRSend);
+            facebook::jsi::Object xhr = thisVal.asObject(rt);
 
-              facebook::jsi::Object xhr = thisVal.asObject(rt);
-              facebook::jsi::Value metadataValue = xhr.getProperty(rt, "__cdpNetworkMetadata");
-
-            // CDP 이벤트 전송을 위한 정보 수집 (메타데이터가 있을 때만) / Collect info for CDP event (only if metadata exists)
-            std::string requestId;
-            std::string capturedUrl;
-            bool shouldTrack = false;
-            bool isFetchRequest = false;
-
-              if (metadataValue.isObject()) {
-                facebook::jsi::Object metadata = metadataValue.asObject(rt);
-
-                // Check if this is a fetch request / Fetch 요청인지 확인
-                try {
-                  facebook::jsi::Value isFetchRequestValue = metadata.getProperty(rt, "__isFetchRequest");
-                  if (isFetchRequestValue.isBool() && isFetchRequestValue.getBool()) {
-                    isFetchRequest = true;
-                    // Use fetch requestId / Fetch requestId 사용
-                    facebook::jsi::Value fetchRequestIdValue = metadata.getProperty(rt, "__fetchRequestId");
-                    if (fetchRequestIdValue.isString()) {
-                      requestId = fetchRequestIdValue.asString(rt).utf8(rt);
-                      LOGI("XHRHook: Using fetch requestId=%s for tracking / XHRHook: 추적에 fetch requestId=%s 사용", requestId.c_str(), requestId.c_str());
-                    }
-                  }
-                } catch (...) {
-                  // Not a fetch request / Fetch 요청이 아님
-                }
-
-                if (!isFetchRequest) {
-                  // Regular XHR request / 일반 XHR 요청
-                  requestId = std::to_string(g_requestIdCounter.fetch_add(1));
-                  RequestInfo requestInfo = collectXHRRequestInfo(rt, metadata, args, count);
-                  capturedUrl = requestInfo.url;
-                  sendRequestWillBeSent(rt, requestId, requestInfo, "XHR");
-                } else {
-                  // Fetch request - requestWillBeSent already sent by Fetch hook / Fetch 요청 - requestWillBeSent는 이미 Fetch 훅에서 전송됨
-                  // Just collect URL for responseReceived / responseReceived를 위해 URL만 수집
-                  RequestInfo requestInfo = collectXHRRequestInfo(rt, metadata, args, count);
-                  capturedUrl = requestInfo.url;
-                  LOGI("XHRHook: Fetch request detected, skipping requestWillBeSent / XHRHook: Fetch 요청 감지, requestWillBeSent 건너뜀");
-                }
-
-                // Store requestId in metadata (for both XHR and Fetch requests) / 메타데이터에 requestId 저장 (XHR 및 Fetch 요청 모두)
-                metadata.setProperty(rt, "requestId", facebook::jsi::String::createFromUtf8(rt, requestId));
-                shouldTrack = true;
+            // CDP 이벤트 전송을 위한 정보 수집 (추적 중인 XHR만) / Collect info for CDP event (tracked XHRs only)
+            XHRState* state = g_xhrStates.find(getStateKey(rt, xhr));
+            bool shouldTrack = state != nullptr && !state->sent;
+            if (shouldTrack) {
+              state->sent = true;
+              if (!state->isFetchRequest) {
+                // Regular XHR request / 일반 XHR 요청
+                // Fetch requests keep the time of the fetch() call / Fetch 요청은 fetch() 호출 시간을 유지
+                state->timing.requestTime = common::monotonicMicros();
+                state->requestId = std::to_string(g_requestIdCounter.fetch_add(1));
+                collectXHRRequestInfo(rt, state->request, args, count);
+                sendRequestWillBeSent(rt, state->requestId, state->request, "XHR", state->timing.requestTime);
+              }
+              // Fetch requests already sent requestWillBeSent from the Fetch hook / Fetch 요청은 Fetch 훅에서 이미 requestWillBeSent를 전송함
+              // Only the URL is needed from here on / 이후에는 URL만 필요함
+              state->request.headers.clear();
+              std::string().swap(state->request.postData);
             }
 
-            // Call original send function FIRST, then add listeners / 원본 send 함수를 먼저 호출한 후 리스너 추가
+            // Call original send function FIRST, then add listener / 원본 send 함수를 먼저 호출한 후 리스너 추가
             // This preserves original XHR behavior / 이를 통해 원본 XHR 동작을 보존합니다
             facebook::jsi::Value sendResult = facebook::jsi::Value::undefined();
+            if (shouldTrack) {
+              state->timing.sendStart = common::monotonicMicros();
+            }
             try {
-              facebook::jsi::Value xhrConstructorValue = rt.global().getProperty(rt, "XMLHttpRequest");
-              if (xhrConstructorValue.isObject()) {
-                facebook::jsi::Object xhrConstructor = xhrConstructorValue.asObject(rt);
-                facebook::jsi::Value prototypeValue = xhrConstructor.getProperty(rt, "prototype");
-                if (prototypeValue.isObject()) {
-                  facebook::jsi::Object prototype = prototypeValue.asObject(rt);
-                  facebook::jsi::Value originalSendValue = prototype.getProperty(rt, "__original_send");
-                  if (originalSendValue.isObject() && originalSendValue.asObject(rt).isFunction(rt)) {
-                    facebook::jsi::Function originalSend = originalSendValue.asObject(rt).asFunction(rt);
-                    sendResult = originalSend.callWithThis(rt, thisVal.asObject(rt), args, count);
-                  }
-                }
-              }
+              common::HookScope::Pause originalCall(hookScope);
+              sendResult = callOriginalXHRMethod(rt, common::CachedFunction::XHRSend, "__original_send", thisVal, args, count);
             } catch (const std::exception& e) {
               LOGE("Failed to call original XMLHttpRequest.send: %s", e.what());
             }
+            if (shouldTrack) {
+              // Original send may have re-entered the hooks and dropped the state / 원본 send가 훅에 재진입하여 상태를 삭제했을 수 있음
+              state = g_xhrStates.find(getStateKey(rt, xhr));
+              if (state != nullptr) {
+                state->timing.sendEnd = common::monotonicMicros();
+              }
+            }
 
-            // Add event listeners AFTER calling original send / 원본 send 호출 후 이벤트 리스너 추가
-            // Use addEventListener instead of overriding onload/onerror/ontimeout / onload/onerror/ontimeout를 덮어쓰는 대신 addEventListener 사용
-            // This preserves original event handlers / 이를 통해 원본 이벤트 핸들러를 보존합니다
-            // Follow React Native XHRInterceptor pattern: use readystatechange for DONE state / React Native XHRInterceptor 패턴 따름: readystatechange에서 DONE 상태 처리
+            // Add the shared readystatechange listener AFTER calling original send / 원본 send 호출 후 공유 readystatechange 리스너 추가
+            // Use addEventListener instead of overriding onreadystatechange / onreadystatechange를 덮어쓰는 대신 addEventListener 사용
+            // Errors, timeouts and aborts also end in DONE, so one listener covers every outcome /
+            // 에러, 타임아웃, 중단도 DONE으로 끝나므로 리스너 하나로 모든 결과를 처리
             if (shouldTrack) {
               try {
-                facebook::jsi::Value addEventListenerValue = xhr.getProperty(rt, "addEventListener");
-                if (addEventListenerValue.isObject() && addEventListenerValue.asObject(rt).isFunction(rt)) {
+                const facebook::jsi::Function* listener = common::getCachedFunction(rt, common::CachedFunction::XHRReadyStateListener);
+                facebook::jsi::Value addEventListenerValue = common::getCachedProperty(rt, xhr, common::PropName::AddEventListener);
+                if (listener != nullptr && addEventListenerValue.isObject() && addEventListenerValue.asObject(rt).isFunction(rt)) {
                   facebook::jsi::Function addEventListener = addEventListenerValue.asObject(rt).asFunction(rt);
-
-                  // Create readystatechange listener - React Native XHRInterceptor pattern / readystatechange 리스너 생성 - React Native XHRInterceptor 패턴
-                  // This matches the pattern used in React Native's XHRInterceptor.js / React Native의 XHRInterceptor.js에서 사용하는 패턴과 일치
-                  // HEADERS_RECEIVED (2) - collect response headers / 응답 헤더 수집
-                  // DONE (4) - collect response body and send events / 응답 본문 수집 및 이벤트 전송
-                  facebook::jsi::Value readystatechangeListener = facebook::jsi::Function::createFromHostFunction(
-                  rt,
-                    facebook::jsi::PropNameID::forAscii(rt, "readystatechangeListener"),
-                  0,
-                  [requestId, capturedUrl, isFetchRequest](facebook::jsi::Runtime& runtime,
-                                           const facebook::jsi::Value& thisVal,
-                                           const facebook::jsi::Value*,
-                                           size_t) -> facebook::jsi::Value {
-                    if (thisVal.isObject()) {
-                      facebook::jsi::Object xhrObj = thisVal.asObject(runtime);
-                        facebook::jsi::Value readyStateValue = xhrObj.getProperty(runtime, "readyState");
-                        if (!readyStateValue.isNumber()) {
-                          return facebook::jsi::Value::undefined();
-                        }
-
-                        double readyState = readyStateValue.asNumber();
-
-                        // HEADERS_RECEIVED (2) - collect response headers / 응답 헤더 수집
-                        // This is when React Native XHRInterceptor collects headers / React Native XHRInterceptor가 헤더를 수집하는 시점
-                        if (readyState == 2) {
-                          LOGI("ReadyState HEADERS_RECEIVED (2) - collecting headers / ReadyState HEADERS_RECEIVED (2) - 헤더 수집 중");
-                          // Get response headers and store in metadata / 응답 헤더 가져오기 및 메타데이터에 저장
-                          try {
-                            facebook::jsi::Value metadataValue = xhrObj.getProperty(runtime, "__cdpNetworkMetadata");
-                            if (metadataValue.isObject()) {
-                              facebook::jsi::Object metadata = metadataValue.asObject(runtime);
-
-                              // Get all response headers / 모든 응답 헤더 가져오기
-                              std::string allHeaders;
-                              facebook::jsi::Value getAllResponseHeadersValue = xhrObj.getProperty(runtime, "getAllResponseHeaders");
-                              if (getAllResponseHeadersValue.isObject() && getAllResponseHeadersValue.asObject(runtime).isFunction(runtime)) {
-                                LOGI("getAllResponseHeaders function found / getAllResponseHeaders 함수 발견");
-                                facebook::jsi::Function getAllResponseHeaders = getAllResponseHeadersValue.asObject(runtime).asFunction(runtime);
-                                facebook::jsi::Value headersValue = getAllResponseHeaders.callWithThis(runtime, xhrObj);
-                                if (headersValue.isString()) {
-                                  allHeaders = headersValue.asString(runtime).utf8(runtime);
-                                  LOGI("Headers collected at HEADERS_RECEIVED: length=%zu", allHeaders.length());
-                                  if (!allHeaders.empty()) {
-                                    LOGI("Headers content (first 200 chars): %s", allHeaders.substr(0, 200).c_str());
-                                  } else {
-                                    LOGW("Headers string is empty at HEADERS_RECEIVED / HEADERS_RECEIVED에서 헤더 문자열이 비어있음");
-                                  }
-                                  // Store headers string in metadata for later use / 나중에 사용하기 위해 메타데이터에 헤더 문자열 저장
-                                  metadata.setProperty(runtime, "__responseHeaders", facebook::jsi::String::createFromUtf8(runtime, allHeaders));
-                                  LOGI("Headers stored in metadata / 메타데이터에 헤더 저장됨");
-                                } else {
-                                  LOGW("getAllResponseHeaders returned non-string value / getAllResponseHeaders가 문자열이 아닌 값을 반환함");
-                                }
-                              } else {
-                                LOGW("getAllResponseHeaders is not a function / getAllResponseHeaders가 함수가 아님");
-                              }
-                            } else {
-                              LOGW("Metadata not found at HEADERS_RECEIVED / HEADERS_RECEIVED에서 메타데이터를 찾을 수 없음");
-                            }
-                          } catch (const std::exception& e) {
-                            LOGE("Exception while collecting headers at HEADERS_RECEIVED: %s", e.what());
-                          } catch (...) {
-                            LOGE("Unknown exception while collecting headers at HEADERS_RECEIVED / HEADERS_RECEIVED에서 헤더 수집 중 알 수 없는 예외");
-                          }
-                        }
-
-                        // DONE (4) - collect response data and send events / 응답 데이터 수집 및 이벤트 전송
-                        // This is when React Native XHRInterceptor collects response body / React Native XHRInterceptor가 응답 본문을 수집하는 시점
-                        // XHRInterceptor uses this.response (not responseText) / XHRInterceptor는 this.response를 사용함 (responseText 아님)
-                        if (readyState == 4) {
-                          // Collect response info / 응답 정보 수집
-                          // collectXHRResponseInfo will try responseText first, then response / collectXHRResponseInfo는 먼저 responseText를 시도하고, 그 다음 response를 시도함
-                          ResponseInfo responseInfo = collectXHRResponseInfo(runtime, xhrObj);
-
-                          // Check if this is a network error (status === 0) / 네트워크 에러인지 확인 (status === 0)
-                          // XHR status is 0 for network errors (DNS failure, connection refused, etc.) / XHR status가 0이면 네트워크 에러 (DNS 실패, 연결 거부 등)
-                          if (responseInfo.status == 0) {
-                            // Mark error as handled in metadata to prevent duplicate handling / 중복 처리 방지를 위해 메타데이터에 에러 처리됨으로 표시
-                            try {
-                              facebook::jsi::Value metadataValue = xhrObj.getProperty(runtime, "__cdpNetworkMetadata");
-                              if (metadataValue.isObject()) {
-                                facebook::jsi::Object metadata = metadataValue.asObject(runtime);
-                                metadata.setProperty(runtime, "__errorHandled", facebook::jsi::Value(true));
-                              }
-                            } catch (...) {
-                              // Failed to set error handled flag / 에러 처리 플래그 설정 실패
-                            }
-
-                            // Network error - send loadingFailed event / 네트워크 에러 - loadingFailed 이벤트 전송
-                            LOGI("Network error detected (status=0) - sending loadingFailed / 네트워크 에러 감지 (status=0) - loadingFailed 전송");
-                            sendLoadingFailed(runtime, requestId, "Network error", "XHR");
-                            return facebook::jsi::Value::undefined();
-                          }
-
-                          // Use headers collected at HEADERS_RECEIVED (readyState 2) / HEADERS_RECEIVED (readyState 2)에서 수집한 헤더 사용
-                          // XHRInterceptor pattern: headers are collected at HEADERS_RECEIVED, not at DONE / XHRInterceptor 패턴: 헤더는 HEADERS_RECEIVED에서 수집하고, DONE에서 수집하지 않음
-                          LOGI("ReadyState DONE (4) - using headers from metadata / ReadyState DONE (4) - 메타데이터에서 헤더 사용");
-                          bool headersFound = false;
-                          try {
-                            facebook::jsi::Value metadataValue = xhrObj.getProperty(runtime, "__cdpNetworkMetadata");
-                            if (metadataValue.isObject()) {
-                              LOGI("Metadata found, checking for stored headers / 메타데이터 발견, 저장된 헤더 확인 중");
-                              facebook::jsi::Object metadata = metadataValue.asObject(runtime);
-                              facebook::jsi::Value headersValue = metadata.getProperty(runtime, "__responseHeaders");
-                              if (headersValue.isString()) {
-                                std::string allHeaders = headersValue.asString(runtime).utf8(runtime);
-                                LOGI("Stored headers found: length=%zu", allHeaders.length());
-                                if (!allHeaders.empty()) {
-                                  LOGI("Stored headers content (first 200 chars): %s", allHeaders.substr(0, 200).c_str());
-                                  // Format and use stored headers / 저장된 헤더 포맷팅 및 사용
-                                  responseInfo.headers = formatResponseHeaders(allHeaders);
-                                  headersFound = true;
-                                  LOGI("Headers formatted and set from metadata / 메타데이터에서 헤더 포맷팅 및 설정 완료");
-                                } else {
-                                  LOGW("Stored headers string is empty / 저장된 헤더 문자열이 비어있음");
-                                }
-                              } else {
-                                LOGW("__responseHeaders is not a string in metadata / 메타데이터의 __responseHeaders가 문자열이 아님");
-                              }
-                            } else {
-                              LOGW("Metadata not found at DONE / DONE에서 메타데이터를 찾을 수 없음");
-                            }
-                          } catch (const std::exception& e) {
-                            LOGE("Exception while getting stored headers: %s", e.what());
-                          } catch (...) {
-                            LOGE("Unknown exception while getting stored headers / 저장된 헤더 가져오기 중 알 수 없는 예외");
-                          }
-
-                          // Failed to get stored headers, try to collect at DONE as fallback / 저장된 헤더 가져오기 실패, 폴백으로 DONE에서 수집 시도
-                          if (!headersFound) {
-                            LOGI("Headers not found in metadata, trying to collect at DONE / 메타데이터에서 헤더를 찾을 수 없음, DONE에서 수집 시도");
-                            try {
-                              facebook::jsi::Value getAllResponseHeadersValue = xhrObj.getProperty(runtime, "getAllResponseHeaders");
-                              if (getAllResponseHeadersValue.isObject() && getAllResponseHeadersValue.asObject(runtime).isFunction(runtime)) {
-                                LOGI("getAllResponseHeaders function found at DONE / DONE에서 getAllResponseHeaders 함수 발견");
-                                facebook::jsi::Function getAllResponseHeaders = getAllResponseHeadersValue.asObject(runtime).asFunction(runtime);
-                                facebook::jsi::Value headersValue = getAllResponseHeaders.callWithThis(runtime, xhrObj);
-                                if (headersValue.isString()) {
-                                  std::string allHeaders = headersValue.asString(runtime).utf8(runtime);
-                                  LOGI("Headers collected at DONE: length=%zu", allHeaders.length());
-                                  if (!allHeaders.empty()) {
-                                    LOGI("Headers content at DONE (first 200 chars): %s", allHeaders.substr(0, 200).c_str());
-                                    // Format and use headers / 헤더 포맷팅 및 사용
-                                    responseInfo.headers = formatResponseHeaders(allHeaders);
-                                    headersFound = true;
-                                    LOGI("Headers formatted and set from DONE collection / DONE 수집에서 헤더 포맷팅 및 설정 완료");
-                                  } else {
-                                    LOGW("Headers string is empty at DONE / DONE에서 헤더 문자열이 비어있음");
-                                  }
-                                } else {
-                                  LOGW("getAllResponseHeaders returned non-string value at DONE / DONE에서 getAllResponseHeaders가 문자열이 아닌 값을 반환함");
-                                }
-                              } else {
-                                LOGW("getAllResponseHeaders is not a function at DONE / DONE에서 getAllResponseHeaders가 함수가 아님");
-                              }
-                            } catch (const std::exception& e) {
-                              LOGE("Exception while collecting headers at DONE: %s", e.what());
-                            } catch (...) {
-                              LOGE("Unknown exception while collecting headers at DONE / DONE에서 헤더 수집 중 알 수 없는 예외");
-                            }
-                          }
-
-                          // Check final headers state / 최종 헤더 상태 확인
-                          if (headersFound) {
-                            LOGI("Headers successfully set in responseInfo / responseInfo에 헤더 성공적으로 설정됨");
-                          } else {
-                            LOGW("No headers found in responseInfo, using headers from collectXHRResponseInfo / responseInfo에 헤더 없음, collectXHRResponseInfo의 헤더 사용");
-                          }
-
-                          // For fetch requests, body is handled by Fetch hook, so clear it here / Fetch 요청의 경우 본문은 Fetch 훅에서 처리하므로 여기서 지움
-                          if (isFetchRequest) {
-                            // Check if Fetch hook already stored the body / Fetch 훅이 이미 본문을 저장했는지 확인
-                            std::string fetchBody;
-                            {
-                              std::lock_guard<std::mutex> lock(g_responseDataMutex);
-                              auto it = g_responseData.find(requestId);
-                              if (it != g_responseData.end()) {
-                                fetchBody = it->second;
-                                LOGI("XHRHook: Found body from Fetch hook for requestId=%s, length=%zu / XHRHook: requestId=%s에 대한 Fetch 훅의 본문 발견, 길이=%zu", requestId.c_str(), fetchBody.length(), requestId.c_str(), fetchBody.length());
-                              } else {
-                                LOGW("XHRHook: Body not found from Fetch hook for requestId=%s / XHRHook: requestId=%s에 대한 Fetch 훅의 본문을 찾을 수 없음", requestId.c_str(), requestId.c_str());
-                              }
-                            }
-                            // Clear responseText (body will be retrieved from g_responseData by Network.getResponseBody) / responseText 지우기 (본문은 Network.getResponseBody에서 g_responseData에서 가져옴)
-                            responseInfo.responseText = "";
-                            LOGI("XHRHook: Sending responseReceived for fetch request without body / XHRHook: 본문 없이 fetch 요청에 대한 responseReceived 전송");
-                          } else {
-                            // Store response data for regular XHR requests / 일반 XHR 요청에 대한 응답 데이터 저장 (thread-safe / 스레드 안전)
-                            // Only store if responseText is not empty / responseText가 비어있지 않을 때만 저장
-                            if (!responseInfo.responseText.empty()) {
-                              std::lock_guard<std::mutex> lock(g_responseDataMutex);
-                              g_responseData[requestId] = responseInfo.responseText;
-                            }
-                          }
-
-                          // Send responseReceived event / responseReceived 이벤트 전송
-                          // Use "Fetch" for fetch requests, "XHR" for regular XHR requests / Fetch 요청에는 "Fetch", 일반 XHR 요청에는 "XHR" 사용
-                          sendResponseReceived(runtime, requestId, capturedUrl, responseInfo, isFetchRequest ? "Fetch" : "XHR");
-
-                          // Send loadingFinished event / loadingFinished 이벤트 전송
-                          // For fetch requests, use empty string (body is in g_responseData) / Fetch 요청의 경우 빈 문자열 사용 (본문은 g_responseData에 있음)
-                          sendLoadingFinished(runtime, requestId, isFetchRequest ? "" : responseInfo.responseText);
-                        }
-                      }
-                      return facebook::jsi::Value::undefined();
-                    }
-                  );
-
-                  // Add readystatechange listener / readystatechange 리스너 추가
-                  facebook::jsi::Value eventName = facebook::jsi::String::createFromUtf8(rt, "readystatechange");
-                  addEventListener.callWithThis(rt, xhr, std::move(eventName), std::move(readystatechangeListener));
-
-                  // Also add load listener as fallback / 폴백으로 load 리스너도 추가
-                  // load event fires after readystatechange, so it's safer for response data / load 이벤트는 readystatechange 이후에 발생하므로 응답 데이터에 더 안전함
-                  // Note: This is a fallback in case readystatechange didn't capture the data / 참고: readystatechange에서 데이터를 캡처하지 못한 경우를 위한 폴백
-                  facebook::jsi::Value loadListener = facebook::jsi::Function::createFromHostFunction(
-                  rt,
-                    facebook::jsi::PropNameID::forAscii(rt, "loadListener"),
-                  0,
-                  [requestId](facebook::jsi::Runtime& runtime,
-                              const facebook::jsi::Value& thisVal,
-                              const facebook::jsi::Value*,
-                              size_t) -> facebook::jsi::Value {
-                    if (thisVal.isObject()) {
-                        facebook::jsi::Object xhrObj = thisVal.asObject(runtime);
-                        ResponseInfo responseInfo = collectXHRResponseInfo(runtime, xhrObj);
-
-                        // Update response data if it was empty in readystatechange / readystatechange에서 비어있었으면 응답 데이터 업데이트
-                        // Only update if we have data and it's not already stored / 데이터가 있고 아직 저장되지 않았을 때만 업데이트
-                        if (!responseInfo.responseText.empty()) {
-                          std::lock_guard<std::mutex> lock(g_responseDataMutex);
-                          // Only update if not already set / 이미 설정되지 않았을 때만 업데이트
-                          if (g_responseData.find(requestId) == g_responseData.end() || g_responseData[requestId].empty()) {
-                            g_responseData[requestId] = responseInfo.responseText;
-                          }
-                        }
-                      }
-                      return facebook::jsi::Value::undefined();
-                    }
-                  );
-
-                  facebook::jsi::Value loadEventName = facebook::jsi::String::createFromUtf8(rt, "load");
-                  addEventListener.callWithThis(rt, xhr, std::move(loadEventName), std::move(loadListener));
-
-                  // Add error listener / error 리스너 추가
-                  facebook::jsi::Value errorListener = facebook::jsi::Function::createFromHostFunction(
-                    rt,
-                    facebook::jsi::PropNameID::forAscii(rt, "errorListener"),
-                    0,
-                    [requestId](facebook::jsi::Runtime& runtime,
-                                const facebook::jsi::Value& thisVal,
-                                const facebook::jsi::Value*,
-                                size_t) -> facebook::jsi::Value {
-                      // Check if already handled by readystatechange using metadata flag / 메타데이터 플래그를 사용하여 readystatechange에서 이미 처리되었는지 확인
-                      // Use metadata flag to prevent race conditions / race condition 방지를 위해 메타데이터 플래그 사용
-                      if (thisVal.isObject()) {
-                        facebook::jsi::Object xhrObj = thisVal.asObject(runtime);
-                        try {
-                          facebook::jsi::Value metadataValue = xhrObj.getProperty(runtime, "__cdpNetworkMetadata");
-                          if (metadataValue.isObject()) {
-                            facebook::jsi::Object metadata = metadataValue.asObject(runtime);
-                            facebook::jsi::Value errorHandledValue = metadata.getProperty(runtime, "__errorHandled");
-                            if (errorHandledValue.isBool() && errorHandledValue.getBool()) {
-                              LOGI("Error event fired but already handled by readystatechange / 에러 이벤트 발생했지만 이미 readystatechange에서 처리됨");
-                              return facebook::jsi::Value::undefined();
-                            }
-                            // Mark error as handled to prevent duplicate handling / 중복 처리 방지를 위해 에러 처리됨으로 표시
-                            metadata.setProperty(runtime, "__errorHandled", facebook::jsi::Value(true));
-                          }
-                        } catch (...) {
-                          // Failed to check error handled flag / 에러 처리 플래그 확인 실패
-                        }
-                      }
-                      // Otherwise, send loadingFailed / 그렇지 않으면 loadingFailed 전송
-                      LOGI("Error event fired - sending loadingFailed / 에러 이벤트 발생 - loadingFailed 전송");
-                      sendLoadingFailed(runtime, requestId, "Network error", "XHR");
-                      return facebook::jsi::Value::undefined();
-                    }
-                  );
-
-                  facebook::jsi::Value errorEventName = facebook::jsi::String::createFromUtf8(rt, "error");
-                  addEventListener.callWithThis(rt, xhr, std::move(errorEventName), std::move(errorListener));
-
-                  // Add timeout listener / timeout 리스너 추가
-                  facebook::jsi::Value timeoutListener = facebook::jsi::Function::createFromHostFunction(
-                  rt,
-                    facebook::jsi::PropNameID::forAscii(rt, "timeoutListener"),
-                  0,
-                  [requestId](facebook::jsi::Runtime& runtime,
-                                const facebook::jsi::Value&,
-                               const facebook::jsi::Value*,
-                               size_t) -> facebook::jsi::Value {
-                    sendLoadingFailed(runtime, requestId, "Request timeout", "XHR");
-                      return facebook::jsi::Value::undefined();
-                    }
-                  );
-
-                  facebook::jsi::Value timeoutEventName = facebook::jsi::String::createFromUtf8(rt, "timeout");
-                  addEventListener.callWithThis(rt, xhr, std::move(timeoutEventName), std::move(timeoutListener));
-              }
+                  addEventListener.callWithThis(rt, xhr,
+                                                facebook::jsi::String::createFromAscii(rt, "readystatechange"),
+                                                facebook::jsi::Value(rt, *listener));
+                }
               } catch (const std::exception& e) {
-                LOGW("Failed to add event listeners, CDP events may not be sent / 이벤트 리스너 추가 실패, CDP 이벤트가 전송되지 않을 수 있음: %s", e.what());
+                LOGW("Failed to add event listener, CDP events may not be sent / 이벤트 리스너 추가 실패, CDP 이벤트가 전송되지 않을 수 있음: %s", e.what());
               }
             }
 
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "XHRStateTable.h"
+#include <algorithm>
+
+namespace chrome_remote_devtools {
+namespace network {
+
+uint32_t XHRStateTable::create() {
+  uint32_t key = nextKey_++;
+  if (nextKey_ == 0) {
+    nextKey_ = 1;  // 0 is never a valid key / 0은 유효한 키가 아님
+  }
+  states_[key] = XHRState();
+  order_.push_back(key);
+
+  while (states_.size() > kMaxTracked && !order_.empty()) {
+    states_.erase(order_.front());
+    order_.pop_front();
+  }
+  // Finished keys stay in order_ until compacted / 완료된 키는 정리될 때까지 order_에 남음
+  if (order_.size() > kMaxTracked * 2) {
+    order_.erase(std::remove_if(order_.begin(), order_.end(),
+                                [this](uint32_t k) { return states_.find(k) == states_.end(); }),
+                 order_.end());
+  }
+  return key;
+}
+
+XHRState* XHRStateTable::find(uint32_t key) {
+  auto it = states_.find(key);
+  return it != states_.end() ? &it->second : nullptr;
+}
+
+void XHRStateTable::erase(uint32_t key) {
+  states_.erase(key);
+}
+
+void XHRStateTable::clear() {
+  states_.clear();
+  order_.clear();
+}
+
+} // namespace network
+} // namespace chrome_remote_devtools
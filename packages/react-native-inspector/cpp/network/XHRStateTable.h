@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include "NetworkTypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+namespace chrome_remote_devtools {
+namespace network {
+
+// Native state of one tracked XHR / 추적 중인 XHR 하나의 네이티브 상태
+struct XHRState {
+  RequestInfo request;          // Filled by open, setRequestHeader and send / open, setRequestHeader, send에서 채워짐
+  std::string requestId;        // Claimed fetch requestId, or assigned at send / 가져온 fetch requestId, 또는 send에서 할당
+  RequestTiming timing;
+  bool isFetchRequest = false;
+  bool sent = false;
+};
+
+// Per-request XHR state, looked up by a numeric key stored on the XHR instance /
+// XHR 인스턴스에 저장된 숫자 키로 조회되는 요청별 XHR 상태
+// The key is a plain number property, so tracking a request allocates no JS objects /
+// 키는 단순한 숫자 속성이므로 요청 추적에 JS 객체를 할당하지 않음
+// JS thread only, no locking / JS 스레드 전용, 잠금 없음
+class XHRStateTable {
+public:
+  // Create state for a newly opened XHR / 새로 열린 XHR의 상태 생성
+  uint32_t create();
+
+  // State of key, or nullptr if finished or evicted / key의 상태, 완료되었거나 제거되었으면 nullptr
+  XHRState* find(uint32_t key);
+
+  void erase(uint32_t key);
+  void clear();
+  size_t size() const { return states_.size(); }
+
+private:
+  // Upper bound of tracked XHRs, oldest are dropped beyond it (opened but never finished) /
+  // 추적하는 XHR의 상한, 초과 시 가장 오래된 것부터 삭제 (열렸지만 완료되지 않은 것)
+  static constexpr size_t kMaxTracked = 1024;
+
+  std::unordered_map<uint32_t, XHRState> states_;
+  std::deque<uint32_t> order_;  // Keys in creation order / 생성 순서의 키
+  uint32_t nextKey_ = 1;
+};
+
+} // namespace network
+} // namespace chrome_remote_devtools
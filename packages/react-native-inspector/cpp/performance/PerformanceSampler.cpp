@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+
+#include "PerformanceSampler.h"
+#include "../network/NetworkGlobals.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "PerformanceSampler"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "PerformanceSampler"
+#define LOGI(...) ((void)0)
+#define LOGE(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+namespace performance {
+
+// Low enough to be free, high enough for a live panel / 비용이 없을 만큼 낮고 실시간 패널에 충분할 만큼 높음
+static constexpr auto kSampleInterval = std::chrono::seconds(1);
+
+namespace {
+
+struct SamplerState {
+  std::mutex mutex;
+  std::condition_variable stopCondition;
+  std::thread thread;
+  bool running = false;
+  uint64_t generation = 0;  // Bumped on stop so a late-waking loop never outlives it / 늦게 깨어난 루프가 남지 않도록 중지 시 증가
+  ThreadHandle jsThread;
+  ProcessSample latest;
+};
+
+// Intentionally leaked so static destruction order never joins a live thread /
+// 정적 소멸 순서가 살아 있는 스레드를 join하지 않도록 의도적으로 해제하지 않음
+SamplerState& getSamplerState() {
+  static SamplerState* state = new SamplerState();
+  return *state;
+}
+
+ProcessSample takeSample(ThreadHandle jsThread) {
+  ProcessSample sample;
+  sample.residentBytes = readResidentBytes();
+  sample.processCpuSeconds = readProcessCpuSeconds();
+  sample.jsThreadCpuSeconds = readThreadCpuSeconds(jsThread);
+  sample.responseBodyBytes = network::g_responseBodyStore.memoryBytes() + network::g_responseBodyStore.spillBytes();
+  sample.valid = true;
+  return sample;
+}
+
+void samplerLoop(SamplerState& state, uint64_t generation) {
+  std::unique_lock<std::mutex> lock(state.mutex);
+  while (state.running && state.generation == generation) {
+    ThreadHandle jsThread = state.jsThread;
+    lock.unlock();
+    ProcessSample sample = takeSample(jsThread);
+    lock.lock();
+    if (state.generation != generation) {
+      break;
+    }
+    state.latest = sample;
+    state.stopCondition.wait_for(lock, kSampleInterval,
+                                 [&state, generation]() { return !state.running || state.generation != generation; });
+  }
+}
+
+} // namespace
+
+void startPerformanceSampler(ThreadHandle jsThread) {
+  SamplerState& state = getSamplerState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.jsThread = jsThread;
+  if (state.running) {
+    return;
+  }
+  try {
+    state.running = true;
+    uint64_t generation = state.generation;
+    state.thread = std::thread([&state, generation]() { samplerLoop(state, generation); });
+    LOGI("Performance sampler started / 성능 샘플러 시작됨");
+  } catch (const std::exception& e) {
+    state.running = false;
+    LOGE("Failed to start performance sampler thread: %s", e.what());
+  }
+}
+
+void stopPerformanceSampler() {
+  SamplerState& state = getSamplerState();
+  std::thread thread;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!state.running) {
+      return;
+    }
+    state.running = false;
+    state.generation++;
+    state.latest = ProcessSample();
+    thread = std::move(state.thread);
+  }
+  state.stopCondition.notify_all();
+  if (thread.joinable()) {
+    thread.join();
+  }
+  LOGI("Performance sampler stopped / 성능 샘플러 중지됨");
+}
+
+ProcessSample latestProcessSample() {
+  SamplerState& state = getSamplerState();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.latest;
+}
+
+} // namespace performance
+} // namespace chrome_remote_devtools
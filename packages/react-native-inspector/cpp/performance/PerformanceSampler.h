@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+
+#pragma once
+
+#include "ProcessStats.h"
+#include <cstdint>
+
+namespace chrome_remote_devtools {
+namespace performance {
+
+// Latest process statistics taken by the background sampler / 백그라운드 샘플러가 수집한 최신 프로세스 통계
+struct ProcessSample {
+  bool valid = false;
+  uint64_t residentBytes = 0;
+  double processCpuSeconds = -1;
+  double jsThreadCpuSeconds = -1;
+  uint64_t responseBodyBytes = 0;  // In memory and spilled / 메모리와 spill 합계
+};
+
+// Start sampling process statistics once per second on a background thread (idempotent) /
+// 백그라운드 스레드에서 초당 한 번 프로세스 통계 샘플링 시작 (멱등)
+// Reads under /proc (or Mach calls) never run on the JS thread / /proc 읽기(또는 Mach 호출)는 JS 스레드에서 실행되지 않음
+// @param jsThread Thread whose CPU time is reported / CPU 시간을 보고할 스레드
+void startPerformanceSampler(ThreadHandle jsThread);
+
+// Stop the sampler thread / 샘플러 스레드 중지
+void stopPerformanceSampler();
+
+// Most recent sample (valid is false until the first sample) / 가장 최근 샘플 (첫 샘플 전에는 valid가 false)
+ProcessSample latestProcessSample();
+
+} // namespace performance
+} // namespace chrome_remote_devtools
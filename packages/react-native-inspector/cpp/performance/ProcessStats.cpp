@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+
+#include "ProcessStats.h"
+#include <cstdio>
+#include <cstring>
+
+#if defined(__linux__) || defined(__ANDROID__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#define CRD_PROC_STATS 1
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#define CRD_MACH_STATS 1
+#endif
+
+namespace chrome_remote_devtools {
+namespace performance {
+
+#ifdef CRD_PROC_STATS
+// utime + stime (fields 14 and 15) of a /proc stat file in seconds / /proc stat 파일의 utime + stime (14, 15번 필드, 초)
+// The command name (field 2) may contain spaces, so fields are counted after its closing ')' /
+// 명령 이름(2번 필드)에 공백이 있을 수 있으므로 닫는 ')' 뒤부터 필드를 셈
+static double readStatCpuSeconds(const char* path) {
+  FILE* file = std::fopen(path, "r");
+  if (file == nullptr) {
+    return -1;
+  }
+  char buffer[1024];
+  size_t length = std::fread(buffer, 1, sizeof(buffer) - 1, file);
+  std::fclose(file);
+  buffer[length] = '\0';
+
+  const char* cursor = std::strrchr(buffer, ')');
+  if (cursor == nullptr) {
+    return -1;
+  }
+  unsigned long long utime = 0;
+  unsigned long long stime = 0;
+  // Skip state (3) through cmajflt (13) / state(3)부터 cmajflt(13)까지 건너뜀
+  if (std::sscanf(cursor + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %llu %llu", &utime, &stime) != 2) {
+    return -1;
+  }
+  static const long ticksPerSecond = sysconf(_SC_CLK_TCK);
+  return ticksPerSecond > 0 ? static_cast<double>(utime + stime) / static_cast<double>(ticksPerSecond) : -1;
+}
+#endif
+
+ThreadHandle currentThreadHandle() {
+  ThreadHandle handle;
+#if defined(CRD_PROC_STATS)
+  handle.id = static_cast<int64_t>(syscall(SYS_gettid));
+#elif defined(CRD_MACH_STATS)
+  handle.id = static_cast<int64_t>(pthread_mach_thread_np(pthread_self()));
+#endif
+  return handle;
+}
+
+uint64_t readResidentBytes() {
+#if defined(CRD_PROC_STATS)
+  FILE* file = std::fopen("/proc/self/statm", "r");
+  if (file == nullptr) {
+    return 0;
+  }
+  unsigned long long sizePages = 0;
+  unsigned long long residentPages = 0;
+  int matched = std::fscanf(file, "%llu %llu", &sizePages, &residentPages);
+  std::fclose(file);
+  static const long pageSize = sysconf(_SC_PAGESIZE);
+  return matched == 2 && pageSize > 0 ? residentPages * static_cast<uint64_t>(pageSize) : 0;
+#elif defined(CRD_MACH_STATS)
+  mach_task_basic_info_data_t info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS) {
+    return 0;
+  }
+  return info.resident_size;
+#else
+  return 0;
+#endif
+}
+
+double readProcessCpuSeconds() {
+#if defined(CRD_PROC_STATS)
+  return readStatCpuSeconds("/proc/self/stat");
+#elif defined(CRD_MACH_STATS)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return -1;
+  }
+  return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+         static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+#else
+  return -1;
+#endif
+}
+
+double readThreadCpuSeconds(ThreadHandle thread) {
+  if (!thread.valid()) {
+    return -1;
+  }
+#if defined(CRD_PROC_STATS)
+  char path[64];
+  std::snprintf(path, sizeof(path), "/proc/self/task/%lld/stat", static_cast<long long>(thread.id));
+  return readStatCpuSeconds(path);
+#elif defined(CRD_MACH_STATS)
+  thread_basic_info_data_t info;
+  mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+  if (thread_info(static_cast<thread_act_t>(thread.id), THREAD_BASIC_INFO, reinterpret_cast<thread_info_t>(&info),
+                  &count) != KERN_SUCCESS) {
+    return -1;
+  }
+  return static_cast<double>(info.user_time.seconds + info.system_time.seconds) +
+         static_cast<double>(info.user_time.microseconds + info.system_time.microseconds) / 1e6;
+#else
+  return -1;
+#endif
+}
+
+} // namespace performance
+} // namespace chrome_remote_devtools
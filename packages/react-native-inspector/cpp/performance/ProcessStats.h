@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace chrome_remote_devtools {
+namespace performance {
+
+// Identifies a thread for CPU time reads from another thread / 다른 스레드에서 CPU 시간을 읽기 위한 스레드 식별자
+// Linux tid (/proc/self/task/<tid>) or Mach thread port / Linux tid (/proc/self/task/<tid>) 또는 Mach 스레드 포트
+struct ThreadHandle {
+  int64_t id = 0;
+  bool valid() const { return id != 0; }
+};
+
+// Handle of the calling thread / 호출 스레드의 핸들
+ThreadHandle currentThreadHandle();
+
+// Resident set size in bytes, 0 if unknown / 상주 메모리 크기 (바이트), 알 수 없으면 0
+uint64_t readResidentBytes();
+
+// CPU time (user + system) of the whole process in seconds, -1 if unknown / 프로세스 전체의 CPU 시간 (user + system, 초), 알 수 없으면 -1
+double readProcessCpuSeconds();
+
+// CPU time (user + system) of thread in seconds, -1 if unknown or the thread is gone /
+// 스레드의 CPU 시간 (user + system, 초), 알 수 없거나 스레드가 없으면 -1
+double readThreadCpuSeconds(ThreadHandle thread);
+
+} // namespace performance
+} // namespace chrome_remote_devtools
@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "CpuProfile.h"
+#include <folly/json.h>
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "CpuProfile"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "CpuProfile"
+#define LOGI(...) ((void)0)
+#define LOGE(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+namespace profiler {
+
+// Hermes writes most numbers as strings / Hermes는 대부분의 숫자를 문자열로 작성함
+static bool toInt64(const folly::dynamic* value, int64_t& out) {
+  if (value == nullptr) {
+    return false;
+  }
+  if (value->isInt()) {
+    out = value->getInt();
+    return true;
+  }
+  if (value->isDouble()) {
+    out = static_cast<int64_t>(value->getDouble());
+    return true;
+  }
+  if (value->isString() && !value->getString().empty()) {
+    char* end = nullptr;
+    out = std::strtoll(value->getString().c_str(), &end, 10);
+    return end != nullptr && *end == '\0';
+  }
+  return false;
+}
+
+// Frame key as string, stackFrames is keyed by id strings / 문자열 프레임 키, stackFrames는 id 문자열을 키로 사용
+static bool toFrameKey(const folly::dynamic* value, std::string& out) {
+  if (value == nullptr) {
+    return false;
+  }
+  if (value->isString()) {
+    out = value->getString();
+    return true;
+  }
+  int64_t number = 0;
+  if (toInt64(value, number)) {
+    out = std::to_string(number);
+    return true;
+  }
+  return false;
+}
+
+struct ProfileNode {
+  CallFrame callFrame;
+  std::vector<int64_t> children;
+  int64_t hitCount = 0;
+};
+
+// Hermes names JS frames "name(scriptId:line:column)" / Hermes는 JS 프레임 이름을 "name(scriptId:line:column)"으로 지정함
+static void parseFrameName(const std::string& name, CallFrame& frame) {
+  frame.functionName = name;
+  if (name.empty() || name.back() != ')') {
+    return;
+  }
+  size_t open = name.rfind('(');
+  if (open == std::string::npos) {
+    return;
+  }
+  std::string location = name.substr(open + 1, name.size() - open - 2);
+  size_t firstColon = location.find(':');
+  size_t lastColon = location.rfind(':');
+  if (firstColon == std::string::npos || firstColon == lastColon) {
+    return;
+  }
+  std::string scriptId = location.substr(0, firstColon);
+  if (scriptId.empty() || scriptId.find_first_not_of("0123456789") != std::string::npos) {
+    return;
+  }
+  char* end = nullptr;
+  int64_t line = std::strtoll(location.c_str() + firstColon + 1, &end, 10);
+  int64_t column = std::strtoll(location.c_str() + lastColon + 1, nullptr, 10);
+  frame.functionName = name.substr(0, open);
+  frame.scriptId = scriptId;
+  frame.lineNumber = line > 0 ? line - 1 : 0;
+  frame.columnNumber = column > 0 ? column - 1 : 0;
+}
+
+static CallFrame toCallFrame(const folly::dynamic& stackFrame) {
+  CallFrame frame;
+  const folly::dynamic* name = stackFrame.get_ptr("name");
+  if (name != nullptr && name->isString()) {
+    parseFrameName(name->getString(), frame);
+  }
+  // Explicit fields win over the name suffix / 명시적 필드가 이름 접미사보다 우선함
+  int64_t number = 0;
+  if (toInt64(stackFrame.get_ptr("line"), number) && number > 0) {
+    frame.lineNumber = number - 1;
+  }
+  if (toInt64(stackFrame.get_ptr("column"), number) && number > 0) {
+    frame.columnNumber = number - 1;
+  }
+  const folly::dynamic* url = stackFrame.get_ptr("url");
+  if (url != nullptr && url->isString()) {
+    frame.url = url->getString();
+  }
+  if (frame.functionName.empty()) {
+    frame.functionName = "(anonymous)";
+  } else if (frame.functionName.compare(0, 3, "[GC") == 0) {
+    // Name DevTools shows for GC time / DevTools가 GC 시간에 표시하는 이름
+    frame.functionName = "(garbage collector)";
+  }
+  return frame;
+}
+
+namespace {
+
+// Builds CDP nodes from Hermes stack frames, parents always get lower ids than children /
+// Hermes 스택 프레임에서 CDP 노드 구성, 부모는 항상 자식보다 낮은 id를 가짐
+class ProfileBuilder {
+public:
+  explicit ProfileBuilder(const folly::dynamic* stackFrames) : stackFrames_(stackFrames) {
+    ProfileNode root;
+    root.callFrame.functionName = "(root)";
+    nodes_.push_back(std::move(root));
+  }
+
+  // Node id of frame key, creating it and its ancestors on first use / 프레임 키의 노드 id, 처음 사용 시 조상과 함께 생성
+  int64_t nodeFor(const std::string& key) {
+    auto found = nodeIds_.find(key);
+    if (found != nodeIds_.end()) {
+      return found->second;
+    }
+
+    // Walk up to the first ancestor that has a node, then create the chain top down. Unknown frames, the Hermes
+    // root frame and cycles end the walk at the root node /
+    // 노드가 있는 첫 조상까지 올라간 뒤 위에서부터 체인 생성. 알 수 없는 프레임, Hermes 루트 프레임, 순환은 루트 노드에서 종료
+    std::vector<std::pair<std::string, const folly::dynamic*>> chain;
+    std::unordered_set<std::string> visited;
+    int64_t parentId = kRootId;
+    std::string current = key;
+    while (true) {
+      auto it = nodeIds_.find(current);
+      if (it != nodeIds_.end()) {
+        parentId = it->second;
+        break;
+      }
+      if (!visited.insert(current).second) {
+        break;
+      }
+      const folly::dynamic* frame = stackFrames_ != nullptr ? stackFrames_->get_ptr(current) : nullptr;
+      if (frame == nullptr || !frame->isObject()) {
+        break;
+      }
+      const folly::dynamic* category = frame->get_ptr("category");
+      if (category != nullptr && category->isString() && category->getString() == "root") {
+        nodeIds_.emplace(current, kRootId);
+        break;
+      }
+      chain.emplace_back(current, frame);
+      std::string parentKey;
+      if (!toFrameKey(frame->get_ptr("parent"), parentKey)) {
+        break;
+      }
+      current = std::move(parentKey);
+    }
+
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+      int64_t id = static_cast<int64_t>(nodes_.size()) + 1;
+      ProfileNode node;
+      node.callFrame = toCallFrame(*it->second);
+      nodes_.push_back(std::move(node));
+      nodes_[static_cast<size_t>(parentId - 1)].children.push_back(id);
+      nodeIds_.emplace(std::move(it->first), id);
+      parentId = id;
+    }
+    return parentId;
+  }
+
+  void addHit(int64_t id) { nodes_[static_cast<size_t>(id - 1)].hitCount++; }
+
+  void writeNodes(common::JsonWriter& writer) const {
+    writer.beginArray();
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+      const ProfileNode& node = nodes_[i];
+      writer.beginObject();
+      writer.field("id", static_cast<int64_t>(i) + 1);
+      writer.key("callFrame");
+      writer.beginObject();
+      writer.field("functionName", node.callFrame.functionName);
+      writer.field("scriptId", node.callFrame.scriptId);
+      writer.field("url", node.callFrame.url);
+      writer.field("lineNumber", node.callFrame.lineNumber);
+      writer.field("columnNumber", node.callFrame.columnNumber);
+      writer.endObject();
+      writer.field("hitCount", node.hitCount);
+      if (!node.children.empty()) {
+        writer.key("children");
+        writer.beginArray();
+        for (int64_t child : node.children) {
+          writer.value(child);
+        }
+        writer.endArray();
+      }
+      writer.endObject();
+    }
+    writer.endArray();
+  }
+
+private:
+  static constexpr int64_t kRootId = 1;
+
+  const folly::dynamic* stackFrames_;
+  std::vector<ProfileNode> nodes_;
+  std::unordered_map<std::string, int64_t> nodeIds_;
+};
+
+struct Sample {
+  int64_t timestamp;
+  int64_t nodeId;
+};
+
+} // namespace
+
+bool writeCpuProfile(const std::string& trace, int64_t startTime, int64_t endTime, common::JsonWriter& writer) {
+  folly::dynamic parsed;
+  try {
+    parsed = folly::parseJson(trace);
+  } catch (const std::exception& e) {
+    LOGE("Failed to parse Hermes sampled trace / Hermes 샘플링 트레이스 파싱 실패: %s", e.what());
+    return false;
+  }
+  if (!parsed.isObject()) {
+    return false;
+  }
+
+  ProfileBuilder builder(parsed.get_ptr("stackFrames"));
+  std::vector<Sample> samples;
+  const folly::dynamic* traceSamples = parsed.get_ptr("samples");
+  if (traceSamples != nullptr && traceSamples->isArray()) {
+    samples.reserve(traceSamples->size());
+    for (const auto& traceSample : *traceSamples) {
+      if (!traceSample.isObject()) {
+        continue;
+      }
+      int64_t timestamp = 0;
+      if (!toInt64(traceSample.get_ptr("ts"), timestamp)) {
+        continue;
+      }
+      std::string frameKey;
+      int64_t nodeId = toFrameKey(traceSample.get_ptr("sf"), frameKey) ? builder.nodeFor(frameKey) : 1;
+      builder.addHit(nodeId);
+      samples.push_back(Sample{timestamp, nodeId});
+    }
+  }
+  std::stable_sort(samples.begin(), samples.end(),
+                   [](const Sample& a, const Sample& b) { return a.timestamp < b.timestamp; });
+
+  // Sample timestamps come from the sampler's clock, so they define the profile range /
+  // 샘플 타임스탬프는 샘플러의 시계에서 오므로 프로파일 범위를 결정함
+  if (!samples.empty()) {
+    startTime = samples.front().timestamp;
+    endTime = samples.back().timestamp;
+  }
+
+  writer.beginObject();
+  writer.key("nodes");
+  builder.writeNodes(writer);
+  writer.field("startTime", startTime);
+  writer.field("endTime", std::max(startTime, endTime));
+  writer.key("samples");
+  writer.beginArray();
+  for (const Sample& sample : samples) {
+    writer.value(sample.nodeId);
+  }
+  writer.endArray();
+  writer.key("timeDeltas");
+  writer.beginArray();
+  int64_t previous = startTime;
+  for (const Sample& sample : samples) {
+    writer.value(sample.timestamp - previous);
+    previous = sample.timestamp;
+  }
+  writer.endArray();
+  writer.endObject();
+  return true;
+}
+
+bool hottestSampledStack(const std::string& trace, std::vector<CallFrame>& frames, size_t& sampleCount) {
+  frames.clear();
+  sampleCount = 0;
+  folly::dynamic parsed;
+  try {
+    parsed = folly::parseJson(trace);
+  } catch (const std::exception& e) {
+    LOGE("Failed to parse Hermes sampled trace / Hermes 샘플링 트레이스 파싱 실패: %s", e.what());
+    return false;
+  }
+  if (!parsed.isObject()) {
+    return false;
+  }
+
+  // Leaf frame hit counts / 리프 프레임 적중 횟수
+  std::unordered_map<std::string, size_t> hits;
+  const folly::dynamic* traceSamples = parsed.get_ptr("samples");
+  if (traceSamples != nullptr && traceSamples->isArray()) {
+    for (const auto& traceSample : *traceSamples) {
+      std::string frameKey;
+      if (traceSample.isObject() && toFrameKey(traceSample.get_ptr("sf"), frameKey)) {
+        hits[frameKey]++;
+        sampleCount++;
+      }
+    }
+  }
+  std::string hottest;
+  size_t hottestHits = 0;
+  for (const auto& entry : hits) {
+    if (entry.second > hottestHits) {
+      hottest = entry.first;
+      hottestHits = entry.second;
+    }
+  }
+
+  const folly::dynamic* stackFrames = parsed.get_ptr("stackFrames");
+  std::string key = hottest;
+  std::unordered_set<std::string> visited;
+  while (!key.empty() && visited.insert(key).second) {
+    const folly::dynamic* frame = stackFrames != nullptr ? stackFrames->get_ptr(key) : nullptr;
+    if (frame == nullptr || !frame->isObject()) {
+      break;
+    }
+    const folly::dynamic* category = frame->get_ptr("category");
+    if (category != nullptr && category->isString() && category->getString() == "root") {
+      break;
+    }
+    frames.push_back(toCallFrame(*frame));
+    std::string parentKey;
+    if (!toFrameKey(frame->get_ptr("parent"), parentKey)) {
+      break;
+    }
+    key = std::move(parentKey);
+  }
+  return true;
+}
+
+} // namespace profiler
+} // namespace chrome_remote_devtools
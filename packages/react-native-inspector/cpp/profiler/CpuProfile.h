@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include "../common/JsonWriter.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace chrome_remote_devtools {
+namespace profiler {
+
+// CDP Runtime.CallFrame of a sampled JS frame / 샘플링된 JS 프레임의 CDP Runtime.CallFrame
+struct CallFrame {
+  std::string functionName;
+  std::string scriptId = "0";
+  std::string url;
+  int64_t lineNumber = -1;    // 0-based / 0부터 시작
+  int64_t columnNumber = -1;  // 0-based / 0부터 시작
+};
+
+// Convert Hermes sampled trace (Chrome trace event format: stackFrames + samples) into a CDP Profiler.Profile /
+// Hermes 샘플링 트레이스 (Chrome trace event 형식: stackFrames + samples)를 CDP Profiler.Profile로 변환
+// Stack frames become profile nodes, samples become node ids with timeDeltas in microseconds /
+// 스택 프레임은 프로파일 노드가 되고, 샘플은 마이크로초 timeDeltas와 함께 노드 id가 됨
+// @param trace Output of HermesRuntime::dumpSampledTraceToStream / HermesRuntime::dumpSampledTraceToStream의 출력
+// @param startTime Monotonic micros profiling started at, used when there are no samples / 프로파일링 시작 모노토닉 마이크로초, 샘플이 없을 때 사용
+// @param endTime Monotonic micros profiling stopped at, used when there are no samples / 프로파일링 중지 모노토닉 마이크로초, 샘플이 없을 때 사용
+// @return false if trace could not be parsed (nothing is written) / 트레이스를 파싱할 수 없으면 false (아무것도 작성하지 않음)
+bool writeCpuProfile(const std::string& trace, int64_t startTime, int64_t endTime, common::JsonWriter& writer);
+
+// Most frequently sampled stack of a Hermes sampled trace, leaf first / Hermes 샘플링 트레이스에서 가장 자주 샘플링된 스택, 리프부터
+// @param sampleCount Number of samples in trace / 트레이스의 샘플 수
+// @return false if trace could not be parsed / 트레이스를 파싱할 수 없으면 false
+bool hottestSampledStack(const std::string& trace, std::vector<CallFrame>& frames, size_t& sampleCount);
+
+} // namespace profiler
+} // namespace chrome_remote_devtools
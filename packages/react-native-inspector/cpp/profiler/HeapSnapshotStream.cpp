@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "HeapSnapshotStream.h"
+#include "../transport/CDPEventSender.h"
+#include "../common/JsonWriter.h"
+#include <chrono>
+#include <cstring>
+#include <string_view>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "HeapSnapshotStream"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "HeapSnapshotStream"
+#define LOGI(...) ((void)0)
+#define LOGE(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+namespace profiler {
+
+// Queued bytes above which the snapshot writer waits for the sender / 스냅샷 작성자가 전송을 기다리는 큐 바이트 기준
+static constexpr size_t kMaxPendingSnapshotBytes = 2 * 1024 * 1024;
+
+// Give up if the sender makes no progress for this long (disconnected) / 전송이 이 시간 동안 진행하지 않으면 포기 (연결 끊김)
+static constexpr auto kSenderStallTimeout = std::chrono::seconds(5);
+
+// Length of the trailing incomplete UTF-8 sequence (0 if the data ends on a boundary) /
+// 끝의 불완전한 UTF-8 시퀀스 길이 (경계에서 끝나면 0)
+static size_t incompleteUtf8Tail(const char* data, size_t size) {
+  size_t checked = 0;
+  while (checked < 3 && checked < size) {
+    unsigned char c = static_cast<unsigned char>(data[size - 1 - checked]);
+    if ((c & 0xC0) != 0x80) {
+      // Lead or ASCII byte / 선두 바이트 또는 ASCII 바이트
+      size_t length = (c & 0x80) == 0 ? 1 : (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : 4;
+      return length > checked + 1 ? checked + 1 : 0;
+    }
+    ++checked;
+  }
+  return 0;
+}
+
+HeapSnapshotChunkBuffer::HeapSnapshotChunkBuffer(std::string serverHost, int serverPort, size_t chunkBytes)
+    : serverHost_(std::move(serverHost)), serverPort_(serverPort), buffer_(chunkBytes) {
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+}
+
+HeapSnapshotChunkBuffer::int_type HeapSnapshotChunkBuffer::overflow(int_type ch) {
+  if (failed_ || !emitChunk(false)) {
+    return traits_type::eof();
+  }
+  if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(ch);
+    pbump(1);
+  }
+  return traits_type::not_eof(ch);
+}
+
+int HeapSnapshotChunkBuffer::sync() {
+  return !failed_ && emitChunk(false) ? 0 : -1;
+}
+
+bool HeapSnapshotChunkBuffer::finish() {
+  if (!failed_) {
+    emitChunk(true);
+  }
+  return !failed_;
+}
+
+bool HeapSnapshotChunkBuffer::emitChunk(bool final) {
+  size_t size = static_cast<size_t>(pptr() - pbase());
+  size_t tail = final ? 0 : incompleteUtf8Tail(pbase(), size);
+  size_t chunkSize = size - tail;
+
+  if (chunkSize > 0) {
+    // Escaping rarely grows snapshot text (mostly digits) / 스냅샷 텍스트는 대부분 숫자라 이스케이프로 거의 커지지 않음
+    std::string message;
+    message.reserve(chunkSize + chunkSize / 8 + 96);
+    common::JsonWriter writer(message);
+    writer.beginObject();
+    writer.field("method", "HeapProfiler.addHeapSnapshotChunk");
+    writer.key("params");
+    writer.beginObject();
+    writer.field("chunk", std::string_view(pbase(), chunkSize));
+    writer.endObject();
+    writer.endObject();
+
+    if (!transport::enqueueCDPMessageWithBackpressure(serverHost_, serverPort_, std::move(message),
+                                                      kMaxPendingSnapshotBytes, kSenderStallTimeout)) {
+      LOGE("Heap snapshot aborted after %zu bytes / %zu 바이트 후 힙 스냅샷 중단됨", bytesSent_, bytesSent_);
+      failed_ = true;
+      return false;
+    }
+    bytesSent_ += chunkSize;
+  }
+
+  // Carry the incomplete sequence into the next chunk / 불완전한 시퀀스를 다음 청크로 넘김
+  if (tail > 0) {
+    std::memmove(buffer_.data(), pbase() + chunkSize, tail);
+  }
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+  pbump(static_cast<int>(tail));
+  return true;
+}
+
+} // namespace profiler
+} // namespace chrome_remote_devtools
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace chrome_remote_devtools {
+namespace profiler {
+
+// Chunk size of HeapProfiler.addHeapSnapshotChunk events / HeapProfiler.addHeapSnapshotChunk 이벤트의 청크 크기
+constexpr size_t kHeapSnapshotChunkBytes = 64 * 1024;
+
+// Stream buffer that turns a heap snapshot into HeapProfiler.addHeapSnapshotChunk events /
+// 힙 스냅샷을 HeapProfiler.addHeapSnapshotChunk 이벤트로 바꾸는 스트림 버퍼
+// Only one chunk is held at a time and the writer is throttled to the sender, so the snapshot is never in memory whole /
+// 한 번에 청크 하나만 보관하고 작성자를 전송 속도에 맞추므로 스냅샷 전체가 메모리에 있지 않음
+// Chunks are cut on UTF-8 boundaries so every event is valid text / 모든 이벤트가 유효한 텍스트가 되도록 UTF-8 경계에서 청크를 자름
+// Must not touch JSI: it runs inside the snapshot walk / 스냅샷 순회 중에 실행되므로 JSI를 사용하면 안 됨
+class HeapSnapshotChunkBuffer : public std::streambuf {
+public:
+  HeapSnapshotChunkBuffer(std::string serverHost, int serverPort, size_t chunkBytes = kHeapSnapshotChunkBytes);
+
+  // Send the remaining bytes / 남은 바이트 전송
+  // @return false if any chunk could not be sent / 전송하지 못한 청크가 있으면 false
+  bool finish();
+
+  bool failed() const { return failed_; }
+  size_t bytesSent() const { return bytesSent_; }
+
+protected:
+  int_type overflow(int_type ch) override;
+  int sync() override;
+
+private:
+  // Send buffered bytes up to the last complete UTF-8 sequence (all bytes if final) /
+  // 마지막 완전한 UTF-8 시퀀스까지 버퍼된 바이트 전송 (final이면 전부)
+  bool emitChunk(bool final);
+
+  std::string serverHost_;
+  int serverPort_;
+  std::vector<char> buffer_;
+  size_t bytesSent_ = 0;
+  bool failed_ = false;
+};
+
+} // namespace profiler
+} // namespace chrome_remote_devtools
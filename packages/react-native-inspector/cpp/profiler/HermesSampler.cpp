@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "HermesSampler.h"
+#include <atomic>
+
+#if __has_include(<hermes/hermes.h>)
+#include <hermes/hermes.h>
+#define CRD_HERMES_AVAILABLE 1
+#endif
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "HermesSampler"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "HermesSampler"
+#define LOGI(...) ((void)0)
+#define LOGE(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+namespace profiler {
+
+// The Hermes sampler is process-wide, shared by Profiler.start and the stall watchdog /
+// Hermes 샘플러는 프로세스 전역이며 Profiler.start와 멈춤 감시기가 공유함
+static std::atomic<bool> g_cpuSamplingClaimed{false};
+
+bool isHermesRuntime(facebook::jsi::Runtime& runtime) {
+#ifdef CRD_HERMES_AVAILABLE
+  if (dynamic_cast<facebook::hermes::HermesRuntime*>(&runtime) != nullptr) {
+    return true;
+  }
+  // Decorated runtimes (tracing, debugger) hide the concrete type / 데코레이트된 런타임 (트레이싱, 디버거)은 실제 타입을 숨김
+  try {
+    return runtime.global().hasProperty(runtime, "HermesInternal");
+  } catch (...) {
+    return false;
+  }
+#else
+  (void)runtime;
+  return false;
+#endif
+}
+
+bool startCpuSampling(double frequencyHz) {
+#ifdef CRD_HERMES_AVAILABLE
+  bool expected = false;
+  if (!g_cpuSamplingClaimed.compare_exchange_strong(expected, true)) {
+    return false;
+  }
+  try {
+    facebook::hermes::HermesRuntime::enableSamplingProfiler(frequencyHz);
+    return true;
+  } catch (const std::exception& e) {
+    g_cpuSamplingClaimed.store(false);
+    LOGE("Failed to enable Hermes sampling profiler / Hermes 샘플링 프로파일러 활성화 실패: %s", e.what());
+    return false;
+  }
+#else
+  (void)frequencyHz;
+  return false;
+#endif
+}
+
+void suspendCpuSampling() {
+#ifdef CRD_HERMES_AVAILABLE
+  try {
+    facebook::hermes::HermesRuntime::disableSamplingProfiler();
+  } catch (const std::exception& e) {
+    LOGE("Failed to disable Hermes sampling profiler / Hermes 샘플링 프로파일러 비활성화 실패: %s", e.what());
+  }
+#endif
+}
+
+void cancelCpuSampling() {
+  suspendCpuSampling();
+  g_cpuSamplingClaimed.store(false);
+}
+
+bool stopCpuSampling(std::ostream& trace) {
+#ifdef CRD_HERMES_AVAILABLE
+  try {
+    facebook::hermes::HermesRuntime::disableSamplingProfiler();
+    facebook::hermes::HermesRuntime::dumpSampledTraceToStream(trace);
+    g_cpuSamplingClaimed.store(false);
+    return true;
+  } catch (const std::exception& e) {
+    g_cpuSamplingClaimed.store(false);
+    LOGE("Failed to dump Hermes sampled trace / Hermes 샘플링 트레이스 덤프 실패: %s", e.what());
+    return false;
+  }
+#else
+  (void)trace;
+  return false;
+#endif
+}
+
+bool startHeapSampling(facebook::jsi::Runtime& runtime, size_t samplingIntervalBytes) {
+  if (!isHermesRuntime(runtime)) {
+    return false;
+  }
+  try {
+    runtime.instrumentation().startHeapSampling(samplingIntervalBytes);
+    return true;
+  } catch (const std::exception& e) {
+    LOGE("Failed to start Hermes heap sampling / Hermes 힙 샘플링 시작 실패: %s", e.what());
+    return false;
+  }
+}
+
+bool stopHeapSampling(facebook::jsi::Runtime& runtime, std::ostream& profile) {
+  try {
+    runtime.instrumentation().stopHeapSampling(profile);
+    return true;
+  } catch (const std::exception& e) {
+    LOGE("Failed to stop Hermes heap sampling / Hermes 힙 샘플링 중지 실패: %s", e.what());
+    return false;
+  }
+}
+
+} // namespace profiler
+} // namespace chrome_remote_devtools
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <cstddef>
+#include <ostream>
+
+namespace chrome_remote_devtools {
+namespace profiler {
+
+// Thin wrapper over the Hermes sampling profiler / Hermes 샘플링 프로파일러의 얇은 래퍼
+// Compiles to stubs returning false when Hermes headers are not available (JSC builds) /
+// Hermes 헤더가 없으면 (JSC 빌드) false를 반환하는 스텁으로 컴파일됨
+
+// Check if runtime is Hermes / 런타임이 Hermes인지 확인
+bool isHermesRuntime(facebook::jsi::Runtime& runtime);
+
+// Start sampling the JS thread / JS 스레드 샘플링 시작
+// React Native registers its Hermes runtime for sampling at creation, so only the sampler thread is started here /
+// React Native는 생성 시 Hermes 런타임을 샘플링 대상으로 등록하므로 여기서는 샘플러 스레드만 시작함
+// @param frequencyHz Mean sampling frequency / 평균 샘플링 빈도
+// Only one owner (Profiler.start or the stall watchdog) can sample at a time / 한 번에 하나의 소유자 (Profiler.start 또는 멈춤 감시기)만 샘플링 가능
+// @return false if the sampling profiler is not available or busy / 샘플링 프로파일러를 사용할 수 없거나 사용 중이면 false
+bool startCpuSampling(double frequencyHz);
+
+// Stop the sampler thread but keep the samples for stopCpuSampling (any thread) /
+// 샘플러 스레드는 멈추지만 샘플은 stopCpuSampling을 위해 유지 (모든 스레드)
+void suspendCpuSampling();
+
+// Stop sampling and give up the sampler without dumping (any thread) / 덤프 없이 샘플링을 중지하고 샘플러를 반환 (모든 스레드)
+void cancelCpuSampling();
+
+// Stop sampling and write the sampled trace (Chrome trace event format), JS thread only /
+// 샘플링을 중지하고 샘플링된 트레이스 작성 (Chrome trace event 형식), JS 스레드 전용
+// @return false if the sampling profiler is not available / 샘플링 프로파일러를 사용할 수 없으면 false
+bool stopCpuSampling(std::ostream& trace);
+
+// Start sampling heap allocations / 힙 할당 샘플링 시작
+// @param samplingIntervalBytes Mean bytes allocated between samples / 샘플 간 평균 할당 바이트
+// @return false if the sampling heap profiler is not available / 샘플링 힙 프로파일러를 사용할 수 없으면 false
+bool startHeapSampling(facebook::jsi::Runtime& runtime, size_t samplingIntervalBytes);
+
+// Stop sampling heap allocations and write the sampled allocation tree (JSON) / 힙 할당 샘플링을 중지하고 샘플링된 할당 트리 작성 (JSON)
+// @return false if the sampling heap profiler is not available / 샘플링 힙 프로파일러를 사용할 수 없으면 false
+bool stopHeapSampling(facebook::jsi::Runtime& runtime, std::ostream& profile);
+
+} // namespace profiler
+} // namespace chrome_remote_devtools
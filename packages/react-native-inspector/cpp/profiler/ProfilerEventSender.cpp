@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "ProfilerEventSender.h"
+#include "../ConsoleHook.h" // For SendCDPMessageCallback / SendCDPMessageCallback을 위해
+#include "../transport/CDPEventSender.h"
+#include "../common/JsonWriter.h"
+#include "../common/JSIHandleCache.h"
+#include "../common/HookMetrics.h"
+#include <atomic>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "ProfilerEventSender"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "ProfilerEventSender"
+#define LOGI(...) ((void)0)
+#define LOGE(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#define LOGW(...)
+#endif
+
+// Forward declaration / 전방 선언
+namespace chrome_remote_devtools {
+  extern std::atomic<SendCDPMessageCallback> g_sendCDPMessageCallback;
+}
+
+namespace chrome_remote_devtools {
+namespace profiler {
+
+void getServerInfo(facebook::jsi::Runtime& runtime, std::string& serverHost, int& serverPort) {
+  serverHost = "localhost";
+  serverPort = 8080;
+  try {
+    facebook::jsi::Object global = runtime.global();
+    facebook::jsi::Value hostValue = common::getCachedProperty(runtime, global, common::PropName::ServerHost);
+    if (hostValue.isString()) {
+      serverHost = hostValue.asString(runtime).utf8(runtime);
+    }
+    facebook::jsi::Value portValue = common::getCachedProperty(runtime, global, common::PropName::ServerPort);
+    if (portValue.isNumber()) {
+      serverPort = static_cast<int>(portValue.asNumber());
+    }
+  } catch (...) {
+    // Use defaults / 기본값 사용
+  }
+}
+
+void sendCDPProfilerMessage(facebook::jsi::Runtime& runtime, const std::string& message) {
+  common::HookScope hookScope(common::HookSite::ProfilerEvent);
+  if (chrome_remote_devtools::g_sendCDPMessageCallback == nullptr) {
+    LOGE("Platform callback not available for CDP profiler message / CDP 프로파일러 메시지를 위한 플랫폼 콜백을 사용할 수 없음");
+    return;
+  }
+  std::string serverHost;
+  int serverPort;
+  getServerInfo(runtime, serverHost, serverPort);
+  // Same sender thread as console and network events / console, network 이벤트와 같은 전송 스레드
+  bool enqueued = transport::enqueueCDPMessage(serverHost, serverPort, message);
+  common::recordHookEvent(common::HookSite::ProfilerEvent, message.size(), enqueued);
+}
+
+void sendEmptyResult(facebook::jsi::Runtime& runtime, int64_t id) {
+  std::string& buffer = common::acquireJsonBuffer();
+  common::JsonWriter writer(buffer);
+  writer.beginObject();
+  writer.field("id", id);
+  writer.key("result");
+  writer.beginObject();
+  writer.endObject();
+  writer.endObject();
+  sendCDPProfilerMessage(runtime, buffer);
+}
+
+void sendErrorResponse(facebook::jsi::Runtime& runtime, int64_t id, int code, const std::string& message) {
+  std::string& buffer = common::acquireJsonBuffer();
+  common::JsonWriter writer(buffer);
+  writer.beginObject();
+  writer.field("id", id);
+  writer.key("error");
+  writer.beginObject();
+  writer.field("code", code);
+  writer.field("message", message);
+  writer.endObject();
+  writer.endObject();
+  sendCDPProfilerMessage(runtime, buffer);
+}
+
+} // namespace profiler
+} // namespace chrome_remote_devtools
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <cstdint>
+#include <string>
+
+namespace chrome_remote_devtools {
+namespace profiler {
+
+// Get server host and port from global / 전역에서 서버 호스트와 포트 가져오기
+void getServerInfo(facebook::jsi::Runtime& runtime, std::string& serverHost, int& serverPort);
+
+// Send serialized CDP message (command response or event) / 직렬화된 CDP 메시지 전송 (명령 응답 또는 이벤트)
+void sendCDPProfilerMessage(facebook::jsi::Runtime& runtime, const std::string& message);
+
+// Send {"id":id,"result":{}} / {"id":id,"result":{}} 전송
+void sendEmptyResult(facebook::jsi::Runtime& runtime, int64_t id);
+
+// Send CDP error response / CDP 에러 응답 전송
+void sendErrorResponse(facebook::jsi::Runtime& runtime, int64_t id, int code, const std::string& message);
+
+} // namespace profiler
+} // namespace chrome_remote_devtools
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "SamplingHeapProfile.h"
+#include <folly/json.h>
+#include <cstdlib>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "SamplingHeapProfile"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "SamplingHeapProfile"
+#define LOGI(...) ((void)0)
+#define LOGE(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#define LOGW(...)
+#endif
+
+namespace chrome_remote_devtools {
+namespace profiler {
+
+// Deeper trees are cut, each level is one JS frame / 더 깊은 트리는 잘림, 각 레벨은 JS 프레임 하나
+static constexpr int kMaxDepth = 4096;
+
+// Each frame nests a node object and its children array, plus the root object and spare levels /
+// 각 프레임은 노드 객체와 children 배열로 중첩되며, 루트 객체와 여유 레벨을 더함
+static constexpr unsigned int kParseRecursionLimit = 2 * kMaxDepth + 16;
+
+static bool toNumber(const folly::dynamic* value, double& out) {
+  if (value == nullptr) {
+    return false;
+  }
+  if (value->isNumber()) {
+    out = value->asDouble();
+    return true;
+  }
+  if (value->isString() && !value->getString().empty()) {
+    char* end = nullptr;
+    out = std::strtod(value->getString().c_str(), &end);
+    return end != nullptr && *end == '\0';
+  }
+  return false;
+}
+
+static int64_t toInt64(const folly::dynamic* value, int64_t fallback) {
+  double number = 0;
+  return toNumber(value, number) ? static_cast<int64_t>(number) : fallback;
+}
+
+static void writeCallFrame(const folly::dynamic* callFrame, common::JsonWriter& writer) {
+  const folly::dynamic* functionName = callFrame != nullptr ? callFrame->get_ptr("functionName") : nullptr;
+  const folly::dynamic* scriptId = callFrame != nullptr ? callFrame->get_ptr("scriptId") : nullptr;
+  const folly::dynamic* url = callFrame != nullptr ? callFrame->get_ptr("url") : nullptr;
+
+  writer.beginObject();
+  writer.field("functionName", functionName != nullptr && functionName->isString() ? functionName->getString() : std::string());
+  // CDP scriptId is a string, Hermes may write a number / CDP scriptId는 문자열이지만 Hermes는 숫자로 작성할 수 있음
+  if (scriptId != nullptr && scriptId->isString()) {
+    writer.field("scriptId", scriptId->getString());
+  } else {
+    writer.field("scriptId", std::to_string(toInt64(scriptId, 0)));
+  }
+  writer.field("url", url != nullptr && url->isString() ? url->getString() : std::string());
+  writer.field("lineNumber", toInt64(callFrame != nullptr ? callFrame->get_ptr("lineNumber") : nullptr, -1));
+  writer.field("columnNumber", toInt64(callFrame != nullptr ? callFrame->get_ptr("columnNumber") : nullptr, -1));
+  writer.endObject();
+}
+
+static void writeNode(const folly::dynamic& node, int depth, common::JsonWriter& writer) {
+  double selfSize = 0;
+  toNumber(node.get_ptr("selfSize"), selfSize);
+
+  writer.beginObject();
+  writer.key("callFrame");
+  writeCallFrame(node.get_ptr("callFrame"), writer);
+  writer.field("selfSize", selfSize);
+  writer.field("id", toInt64(node.get_ptr("id"), 0));
+  writer.key("children");
+  writer.beginArray();
+  const folly::dynamic* children = node.get_ptr("children");
+  if (children != nullptr && children->isArray() && depth < kMaxDepth) {
+    for (const auto& child : *children) {
+      if (child.isObject()) {
+        writeNode(child, depth + 1, writer);
+      }
+    }
+  }
+  writer.endArray();
+  writer.endObject();
+}
+
+bool writeSamplingHeapProfile(const std::string& trace, common::JsonWriter& writer) {
+  folly::dynamic parsed;
+  try {
+    // folly's default limit of 100 rejects any realistic JS stack / folly 기본 한도 100은 실제 JS 스택 대부분을 거부함
+    folly::json::serialization_opts opts;
+    opts.recursion_limit = kParseRecursionLimit;
+    parsed = folly::parseJson(trace, opts);
+  } catch (const std::exception& e) {
+    LOGE("Failed to parse Hermes heap sampling profile / Hermes 힙 샘플링 프로파일 파싱 실패: %s", e.what());
+    return false;
+  }
+  if (!parsed.isObject()) {
+    return false;
+  }
+
+  writer.beginObject();
+  writer.key("head");
+  const folly::dynamic* head = parsed.get_ptr("head");
+  if (head != nullptr && head->isObject()) {
+    writeNode(*head, 0, writer);
+  } else {
+    // Nothing was sampled, emit an empty root / 샘플링된 것이 없으므로 빈 루트 작성
+    writer.beginObject();
+    writer.key("callFrame");
+    writeCallFrame(nullptr, writer);
+    writer.field("selfSize", 0);
+    writer.field("id", 1);
+    writer.key("children");
+    writer.beginArray();
+    writer.endArray();
+    writer.endObject();
+  }
+  writer.key("samples");
+  writer.beginArray();
+  const folly::dynamic* samples = parsed.get_ptr("samples");
+  if (samples != nullptr && samples->isArray()) {
+    for (const auto& sample : *samples) {
+      if (!sample.isObject()) {
+        continue;
+      }
+      double size = 0;
+      double ordinal = 0;
+      toNumber(sample.get_ptr("size"), size);
+      toNumber(sample.get_ptr("ordinal"), ordinal);
+      writer.beginObject();
+      writer.field("size", size);
+      writer.field("nodeId", toInt64(sample.get_ptr("nodeId"), 0));
+      writer.field("ordinal", ordinal);
+      writer.endObject();
+    }
+  }
+  writer.endArray();
+  writer.endObject();
+  return true;
+}
+
+} // namespace profiler
+} // namespace chrome_remote_devtools
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include "../common/JsonWriter.h"
+#include <string>
+
+namespace chrome_remote_devtools {
+namespace profiler {
+
+// Convert Hermes sampled allocation tree into a CDP HeapProfiler.SamplingHeapProfile /
+// Hermes 샘플링 할당 트리를 CDP HeapProfiler.SamplingHeapProfile로 변환
+// Node ids are kept so samples still point at their nodes, missing call frame fields get CDP defaults /
+// 샘플이 노드를 계속 가리키도록 노드 id를 유지하고, 없는 호출 프레임 필드는 CDP 기본값으로 채움
+// @param trace Output of Instrumentation::stopHeapSampling / Instrumentation::stopHeapSampling의 출력
+// @return false if trace could not be parsed (nothing is written) / 트레이스를 파싱할 수 없으면 false (아무것도 작성하지 않음)
+bool writeSamplingHeapProfile(const std::string& trace, common::JsonWriter& writer);
+
+} // namespace profiler
+} // namespace chrome_remote_devtools
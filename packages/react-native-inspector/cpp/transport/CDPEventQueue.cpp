@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "CDPEventQueue.h"
+
+namespace chrome_remote_devtools {
+namespace transport {
+
+static size_t roundUpToPowerOfTwo(size_t value) {
+  size_t result = 2;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+CDPEventQueue::CDPEventQueue(size_t capacity) {
+  size_t size = roundUpToPowerOfTwo(capacity);
+  cells_.reset(new Cell[size]);
+  mask_ = size - 1;
+  // Each cell starts ready for the producer of the same position / 각 셀은 같은 위치의 생산자를 위해 준비된 상태로 시작
+  for (size_t i = 0; i < size; i++) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+bool CDPEventQueue::tryPush(CDPEvent&& event) {
+  Cell* cell = nullptr;
+  size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+  for (;;) {
+    cell = &cells_[pos & mask_];
+    size_t seq = cell->sequence.load(std::memory_order_acquire);
+    intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+    if (diff == 0) {
+      // Cell is free, claim the position / 셀이 비어 있으므로 위치 확보
+      if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // Consumer has not released this cell yet: queue is full / 소비자가 아직 셀을 해제하지 않음: 큐가 가득 참
+      return false;
+    } else {
+      // Another producer claimed it, reload / 다른 생산자가 확보함, 다시 로드
+      pos = enqueuePos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  cell->event = std::move(event);
+  // Publish to consumer / 소비자에게 게시
+  cell->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+bool CDPEventQueue::tryPop(CDPEvent& event) {
+  size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+  Cell* cell = &cells_[pos & mask_];
+  size_t seq = cell->sequence.load(std::memory_order_acquire);
+  intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+  if (diff < 0) {
+    // Nothing published at this position yet / 이 위치에 아직 게시된 것이 없음
+    return false;
+  }
+
+  // Single consumer: no CAS needed / 단일 소비자: CAS 불필요
+  dequeuePos_.store(pos + 1, std::memory_order_relaxed);
+  event = std::move(cell->event);
+  // Release cell for the producer one lap ahead / 한 바퀴 앞의 생산자를 위해 셀 해제
+  cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+  return true;
+}
+
+bool CDPEventQueue::empty() const {
+  size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+  const Cell& cell = cells_[pos & mask_];
+  return cell.sequence.load(std::memory_order_acquire) != pos + 1;
+}
+
+} // namespace transport
+} // namespace chrome_remote_devtools
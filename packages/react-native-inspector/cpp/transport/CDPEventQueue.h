@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace chrome_remote_devtools {
+namespace transport {
+
+// Serialized CDP event waiting to be sent / 전송 대기 중인 직렬화된 CDP 이벤트
+struct CDPEvent {
+  std::string serverHost;
+  int serverPort = 0;
+  std::string message;
+};
+
+// Bounded lock-free MPSC queue (Vyukov-style ring with per-cell sequence numbers) /
+// 제한된 lock-free MPSC 큐 (셀별 시퀀스 번호를 가진 Vyukov 방식 링)
+// Producers (JS thread, network threads) only do one CAS + one move / 생산자(JS 스레드, 네트워크 스레드)는 CAS 한 번과 move 한 번만 수행
+// Exactly one consumer (sender thread) may call tryPop / 정확히 하나의 소비자(전송 스레드)만 tryPop 호출 가능
+class CDPEventQueue {
+public:
+  // Capacity is rounded up to a power of two / 용량은 2의 거듭제곱으로 올림됨
+  explicit CDPEventQueue(size_t capacity);
+
+  CDPEventQueue(const CDPEventQueue&) = delete;
+  CDPEventQueue& operator=(const CDPEventQueue&) = delete;
+
+  // Try to enqueue event, returns false if queue is full / 이벤트 추가 시도, 큐가 가득 차면 false 반환
+  bool tryPush(CDPEvent&& event);
+
+  // Try to dequeue event, returns false if queue is empty / 이벤트 꺼내기 시도, 큐가 비어 있으면 false 반환
+  bool tryPop(CDPEvent& event);
+
+  // Approximate emptiness check (consumer side) / 대략적인 비어 있음 확인 (소비자 측)
+  bool empty() const;
+
+  size_t capacity() const { return mask_ + 1; }
+
+private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    CDPEvent event;
+  };
+
+  // Keep producer and consumer indices on separate cache lines / 생산자와 소비자 인덱스를 별도 캐시 라인에 유지
+  static constexpr size_t kCacheLineSize = 64;
+
+  std::unique_ptr<Cell[]> cells_;
+  size_t mask_;
+  alignas(kCacheLineSize) std::atomic<size_t> enqueuePos_{0};
+  alignas(kCacheLineSize) std::atomic<size_t> dequeuePos_{0};
+};
+
+} // namespace transport
+} // namespace chrome_remote_devtools
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "CDPEventSender.h"
+#include "CDPEventQueue.h"
+#include "CDPMessageBatcher.h"
+#include "../ConsoleHook.h" // For SendCDPMessageCallback / SendCDPMessageCallback을 위해
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Platform-specific log support / 플랫폼별 로그 지원
+#ifdef __ANDROID__
+#include <android/log.h>
+#define LOG_TAG "CDPEventSender"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+#define LOGW(...) __android_log_print(ANDROID_LOG_WARN, LOG_TAG, __VA_ARGS__)
+#elif defined(__APPLE__)
+#define LOG_TAG "CDPEventSender"
+#define LOGI(...) ((void)0)
+#define LOGE(...) ((void)0)
+#define LOGW(...) ((void)0)
+#else
+#define LOGI(...)
+#define LOGE(...)
+#define LOGW(...)
+#endif
+
+// Forward declaration / 전방 선언
+namespace chrome_remote_devtools {
+  extern std::atomic<SendCDPMessageCallback> g_sendCDPMessageCallback;
+}
+
+namespace chrome_remote_devtools {
+namespace transport {
+
+// Queue capacity (events) / 큐 용량 (이벤트 수)
+// Large enough to absorb startup log storms without dropping / 시작 시 로그 폭주를 버리지 않고 흡수할 만큼 충분히 큼
+static constexpr size_t kQueueCapacity = 8192;
+
+// Safety net so a missed wake-up can never stall the sender / 놓친 깨우기로 전송이 멈추지 않도록 하는 안전장치
+static constexpr auto kIdleWaitTimeout = std::chrono::milliseconds(50);
+
+
+namespace {
+
+// Sender thread lifecycle / 전송 스레드 생명주기
+enum class SenderPhase : uint8_t { Stopped, Starting, Running, Stopping };
+
+struct SenderState {
+  CDPEventQueue queue{kQueueCapacity};
+  std::atomic<uint64_t> droppedCount{0};
+  // Payload bytes enqueued but not yet delivered to the platform callback / 추가되었지만 아직 플랫폼 콜백에 전달되지 않은 페이로드 바이트
+  std::atomic<size_t> pendingBytes{0};
+  std::atomic<size_t> pendingCount{0};
+
+  // Producers blocked by backpressure wait here for deliveries / 백프레셔로 블록된 생산자가 전달을 기다리는 곳
+  std::mutex progressMutex;
+  std::condition_variable progressCondition;
+  std::atomic<int> progressWaiters{0};
+
+  // Wake-up handshake between producers and sender / 생산자와 전송 스레드 간 깨우기 핸드셰이크
+  std::mutex wakeMutex;
+  std::condition_variable wakeCondition;
+  std::atomic<bool> senderIdle{false};
+
+  // Thread lifecycle / 스레드 생명주기
+  // Transitions are claimed on phase, so producers starting the sender never wait for a stop in progress /
+  // 전환은 phase로 점유하므로 전송 스레드를 시작하는 생산자는 진행 중인 중지를 기다리지 않음
+  std::atomic<SenderPhase> phase{SenderPhase::Stopped};
+  // Set by startCDPEventSender and cleared by stopCDPEventSender; producers never respawn the thread without it /
+  // startCDPEventSender가 설정하고 stopCDPEventSender가 해제, 이 값 없이는 생산자가 스레드를 다시 생성하지 않음
+  std::atomic<bool> enabled{false};
+  std::mutex lifecycleMutex;  // Serializes stop requests / 중지 요청 직렬화
+  std::thread thread;         // Only touched by the owner of Starting or Stopping / Starting 또는 Stopping 점유자만 접근
+};
+
+// Intentionally leaked so static destruction order never joins a live thread /
+// 정적 소멸 순서가 살아 있는 스레드를 join하지 않도록 의도적으로 해제하지 않음
+SenderState& getSenderState() {
+  static SenderState* state = new SenderState();
+  return *state;
+}
+
+void deliver(const char* serverHost, int serverPort, const char* payload) {
+  SendCDPMessageCallback callback = chrome_remote_devtools::g_sendCDPMessageCallback.load(std::memory_order_acquire);
+  if (callback == nullptr) {
+    LOGW("Platform callback cleared, dropping CDP message / 플랫폼 콜백이 해제되어 CDP 메시지를 버림");
+    return;
+  }
+  try {
+    callback(serverHost, serverPort, payload);
+  } catch (const std::exception& e) {
+    LOGE("Failed to send CDP message via platform callback: %s", e.what());
+  } catch (...) {
+    LOGE("Failed to send CDP message via platform callback (unknown exception) / 플랫폼 콜백을 통해 CDP 메시지 전송 실패 (알 수 없는 예외)");
+  }
+}
+
+// Batcher totals already subtracted from the pending counters / 대기 카운터에서 이미 뺀 배처 합계
+struct ReleasedTotals {
+  size_t events = 0;
+  size_t bytes = 0;
+};
+
+// Release what the batcher delivered since the last call and wake blocked producers /
+// 마지막 호출 이후 배처가 전달한 만큼 해제하고 블록된 생산자를 깨움
+void releaseDelivered(SenderState& state, const CDPMessageBatcher& batcher, ReleasedTotals& released) {
+  size_t events = batcher.deliveredEvents();
+  if (events == released.events) {
+    return;
+  }
+  size_t bytes = batcher.deliveredBytes();
+  // Unsigned differences stay correct when the totals wrap / 합계가 순환해도 부호 없는 차이는 정확함
+  state.pendingBytes.fetch_sub(bytes - released.bytes);
+  state.pendingCount.fetch_sub(events - released.events, std::memory_order_relaxed);
+  released.events = events;
+  released.bytes = bytes;
+  // Pairs with the waiter count taken before the producer re-reads pendingBytes /
+  // 생산자가 pendingBytes를 다시 읽기 전에 올린 대기자 수와 짝을 이룸
+  if (state.progressWaiters.load() > 0) {
+    std::lock_guard<std::mutex> lock(state.progressMutex);
+    state.progressCondition.notify_all();
+  }
+}
+
+void senderLoop(SenderState& state) {
+  // Batcher lives on the sender thread only / 배처는 전송 스레드에만 존재
+  CDPMessageBatcher batcher(BatchPolicy(), deliver);
+  ReleasedTotals released;
+  CDPEvent event;
+  for (;;) {
+    // Drain everything currently published into the batch / 현재 게시된 모든 이벤트를 배치에 추가
+    while (state.queue.tryPop(event)) {
+      batcher.add(std::move(event));
+      releaseDelivered(state, batcher, released);
+    }
+
+    if (state.phase.load(std::memory_order_acquire) == SenderPhase::Stopping) {
+      // Final drain after stop request / 중지 요청 후 마지막 처리
+      while (state.queue.tryPop(event)) {
+        batcher.add(std::move(event));
+      }
+      batcher.flush();
+      releaseDelivered(state, batcher, released);
+      break;
+    }
+
+    batcher.flushIfDue(std::chrono::steady_clock::now());
+    releaseDelivered(state, batcher, released);
+
+    std::unique_lock<std::mutex> lock(state.wakeMutex);
+    state.senderIdle.store(true, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    // Re-check after announcing idle so a concurrent push is not missed /
+    // 유휴 상태를 알린 후 다시 확인하여 동시 추가를 놓치지 않음
+    if (state.queue.empty() && state.phase.load(std::memory_order_acquire) != SenderPhase::Stopping) {
+      // Sleep until new events arrive or the pending batch is due / 새 이벤트가 도착하거나 대기 중인 배치의 기한까지 대기
+      auto wakeTime = std::chrono::steady_clock::now() + kIdleWaitTimeout;
+      if (batcher.hasPending() && batcher.deadline() < wakeTime) {
+        wakeTime = batcher.deadline();
+      }
+      state.wakeCondition.wait_until(lock, wakeTime);
+    }
+    state.senderIdle.store(false, std::memory_order_relaxed);
+  }
+}
+
+void wakeSender(SenderState& state) {
+  // Order the publish above before reading the idle flag / 위의 게시를 유휴 플래그 읽기보다 먼저 순서화
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (state.senderIdle.load(std::memory_order_seq_cst)) {
+    std::lock_guard<std::mutex> lock(state.wakeMutex);
+    state.wakeCondition.notify_one();
+  }
+}
+
+// Spawn the sender thread unless another thread owns the lifecycle; lock-free /
+// 다른 스레드가 생명주기를 점유하고 있지 않으면 전송 스레드 생성, lock-free
+void spawnSender(SenderState& state) {
+  SenderPhase expected = SenderPhase::Stopped;
+  if (!state.phase.compare_exchange_strong(expected, SenderPhase::Starting, std::memory_order_acq_rel)) {
+    // Running, or a start/stop is in progress; queued events are sent once it settles /
+    // 실행 중이거나 시작/중지가 진행 중이며, 큐의 이벤트는 정리된 후 전송됨
+    return;
+  }
+  if (!state.enabled.load(std::memory_order_acquire)) {
+    // Stopped while this producer was claiming the start / 이 생산자가 시작을 점유하는 동안 중지됨
+    state.phase.store(SenderPhase::Stopped, std::memory_order_release);
+    return;
+  }
+  try {
+    state.thread = std::thread([&state]() { senderLoop(state); });
+    state.phase.store(SenderPhase::Running, std::memory_order_release);
+    LOGI("CDP event sender thread started / CDP 이벤트 전송 스레드 시작됨");
+  } catch (const std::exception& e) {
+    state.phase.store(SenderPhase::Stopped, std::memory_order_release);
+    LOGE("Failed to start CDP event sender thread: %s", e.what());
+  }
+}
+
+// Producer fast path: one acquire load once the sender runs / 생산자 빠른 경로: 전송 스레드가 실행 중이면 acquire 로드 한 번
+// Returns false while the sender is stopped, so the caller drops the event instead of queueing it /
+// 전송 스레드가 중지된 동안 false를 반환하므로 호출자는 이벤트를 큐에 넣지 않고 버림
+bool ensureSenderStarted(SenderState& state) {
+  if (state.phase.load(std::memory_order_acquire) == SenderPhase::Running) {
+    return true;
+  }
+  if (!state.enabled.load(std::memory_order_acquire)) {
+    return false;
+  }
+  spawnSender(state);
+  return true;
+}
+
+} // namespace
+
+void startCDPEventSender() {
+  SenderState& state = getSenderState();
+  state.enabled.store(true, std::memory_order_release);
+  spawnSender(state);
+}
+
+void stopCDPEventSender() {
+  SenderState& state = getSenderState();
+  std::lock_guard<std::mutex> lock(state.lifecycleMutex);
+  state.enabled.store(false, std::memory_order_release);
+  SenderPhase expected = SenderPhase::Running;
+  while (!state.phase.compare_exchange_weak(expected, SenderPhase::Stopping, std::memory_order_acq_rel)) {
+    if (expected == SenderPhase::Stopped) {
+      return;
+    }
+    // A producer is spawning the thread, which is brief / 생산자가 스레드를 생성 중이며 잠깐이면 끝남
+    std::this_thread::yield();
+    expected = SenderPhase::Running;
+  }
+  {
+    std::lock_guard<std::mutex> wakeLock(state.wakeMutex);
+    state.wakeCondition.notify_one();
+  }
+  if (state.thread.joinable()) {
+    state.thread.join();
+  }
+  state.phase.store(SenderPhase::Stopped, std::memory_order_release);
+  LOGI("CDP event sender thread stopped / CDP 이벤트 전송 스레드 중지됨");
+}
+
+bool enqueueCDPMessage(const std::string& serverHost, int serverPort, std::string message) {
+  SenderState& state = getSenderState();
+  if (!ensureSenderStarted(state)) {
+    return false;
+  }
+
+  CDPEvent event;
+  event.serverHost = serverHost;
+  event.serverPort = serverPort;
+  event.message = std::move(message);
+  size_t size = event.message.size();
+  state.pendingBytes.fetch_add(size, std::memory_order_relaxed);
+  state.pendingCount.fetch_add(1, std::memory_order_relaxed);
+  if (!state.queue.tryPush(std::move(event))) {
+    state.pendingBytes.fetch_sub(size, std::memory_order_relaxed);
+    state.pendingCount.fetch_sub(1, std::memory_order_relaxed);
+    uint64_t dropped = state.droppedCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    // Log sparsely to avoid amplifying the storm / 폭주를 키우지 않도록 드물게 로그
+    if ((dropped & (dropped - 1)) == 0) {
+      LOGW("CDP event queue full, dropped %llu messages / CDP 이벤트 큐가 가득 차 %llu개 메시지 버림",
+           static_cast<unsigned long long>(dropped), static_cast<unsigned long long>(dropped));
+    }
+    return false;
+  }
+
+  wakeSender(state);
+  return true;
+}
+
+bool enqueueCDPMessageWithBackpressure(const std::string& serverHost,
+                                       int serverPort,
+                                       std::string message,
+                                       size_t maxPendingBytes,
+                                       std::chrono::milliseconds stallTimeout) {
+  SenderState& state = getSenderState();
+  if (!ensureSenderStarted(state)) {
+    return false;
+  }
+
+  // Wait while the sender is behind; the deadline moves whenever it makes progress /
+  // 전송 스레드가 밀려 있는 동안 대기, 진행이 있을 때마다 기한 연장
+  auto deadline = std::chrono::steady_clock::now() + stallTimeout;
+  size_t lastPending = state.pendingBytes.load(std::memory_order_relaxed);
+  std::unique_lock<std::mutex> lock(state.progressMutex, std::defer_lock);
+  for (;;) {
+    if (!state.enabled.load(std::memory_order_acquire) ||
+        chrome_remote_devtools::g_sendCDPMessageCallback.load(std::memory_order_acquire) == nullptr) {
+      return false;
+    }
+    size_t pending = state.pendingBytes.load();
+    if (pending <= maxPendingBytes) {
+      CDPEvent event;
+      event.serverHost = serverHost;
+      event.serverPort = serverPort;
+      event.message = std::move(message);
+      size_t size = event.message.size();
+      state.pendingBytes.fetch_add(size, std::memory_order_relaxed);
+      state.pendingCount.fetch_add(1, std::memory_order_relaxed);
+      if (state.queue.tryPush(std::move(event))) {
+        wakeSender(state);
+        return true;
+      }
+      // Queue full of small messages, keep waiting / 작은 메시지로 큐가 가득 차 있으므로 계속 대기
+      state.pendingBytes.fetch_sub(size, std::memory_order_relaxed);
+      state.pendingCount.fetch_sub(1, std::memory_order_relaxed);
+      message = std::move(event.message);
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (pending < lastPending) {
+      lastPending = pending;
+      deadline = now + stallTimeout;
+    } else if (now >= deadline) {
+      LOGW("CDP sender stalled for %lld ms, giving up bulk message / CDP 전송이 %lld ms 동안 멈춰 대량 메시지 포기",
+           static_cast<long long>(stallTimeout.count()), static_cast<long long>(stallTimeout.count()));
+      return false;
+    }
+    wakeSender(state);
+
+    // Sleep until the sender delivers something; the timeout only bounds a callback cleared while waiting /
+    // 전송 스레드가 무언가를 전달할 때까지 대기, 타임아웃은 대기 중 콜백이 해제된 경우만 제한함
+    lock.lock();
+    state.progressWaiters.fetch_add(1);
+    if (state.pendingBytes.load() == pending) {
+      auto wakeTime = std::min(deadline, now + kIdleWaitTimeout);
+      state.progressCondition.wait_until(lock, wakeTime);
+    }
+    state.progressWaiters.fetch_sub(1);
+    lock.unlock();
+  }
+}
+
+size_t getPendingCDPMessageBytes() {
+  return getSenderState().pendingBytes.load(std::memory_order_relaxed);
+}
+
+size_t getPendingCDPMessageCount() {
+  return getSenderState().pendingCount.load(std::memory_order_relaxed);
+}
+
+uint64_t getDroppedCDPMessageCount() {
+  return getSenderState().droppedCount.load(std::memory_order_relaxed);
+}
+
+} // namespace transport
+} // namespace chrome_remote_devtools
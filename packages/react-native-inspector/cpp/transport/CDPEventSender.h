@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace chrome_remote_devtools {
+namespace transport {
+
+// Start background sender thread (idempotent) / 백그라운드 전송 스레드 시작 (멱등)
+void startCDPEventSender();
+
+// Drain pending events and stop sender thread until the next start / 대기 중인 이벤트를 비우고 다음 시작까지 전송 스레드 중지
+void stopCDPEventSender();
+
+// Enqueue serialized CDP message for the sender thread / 전송 스레드를 위해 직렬화된 CDP 메시지 추가
+// Safe to call from any thread; never blocks / 모든 스레드에서 호출 가능하며 절대 블록되지 않음
+// Returns false if the sender is stopped or the queue is full and the message was dropped /
+// 전송 스레드가 중지되었거나 큐가 가득 차서 메시지가 버려지면 false 반환
+bool enqueueCDPMessage(const std::string& serverHost, int serverPort, std::string message);
+
+// Enqueue one message of a bulk stream (heap snapshot chunks, ...) without outrunning the sender /
+// 전송 스레드를 앞지르지 않도록 대량 스트림(힙 스냅샷 청크 등)의 메시지 하나를 추가
+// Blocks the caller while more than maxPendingBytes await delivery / maxPendingBytes 이상이 전달 대기 중이면 호출자를 블록
+// Returns false if the sender is stopped, made no progress for stallTimeout or the platform callback is gone /
+// 전송 스레드가 중지되었거나 stallTimeout 동안 진행하지 못했거나 플랫폼 콜백이 없으면 false 반환
+bool enqueueCDPMessageWithBackpressure(const std::string& serverHost,
+                                       int serverPort,
+                                       std::string message,
+                                       size_t maxPendingBytes,
+                                       std::chrono::milliseconds stallTimeout);
+
+// Payload bytes enqueued but not yet delivered / 추가되었지만 아직 전달되지 않은 페이로드 바이트
+size_t getPendingCDPMessageBytes();
+
+// Messages enqueued but not yet delivered / 추가되었지만 아직 전달되지 않은 메시지 수
+size_t getPendingCDPMessageCount();
+
+// Number of messages dropped because the queue was full / 큐가 가득 차서 버려진 메시지 수
+uint64_t getDroppedCDPMessageCount();
+
+} // namespace transport
+} // namespace chrome_remote_devtools
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#include "CDPMessageBatcher.h"
+
+namespace chrome_remote_devtools {
+namespace transport {
+
+CDPMessageBatcher::CDPMessageBatcher(BatchPolicy policy, DeliverFunction deliver)
+    : policy_(policy), deliver_(deliver) {
+  frame_.reserve(policy_.maxBytes + 2);
+}
+
+void CDPMessageBatcher::add(CDPEvent&& event) {
+  if (pendingEvents_ > 0) {
+    bool sameTarget = event.serverPort == serverPort_ && event.serverHost == serverHost_;
+    // +1 for separator / 구분자용 +1
+    bool overflows = frame_.size() + event.message.size() + 1 > policy_.maxBytes;
+    if (!sameTarget || overflows) {
+      flush();
+    }
+  }
+
+  if (pendingEvents_ == 0) {
+    serverHost_ = std::move(event.serverHost);
+    serverPort_ = event.serverPort;
+    firstEventTime_ = std::chrono::steady_clock::now();
+    frame_.assign(1, '[');
+  } else {
+    frame_ += ',';
+  }
+  frame_ += event.message;
+  pendingEvents_++;
+  pendingBytes_ += event.message.size();
+
+  if (pendingEvents_ >= policy_.maxEvents || frame_.size() >= policy_.maxBytes) {
+    flush();
+  }
+}
+
+void CDPMessageBatcher::flushIfDue(std::chrono::steady_clock::time_point now) {
+  if (pendingEvents_ > 0 && now >= deadline()) {
+    flush();
+  }
+}
+
+void CDPMessageBatcher::flush() {
+  if (pendingEvents_ == 0) {
+    return;
+  }
+  if (pendingEvents_ == 1) {
+    // Skip the leading '[' and send the message as-is / 앞의 '['를 건너뛰고 메시지를 그대로 전송
+    deliver_(serverHost_.c_str(), serverPort_, frame_.c_str() + 1);
+  } else {
+    frame_ += ']';
+    deliver_(serverHost_.c_str(), serverPort_, frame_.c_str());
+  }
+  deliveredEvents_ += pendingEvents_;
+  deliveredBytes_ += pendingBytes_;
+  frame_.clear();
+  // Release memory held after an oversized message / 너무 큰 메시지 이후 유지된 메모리 해제
+  if (frame_.capacity() > policy_.maxBytes * 4) {
+    frame_.shrink_to_fit();
+    frame_.reserve(policy_.maxBytes + 2);
+  }
+  pendingEvents_ = 0;
+  pendingBytes_ = 0;
+}
+
+} // namespace transport
+} // namespace chrome_remote_devtools
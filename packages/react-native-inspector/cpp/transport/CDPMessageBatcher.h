@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * Modified for Chrome Remote DevTools / Chrome Remote DevTools용으로 수정됨
+ */
+
+#pragma once
+
+#include "CDPEventQueue.h"
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace chrome_remote_devtools {
+namespace transport {
+
+// Flush thresholds for batched CDP frames / 배치 CDP 프레임의 플러시 임계값
+struct BatchPolicy {
+  size_t maxBytes = 64 * 1024;                       // Flush when frame reaches this size / 프레임이 이 크기에 도달하면 플러시
+  size_t maxEvents = 128;                            // Flush when this many events are pending / 이만큼의 이벤트가 대기 중이면 플러시
+  std::chrono::milliseconds maxLatency{5};           // Flush when oldest event is this old / 가장 오래된 이벤트가 이만큼 오래되면 플러시
+};
+
+// Packs consecutive CDP messages into one framed JSON array / 연속된 CDP 메시지를 하나의 JSON 배열 프레임으로 묶음
+// Frame format: [msg1,msg2,...] (server unpacks into individual messages) / 프레임 형식: [msg1,msg2,...] (서버가 개별 메시지로 풀어냄)
+// A batch holding a single event is sent unframed / 이벤트가 하나뿐인 배치는 프레임 없이 전송됨
+// Used only from the sender thread, not thread-safe / 전송 스레드에서만 사용, 스레드 안전하지 않음
+class CDPMessageBatcher {
+public:
+  // Delivery function: (serverHost, serverPort, payload) / 전달 함수: (serverHost, serverPort, payload)
+  typedef void (*DeliverFunction)(const char* serverHost, int serverPort, const char* payload);
+
+  CDPMessageBatcher(BatchPolicy policy, DeliverFunction deliver);
+
+  // Add event, flushing first if it targets another server or would overflow the frame /
+  // 이벤트 추가, 다른 서버 대상이거나 프레임을 넘치게 하면 먼저 플러시
+  void add(CDPEvent&& event);
+
+  // Flush if any threshold is reached / 임계값에 도달했으면 플러시
+  void flushIfDue(std::chrono::steady_clock::time_point now);
+
+  // Flush pending events unconditionally / 대기 중인 이벤트를 무조건 플러시
+  void flush();
+
+  bool hasPending() const { return pendingEvents_ > 0; }
+
+  // Running totals of events and message bytes handed to the delivery function; they wrap around /
+  // 전달 함수에 넘긴 이벤트 수와 메시지 바이트의 누적 합계, 오버플로 시 순환함
+  size_t deliveredEvents() const { return deliveredEvents_; }
+  size_t deliveredBytes() const { return deliveredBytes_; }
+
+  // Time at which pending events must be flushed / 대기 중인 이벤트를 플러시해야 하는 시각
+  std::chrono::steady_clock::time_point deadline() const { return firstEventTime_ + policy_.maxLatency; }
+
+private:
+  BatchPolicy policy_;
+  DeliverFunction deliver_;
+
+  // Reused across flushes to avoid reallocation / 재할당을 피하기 위해 플러시 간 재사용
+  std::string frame_;
+  std::string serverHost_;
+  int serverPort_ = 0;
+  size_t pendingEvents_ = 0;
+  size_t pendingBytes_ = 0;  // Message bytes in frame_, without separators / frame_의 메시지 바이트, 구분자 제외
+  size_t deliveredEvents_ = 0;
+  size_t deliveredBytes_ = 0;
+  std::chrono::steady_clock::time_point firstEventTime_;
+};
+
+} // namespace transport
+} // namespace chrome_remote_devtools
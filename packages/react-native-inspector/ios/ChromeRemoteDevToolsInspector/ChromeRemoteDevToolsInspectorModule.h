@@ -8,6 +8,7 @@
  */
 
 #import <React/RCTBridgeModule.h>
+#import <React/RCTInvalidating.h>
 
 #if RCT_DEV || RCT_REMOTE_PROFILE
 
@@ -25,7 +26,7 @@
  * By implementing RCTTurboModule and RCTTurboModuleWithJSIBindings, we can access JSI Runtime / RCTTurboModule과 RCTTurboModuleWithJSIBindings를 구현하여 JSI Runtime에 접근할 수 있습니다
  * This allows us to use common C++ code for console and network hooking / 이를 통해 console과 network hooking을 위한 공통 C++ 코드를 사용할 수 있습니다
  */
-@interface ChromeRemoteDevToolsInspectorModule : NSObject <RCTBridgeModule, RCTTurboModule, RCTTurboModuleWithJSIBindings>
+@interface ChromeRemoteDevToolsInspectorModule : NSObject <RCTBridgeModule, RCTInvalidating, RCTTurboModule, RCTTurboModuleWithJSIBindings>
 
 /**
  * Handle CDP message from WebSocket / WebSocket으로부터 CDP 메시지 처리
@@ -47,6 +48,94 @@
  */
 + (void)getObjectProperties:(NSString *)objectId completion:(void (^)(NSString *propertiesJson))completion;
 
+/**
+ * Release retained objects on the JS thread / JS 스레드에서 보유 중인 객체 해제
+ * @param method Runtime.releaseObject, Runtime.releaseObjectGroup or Runtime.discardConsoleEntries
+ * @param argument objectId or objectGroup (empty for discardConsoleEntries) / objectId 또는 objectGroup (discardConsoleEntries는 빈 문자열)
+ */
++ (void)releaseRemoteObjects:(NSString *)method argument:(NSString *)argument;
+
+/**
+ * Handle Profiler or HeapProfiler domain command on the JS thread / JS 스레드에서 Profiler 또는 HeapProfiler 도메인 명령 처리
+ * The response is sent by native code, callers must not answer the command / 응답은 네이티브 코드가 전송하므로 호출자는 명령에 응답하면 안 됨
+ * @param messageJson CDP command as JSON string / JSON 문자열로 된 CDP 명령
+ * @return YES if the command was scheduled / 명령이 예약되면 YES
+ */
++ (BOOL)handleProfilerCommand:(NSString *)messageJson;
+
+/**
+ * Handle Performance domain command on the JS thread / JS 스레드에서 Performance 도메인 명령 처리
+ * The response is sent by native code, callers must not answer the command / 응답은 네이티브 코드가 전송하므로 호출자는 명령에 응답하면 안 됨
+ * @param messageJson CDP command as JSON string / JSON 문자열로 된 CDP 명령
+ * @return YES if the command was scheduled / 명령이 예약되면 YES
+ */
++ (BOOL)handlePerformanceCommand:(NSString *)messageJson;
+
+/**
+ * Handle ChromeRemoteDevTools domain command (hook metrics) on the JS thread / JS 스레드에서 ChromeRemoteDevTools 도메인 명령 (훅 메트릭) 처리
+ * The response is sent by native code, callers must not answer the command / 응답은 네이티브 코드가 전송하므로 호출자는 명령에 응답하면 안 됨
+ * @param messageJson CDP command as JSON string / JSON 문자열로 된 CDP 명령
+ * @return YES if the command was scheduled / 명령이 예약되면 YES
+ */
++ (BOOL)handleInspectorCommand:(NSString *)messageJson;
+
+/**
+ * Defer console and network hooks until a DevTools client enables their domain / DevTools 클라이언트가 도메인을 활성화할 때까지 console, 네트워크 훅 지연
+ * Keeps hook installation out of app startup; hooks are removed again when the client detaches.
+ * Call before the React Native runtime starts (e.g. in application:didFinishLaunchingWithOptions:) /
+ * 훅 설치를 앱 시작에서 제외하며, 클라이언트가 분리되면 훅을 다시 제거함.
+ * React Native 런타임 시작 전에 호출해야 함 (예: application:didFinishLaunchingWithOptions:)
+ * @param deferred YES to install hooks on first domain enable / 첫 도메인 활성화 시 훅을 설치하려면 YES
+ */
++ (void)setDeferredHookInstall:(BOOL)deferred;
+
+/**
+ * Set how many console objects stay inspectable / 검사 가능한 상태로 유지할 console 객체 수 설정
+ * Least recently used objects are evicted beyond the budget (default 5000 objects, 8 MB) /
+ * 예산을 초과하면 가장 오래 사용되지 않은 객체부터 제거 (기본값 5000개, 8 MB)
+ * @param maxObjects Maximum retained objects / 최대 보유 객체 수
+ * @param maxBytes Approximate maximum retained bytes / 대략적인 최대 보유 바이트
+ */
++ (void)setObjectRetentionBudgetWithMaxObjects:(NSUInteger)maxObjects maxBytes:(NSUInteger)maxBytes;
+
+/**
+ * Set how many response bodies are kept for Network.getResponseBody / Network.getResponseBody를 위해 보관할 응답 본문 양 설정
+ * Bodies above spillThresholdBytes go to the app cache directory. Least recently stored bodies are evicted beyond
+ * the budget (default 32 MB in memory, 256 KB threshold, 128 MB on disk) /
+ * spillThresholdBytes보다 큰 본문은 앱 캐시 디렉토리로 이동. 예산을 초과하면 가장 오래전에 저장된 본문부터 제거
+ * (기본값 메모리 32 MB, 임계값 256 KB, 디스크 128 MB)
+ * @param maxMemoryBytes Bytes kept in native heap / 네이티브 힙에 보관되는 바이트
+ * @param spillThresholdBytes Bodies larger than this spill to disk / 이보다 큰 본문은 디스크로 spill
+ * @param maxSpillBytes Bytes kept on disk / 디스크에 보관되는 바이트
+ */
++ (void)setResponseBodyBudgetWithMaxMemoryBytes:(NSUInteger)maxMemoryBytes
+                            spillThresholdBytes:(NSUInteger)spillThresholdBytes
+                                  maxSpillBytes:(NSUInteger)maxSpillBytes;
+
+/**
+ * Report the DevTools connection state / DevTools 연결 상태 보고
+ * Console, XHR and fetch hooks call the original directly while disconnected / 연결이 없는 동안 console, XHR, fetch 훅은 원본을 바로 호출
+ * @param connected YES on open, NO on close or failure / 열리면 YES, 닫히거나 실패하면 NO
+ */
++ (void)setDevToolsConnected:(BOOL)connected;
+
+/**
+ * Report a DevTools client attaching or detaching, as announced by the relay server /
+ * 릴레이 서버가 알린 DevTools 클라이언트 연결 또는 분리 보고
+ * Detach forgets enabled domains, so capture stops until a client enables them again /
+ * 분리되면 활성화된 도메인을 잊으므로 클라이언트가 다시 활성화할 때까지 캡처 중지
+ * @param attached YES for devtoolsAttached, NO for devtoolsDetached / devtoolsAttached면 YES, devtoolsDetached면 NO
+ * @param resumed params.resumed of devtoolsAttached / devtoolsAttached의 params.resumed
+ */
++ (void)setDevToolsAttached:(BOOL)attached resumed:(BOOL)resumed;
+
+/**
+ * Track Runtime, Console, Log and Network enable/disable / Runtime, Console, Log, Network enable/disable 추적
+ * Only records the subscription, callers still handle the command / 구독만 기록하며 호출자는 명령을 계속 처리해야 함
+ * @param method CDP method name / CDP 메서드 이름
+ */
++ (void)trackDomainSubscription:(NSString *)method;
+
 @end
 
 #endif
@@ -33,6 +33,28 @@
 #define NETWORK_HOOK_AVAILABLE
 #endif
 
+// Include common C++ profiler hook / 공통 C++ profiler 훅 포함
+#if __has_include("ProfilerHook.h")
+#include "ProfilerHook.h"
+#define PROFILER_HOOK_AVAILABLE
+#endif
+#if __has_include("PerformanceHook.h")
+#include "PerformanceHook.h"
+#define PERFORMANCE_HOOK_AVAILABLE
+#endif
+#if __has_include("StallWatchdog.h")
+#include "StallWatchdog.h"
+#define STALL_WATCHDOG_AVAILABLE
+#endif
+#if __has_include("InspectorHook.h")
+#include "InspectorHook.h"
+#define INSPECTOR_HOOK_AVAILABLE
+#endif
+#if __has_include("HookInstaller.h")
+#include "HookInstaller.h"
+#define HOOK_INSTALLER_AVAILABLE
+#endif
+
 // Note: Redux DevTools Extension is handled by JavaScript polyfill, not C++ / 참고: Redux DevTools Extension은 C++가 아닌 JavaScript polyfill로 처리됩니다
 // C++ version was removed because it doesn't fully support Redux Toolkit's .apply() pattern / C++ 버전은 Redux Toolkit의 .apply() 패턴을 완전히 지원하지 않아 제거되었습니다
 
@@ -64,6 +86,10 @@ void sendCDPMessageIOS(const char* serverHost, int serverPort, const char* messa
 
     // Try to send via stored connection first / 먼저 저장된 연결을 통해 전송 시도
     if (g_connection && [g_connection respondsToSelector:@selector(sendCDPMessage:)]) {
+      // Called on the native sender thread, which may wait / 대기해도 되는 네이티브 전송 스레드에서 호출됨
+      if ([g_connection respondsToSelector:@selector(awaitSendQueue)]) {
+        [g_connection awaitSendQueue];
+      }
       [g_connection sendCDPMessage:msg];
     } else {
       // Fallback: Use ChromeRemoteDevToolsInspector helper / 폴백: ChromeRemoteDevToolsInspector 헬퍼 사용
@@ -256,6 +282,144 @@ static RCTLogFunction ChromeRemoteDevToolsLogFunction = ^(
   });
 }
 
++ (void)releaseRemoteObjects:(NSString *)method argument:(NSString *)argument {
+  if (!g_runtimeExecutor || !method) {
+    return;
+  }
+
+  std::string methodCpp = [method UTF8String];
+  std::string argumentCpp = argument ? [argument UTF8String] : "";
+
+  // Fire-and-forget, the response does not wait for the JS thread / 응답은 JS 스레드를 기다리지 않음
+  g_runtimeExecutor([methodCpp, argumentCpp](facebook::jsi::Runtime& runtime) {
+    try {
+#ifdef CONSOLE_HOOK_AVAILABLE
+      if (methodCpp == "Runtime.releaseObject") {
+        chrome_remote_devtools::releaseObject(runtime, argumentCpp);
+      } else if (methodCpp == "Runtime.releaseObjectGroup") {
+        chrome_remote_devtools::releaseObjectGroup(runtime, argumentCpp);
+      } else if (methodCpp == "Runtime.discardConsoleEntries") {
+        chrome_remote_devtools::discardConsoleEntries(runtime);
+      }
+#endif
+    } catch (...) {
+      NSLog(@"[ChromeRemoteDevToolsInspectorModule] Exception releasing remote objects / 원격 객체 해제 중 예외 발생");
+    }
+  });
+}
+
++ (BOOL)handleProfilerCommand:(NSString *)messageJson {
+#ifdef PROFILER_HOOK_AVAILABLE
+  if (!g_runtimeExecutor || !messageJson) {
+    return NO;
+  }
+
+  std::string messageCpp = [messageJson UTF8String];
+
+  // The response is sent by C++ through the CDP event sender / 응답은 C++가 CDP 이벤트 전송기를 통해 전송함
+  g_runtimeExecutor([messageCpp](facebook::jsi::Runtime& runtime) {
+    try {
+      chrome_remote_devtools::handleProfilerCommand(runtime, messageCpp);
+    } catch (...) {
+      NSLog(@"[ChromeRemoteDevToolsInspectorModule] Exception handling Profiler command / Profiler 명령 처리 중 예외 발생");
+    }
+  });
+  return YES;
+#else
+  return NO;
+#endif
+}
+
++ (BOOL)handlePerformanceCommand:(NSString *)messageJson {
+#ifdef PERFORMANCE_HOOK_AVAILABLE
+  if (!g_runtimeExecutor || !messageJson) {
+    return NO;
+  }
+
+  std::string messageCpp = [messageJson UTF8String];
+
+  // The response is sent by C++ through the CDP event sender / 응답은 C++가 CDP 이벤트 전송기를 통해 전송함
+  g_runtimeExecutor([messageCpp](facebook::jsi::Runtime& runtime) {
+    try {
+      chrome_remote_devtools::handlePerformanceCommand(runtime, messageCpp);
+    } catch (...) {
+      NSLog(@"[ChromeRemoteDevToolsInspectorModule] Exception handling Performance command / Performance 명령 처리 중 예외 발생");
+    }
+  });
+  return YES;
+#else
+  return NO;
+#endif
+}
+
++ (BOOL)handleInspectorCommand:(NSString *)messageJson {
+#ifdef INSPECTOR_HOOK_AVAILABLE
+  if (!g_runtimeExecutor || !messageJson) {
+    return NO;
+  }
+
+  std::string messageCpp = [messageJson UTF8String];
+
+  // The response is sent by C++ through the CDP event sender / 응답은 C++가 CDP 이벤트 전송기를 통해 전송함
+  g_runtimeExecutor([messageCpp](facebook::jsi::Runtime& runtime) {
+    try {
+      chrome_remote_devtools::handleInspectorCommand(runtime, messageCpp);
+    } catch (...) {
+      NSLog(@"[ChromeRemoteDevToolsInspectorModule] Exception handling ChromeRemoteDevTools command / ChromeRemoteDevTools 명령 처리 중 예외 발생");
+    }
+  });
+  return YES;
+#else
+  return NO;
+#endif
+}
+
++ (void)setDeferredHookInstall:(BOOL)deferred {
+#ifdef HOOK_INSTALLER_AVAILABLE
+  chrome_remote_devtools::setHookInstallMode(deferred ? chrome_remote_devtools::HookInstallMode::Deferred
+                                                      : chrome_remote_devtools::HookInstallMode::Eager);
+#endif
+}
+
++ (void)setObjectRetentionBudgetWithMaxObjects:(NSUInteger)maxObjects maxBytes:(NSUInteger)maxBytes {
+#ifdef CONSOLE_HOOK_AVAILABLE
+  if (maxObjects == 0 || maxBytes == 0) {
+    return;
+  }
+  chrome_remote_devtools::setObjectRetentionBudget(maxObjects, maxBytes);
+#endif
+}
+
++ (void)setResponseBodyBudgetWithMaxMemoryBytes:(NSUInteger)maxMemoryBytes
+                            spillThresholdBytes:(NSUInteger)spillThresholdBytes
+                                  maxSpillBytes:(NSUInteger)maxSpillBytes {
+#ifdef NETWORK_HOOK_AVAILABLE
+  chrome_remote_devtools::setResponseBodyBudget(maxMemoryBytes, spillThresholdBytes, maxSpillBytes);
+#endif
+}
+
++ (void)setDevToolsConnected:(BOOL)connected {
+#ifdef INSPECTOR_HOOK_AVAILABLE
+  chrome_remote_devtools::setDevToolsConnected(connected == YES);
+#endif
+}
+
++ (void)setDevToolsAttached:(BOOL)attached resumed:(BOOL)resumed {
+#ifdef INSPECTOR_HOOK_AVAILABLE
+  chrome_remote_devtools::setDevToolsAttached(attached == YES, resumed == YES);
+#endif
+}
+
++ (void)trackDomainSubscription:(NSString *)method {
+#ifdef INSPECTOR_HOOK_AVAILABLE
+  if (!method) {
+    return;
+  }
+  // Only flips an atomic flag, no JS thread hop / 원자 플래그만 바꾸므로 JS 스레드로 넘기지 않음
+  chrome_remote_devtools::trackDomainSubscription([method UTF8String]);
+#endif
+}
+
 RCT_EXPORT_MODULE(ChromeRemoteDevToolsInspector)
 
 + (BOOL)requiresMainQueueSetup {
@@ -269,6 +433,15 @@ RCT_EXPORT_MODULE(ChromeRemoteDevToolsInspector)
                                              selector:@selector(handleAppWillEnterForeground:)
                                                  name:UIApplicationWillEnterForegroundNotification
                                                object:nil];
+
+#ifdef NETWORK_HOOK_AVAILABLE
+    // Large response bodies spill to the app cache directory, set before any hook can store one /
+    // 큰 응답 본문은 앱 캐시 디렉토리로 spill, 훅이 본문을 저장하기 전에 설정
+    NSString *cacheDirectory = NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES).firstObject;
+    if (cacheDirectory) {
+      chrome_remote_devtools::setResponseBodySpillDirectory([cacheDirectory UTF8String]);
+    }
+#endif
   }
   return self;
 }
@@ -278,6 +451,23 @@ RCT_EXPORT_MODULE(ChromeRemoteDevToolsInspector)
   [[NSNotificationCenter defaultCenter] removeObserver:self];
 }
 
+#pragma mark - RCTInvalidating
+
+/**
+ * React instance is being destroyed / React 인스턴스가 파괴되는 중
+ * Release retained objects while the runtime is alive; if it is gone first, the next runtime abandons them /
+ * 런타임이 살아 있는 동안 보유 객체 해제, 런타임이 먼저 사라지면 다음 런타임이 이를 버림
+ */
+- (void)invalidate {
+#ifdef INSPECTOR_HOOK_AVAILABLE
+  if (g_runtimeExecutor) {
+    g_runtimeExecutor([](facebook::jsi::Runtime& runtime) {
+      chrome_remote_devtools::detachRuntime(runtime);
+    });
+  }
+#endif
+}
+
 - (void)handleAppWillEnterForeground:(NSNotification *)notification {
   // App came to foreground / 앱이 포그라운드로 복귀
   NSLog(@"[ChromeRemoteDevToolsInspectorModule] App will enter foreground, checking connection status / 앱이 포그라운드로 복귀, 연결 상태 확인");
@@ -335,6 +525,12 @@ RCT_EXPORT_MODULE(ChromeRemoteDevToolsInspector)
   NSLog(@"[ChromeRemoteDevToolsInspectorModule] installJSIBindingsWithRuntime:callInvoker: called / installJSIBindingsWithRuntime:callInvoker: 호출됨");
   NSLog(@"[ChromeRemoteDevToolsInspectorModule] This is the key method for JSI Runtime access / 이것은 JSI Runtime 접근을 위한 핵심 메서드입니다");
 
+#ifdef INSPECTOR_HOOK_AVAILABLE
+  // Drop handles cached for a reloaded runtime before anything runs on this one /
+  // 이 런타임에서 무엇이든 실행되기 전에 리로드된 런타임의 캐시 핸들 폐기
+  chrome_remote_devtools::attachRuntime(runtime);
+#endif
+
   // Store CallInvoker for safe JSI runtime access in enable/disable methods / enable/disable 메서드에서 안전한 JSI 런타임 접근을 위해 CallInvoker 저장
   g_callInvoker = callInvoker;
 
@@ -351,6 +547,12 @@ RCT_EXPORT_MODULE(ChromeRemoteDevToolsInspector)
     }
   };
 
+#ifdef STALL_WATCHDOG_AVAILABLE
+  // Measure JS thread responsiveness through the same executor while a client watches /
+  // 클라이언트가 보고 있는 동안 같은 executor로 JS 스레드 응답성 측정
+  chrome_remote_devtools::startStallWatchdog(g_runtimeExecutor);
+#endif
+
   // Check if hooks are available / 훅이 사용 가능한지 확인
 #ifdef CONSOLE_HOOK_AVAILABLE
   NSLog(@"[ChromeRemoteDevToolsInspectorModule] ✅ ConsoleHook.h is available / ConsoleHook.h를 사용할 수 있음");
@@ -373,6 +575,17 @@ RCT_EXPORT_MODULE(ChromeRemoteDevToolsInspector)
   NSLog(@"[ChromeRemoteDevToolsInspectorModule] ⚠️ Cannot set platform callback - ConsoleHook.h not available / 플랫폼 콜백을 설정할 수 없음 - ConsoleHook.h를 사용할 수 없음");
 #endif
 
+#ifdef HOOK_INSTALLER_AVAILABLE
+  // Deferred mode: hooks are installed when a DevTools client first enables a domain /
+  // 지연 모드: DevTools 클라이언트가 도메인을 처음 활성화할 때 훅 설치
+  if (chrome_remote_devtools::getHookInstallMode() == chrome_remote_devtools::HookInstallMode::Deferred) {
+    chrome_remote_devtools::installDeferredHooks(runtime, g_runtimeExecutor);
+    NSLog(@"[ChromeRemoteDevToolsInspectorModule] JSI hooks deferred until a DevTools client enables a domain / DevTools 클라이언트가 도메인을 활성화할 때까지 JSI 훅 지연");
+    NSLog(@"[ChromeRemoteDevToolsInspectorModule] ========================================");
+    return;
+  }
+#endif
+
   // Install console hook / console 훅 설치
   bool consoleSuccess = false;
 #ifdef CONSOLE_HOOK_AVAILABLE
@@ -409,6 +622,11 @@ RCT_EXPORT_MODULE(ChromeRemoteDevToolsInspector)
   NSLog(@"[ChromeRemoteDevToolsInspectorModule] ⚠️ Network hook not available - NetworkHook.h not included / 네트워크 훅을 사용할 수 없음 - NetworkHook.h가 포함되지 않음");
 #endif
 
+#ifdef INSPECTOR_HOOK_AVAILABLE
+  // Hook cost report for in-app benchmarks / 앱 내 벤치마크를 위한 훅 비용 보고서
+  chrome_remote_devtools::installHookMetricsGetter(runtime);
+#endif
+
   // Note: Redux DevTools Extension is handled by JavaScript polyfill / 참고: Redux DevTools Extension은 JavaScript polyfill로 처리됩니다
 
   // Summary / 요약
@@ -25,6 +25,7 @@
 - (void)sendCDPMessage:(NSString *)message;
 
 @optional
+- (void)awaitSendQueue;
 - (void)enableReconnection;
 - (void)disableReconnection;
 - (void)reconnect;
@@ -245,6 +245,15 @@ RCT_NOT_IMPLEMENTED(-(instancetype)init)
   [self sendEventToAllConnections:message];
 }
 
+- (void)awaitSendQueue
+{
+  // Bound the adapter send queue, like awaitSendQueue on Android / Android의 awaitSendQueue처럼 어댑터 송신 큐 제한
+  if (_delegate) {
+    ChromeRemoteDevToolsInspectorWebSocketAdapter *adapter = _delegate->getWebSocketAdapter();
+    [adapter awaitSendQueue];
+  }
+}
+
 - (void)sendExecutionContextCreated
 {
   // Create execution context for React Native / React Native용 execution context 생성
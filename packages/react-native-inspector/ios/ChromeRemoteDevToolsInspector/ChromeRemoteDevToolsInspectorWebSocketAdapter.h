@@ -23,6 +23,9 @@
 - (instancetype)initWithURL:(const std::string &)url
                    delegate:(std::weak_ptr<facebook::react::jsinspector_modern::IWebSocketDelegate>)delegate;
 - (void)send:(std::string_view)message;
+// Wait while too many bytes wait for the main queue to hand them to the socket (background threads only) /
+// 소켓에 넘기기 위해 메인 큐를 기다리는 바이트가 너무 많으면 대기 (백그라운드 스레드 전용)
+- (void)awaitSendQueue;
 - (void)close;
 @end
 
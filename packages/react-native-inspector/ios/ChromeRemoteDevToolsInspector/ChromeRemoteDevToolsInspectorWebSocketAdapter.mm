@@ -28,6 +28,10 @@
 
 using namespace facebook::react::jsinspector_modern;
 
+// Same limits as the Android packager connection / Android packager 연결과 같은 제한
+static const NSUInteger kMaxQueuedSendBytes = 4 * 1024 * 1024; // 4 MiB
+static const NSTimeInterval kSendQueueStallTimeout = 5.0;
+
 namespace {
 NSString *NSStringFromUTF8StringView(std::string_view view)
 {
@@ -38,6 +42,9 @@ NSString *NSStringFromUTF8StringView(std::string_view view)
   std::weak_ptr<IWebSocketDelegate> _delegate;
   SRWebSocket *_webSocket;
   BOOL _isConnected;
+  // Bytes passed to send: that the main queue has not handed to the socket yet / send:에 전달되었지만 메인 큐가 아직 소켓에 넘기지 않은 바이트
+  NSCondition *_sendQueueCondition;
+  NSUInteger _queuedSendBytes;
 }
 @end
 
@@ -68,6 +75,8 @@ NSString *NSStringFromUTF8StringView(std::string_view view)
 {
   if ((self = [super init]) != nullptr) {
     _delegate = delegate;
+    _sendQueueCondition = [NSCondition new];
+    _queuedSendBytes = 0;
     _webSocket = [[SRWebSocket alloc] initWithURL:[NSURL URLWithString:NSStringFromUTF8StringView(url)]];
     _webSocket.delegate = self;
     [_webSocket open];
@@ -89,9 +98,16 @@ NSString *NSStringFromUTF8StringView(std::string_view view)
     RCTLogError(@"Failed to convert CDP message string to NSString, message will be dropped!");
     return;
   }
+  NSUInteger size = message.size();
+  [_sendQueueCondition lock];
+  _queuedSendBytes += size;
+  [_sendQueueCondition unlock];
   dispatch_async(dispatch_get_main_queue(), ^{
     ChromeRemoteDevToolsInspectorWebSocketAdapter *strongSelf = weakSelf;
-    if (strongSelf != nullptr && strongSelf->_isConnected && strongSelf->_webSocket != nil) {
+    if (strongSelf == nullptr) {
+      return;
+    }
+    if (strongSelf->_isConnected && strongSelf->_webSocket != nil) {
       // Double-check connection state before sending / 전송 전 연결 상태 재확인
       NSError *error = nil;
       [strongSelf->_webSocket sendString:messageStr error:&error];
@@ -99,12 +115,47 @@ NSString *NSStringFromUTF8StringView(std::string_view view)
         RCTLogError(@"[ChromeRemoteDevTools] Failed to send message: %@ / 메시지 전송 실패", [error localizedDescription]);
       }
     }
+    [strongSelf->_sendQueueCondition lock];
+    strongSelf->_queuedSendBytes -= size;
+    [strongSelf->_sendQueueCondition broadcast];
+    [strongSelf->_sendQueueCondition unlock];
   });
 }
 
+- (void)awaitSendQueue
+{
+  // Sends are drained on the main queue, waiting there would only time out / 전송은 메인 큐에서 처리되므로 거기서 기다리면 타임아웃만 발생
+  if ([NSThread isMainThread]) {
+    return;
+  }
+  [_sendQueueCondition lock];
+  NSUInteger lastQueued = _queuedSendBytes;
+  NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:kSendQueueStallTimeout];
+  while (_isConnected && _queuedSendBytes > kMaxQueuedSendBytes) {
+    if (![_sendQueueCondition waitUntilDate:deadline]) {
+      break; // No progress within the stall timeout / 정체 타임아웃 내 진행 없음
+    }
+    if (_queuedSendBytes < lastQueued) {
+      lastQueued = _queuedSendBytes;
+      deadline = [NSDate dateWithTimeIntervalSinceNow:kSendQueueStallTimeout];
+    }
+  }
+  [_sendQueueCondition unlock];
+}
+
+// Wake senders blocked in awaitSendQueue once the socket is gone / 소켓이 사라지면 awaitSendQueue에서 블록된 전송자를 깨움
+- (void)wakeSendQueueWaiters
+{
+  [_sendQueueCondition lock];
+  [_sendQueueCondition broadcast];
+  [_sendQueueCondition unlock];
+}
+
 - (void)close
 {
   _isConnected = NO;
+  [self wakeSendQueueWaiters];
+  [ChromeRemoteDevToolsInspectorModule setDevToolsConnected:NO];
   [_webSocket closeWithCode:1000 reason:@"End of session"];
 }
 
@@ -112,6 +163,7 @@ NSString *NSStringFromUTF8StringView(std::string_view view)
 {
   // NOTE: We are on the main queue here, per SRWebSocket's defaults.
   _isConnected = YES;
+  [ChromeRemoteDevToolsInspectorModule setDevToolsConnected:YES];
   if (auto delegate = _delegate.lock()) {
     delegate->didOpen();
   }
@@ -130,6 +182,8 @@ NSString *NSStringFromUTF8StringView(std::string_view view)
 {
   // NOTE: We are on the main queue here, per SRWebSocket's defaults.
   _isConnected = NO;
+  [self wakeSendQueueWaiters];
+  [ChromeRemoteDevToolsInspectorModule setDevToolsConnected:NO];
 
   NSInteger errorCode = -1;
   NSString *errorDescription = nil;
@@ -202,9 +256,27 @@ NSString *NSStringFromUTF8StringView(std::string_view view)
   NSData *jsonData = [message dataUsingEncoding:NSUTF8StringEncoding];
   NSDictionary *messageDict = [NSJSONSerialization JSONObjectWithData:jsonData options:0 error:&error];
 
+  // Relay server reports DevTools clients attaching and detaching / 릴레이 서버가 DevTools 클라이언트 연결과 분리를 알림
+  if (!error && [messageDict isKindOfClass:[NSDictionary class]] && !messageDict[@"id"]) {
+    NSString *method = messageDict[@"method"];
+    BOOL attached = [method isEqual:@"ChromeRemoteDevTools.devtoolsAttached"];
+    if (attached || [method isEqual:@"ChromeRemoteDevTools.devtoolsDetached"]) {
+      NSDictionary *params = messageDict[@"params"];
+      BOOL resumed = [params isKindOfClass:[NSDictionary class]] && [params[@"resumed"] boolValue];
+      [ChromeRemoteDevToolsInspectorModule setDevToolsAttached:attached resumed:resumed];
+      return; // Not a CDP message / CDP 메시지가 아님
+    }
+  }
+
   if (!error && messageDict[@"id"] && messageDict[@"method"]) {
     NSString *method = messageDict[@"method"];
 
+    // Hooks only capture domains a client has enabled; the command itself is handled below /
+    // 훅은 클라이언트가 활성화한 도메인만 캡처함, 명령 자체는 아래에서 처리
+    if ([method isKindOfClass:[NSString class]] && ([method hasSuffix:@".enable"] || [method hasSuffix:@".disable"])) {
+      [ChromeRemoteDevToolsInspectorModule trackDomainSubscription:method];
+    }
+
     // Handle Page.getResourceTree request / Page.getResourceTree 요청 처리
     if ([method isEqualToString:@"Page.getResourceTree"]) {
       NSNumber *requestId = messageDict[@"id"];
@@ -242,6 +314,36 @@ NSString *NSStringFromUTF8StringView(std::string_view view)
       }
     }
 
+#ifdef NETWORK_HOOK_AVAILABLE
+    // Handle IO.read / IO.close for streamed response bodies / 스트림 응답 본문을 위한 IO.read / IO.close 처리
+    // C++ builds the complete response, only one bounded chunk is in memory / C++가 완전한 응답을 만들며, 제한된 청크 하나만 메모리에 있음
+    if ([method isEqualToString:@"IO.read"]) {
+      NSNumber *requestId = messageDict[@"id"];
+      NSDictionary *params = messageDict[@"params"];
+      NSString *handle = params[@"handle"] ?: @"";
+      NSNumber *offset = params[@"offset"];
+      NSNumber *size = params[@"size"];
+      std::string response = chrome_remote_devtools::readIOStream(
+          requestId ? [requestId longLongValue] : 0,
+          [handle UTF8String],
+          offset ? [offset longLongValue] : -1,
+          size && [size longLongValue] > 0 ? static_cast<size_t>([size longLongValue]) : 0);
+      [self send:response.c_str()];
+      return; // Don't forward the original message / 원본 메시지를 전달하지 않음
+    }
+    if ([method isEqualToString:@"IO.close"]) {
+      NSNumber *requestId = messageDict[@"id"];
+      NSString *handle = messageDict[@"params"][@"handle"] ?: @"";
+      chrome_remote_devtools::closeIOStream([handle UTF8String]);
+      NSData *responseJsonData = [NSJSONSerialization dataWithJSONObject:@{@"id": requestId ?: @0, @"result": @{}} options:0 error:nil];
+      NSString *responseStr = responseJsonData ? [[NSString alloc] initWithData:responseJsonData encoding:NSUTF8StringEncoding] : nil;
+      if (responseStr) {
+        [self send:[responseStr UTF8String]];
+      }
+      return; // Don't forward the original message / 원본 메시지를 전달하지 않음
+    }
+#endif
+
     // Handle Network.getResponseBody request / Network.getResponseBody 요청 처리
     if ([method isEqualToString:@"Network.getResponseBody"]) {
       NSNumber *requestId = messageDict[@"id"];
@@ -250,14 +352,42 @@ NSString *NSStringFromUTF8StringView(std::string_view view)
       RCTLogInfo(@"[ChromeRemoteDevTools] Network.getResponseBody detected! / Network.getResponseBody 감지됨: requestId=%@", networkRequestId);
 
 #ifdef NETWORK_HOOK_AVAILABLE
-      // Get response body from C++ network hook / C++ network 훅에서 응답 본문 가져오기
       std::string requestIdCpp = [networkRequestId UTF8String];
-      std::string responseBody = chrome_remote_devtools::getNetworkResponseBody(requestIdCpp);
+
+      // Large bodies are answered with a stream handle and pulled with IO.read /
+      // 큰 본문은 스트림 핸들로 응답하고 IO.read로 가져감
+      std::string streamHandle = chrome_remote_devtools::openNetworkResponseBodyStream(requestIdCpp);
+      if (!streamHandle.empty()) {
+        NSDictionary *streamResponse = @{
+          @"id": requestId,
+          @"result": @{
+            @"body": @"",
+            @"base64Encoded": @NO,
+            @"stream": [NSString stringWithUTF8String:streamHandle.c_str()]
+          }
+        };
+        NSData *streamResponseData = [NSJSONSerialization dataWithJSONObject:streamResponse options:0 error:nil];
+        NSString *streamResponseStr = streamResponseData ? [[NSString alloc] initWithData:streamResponseData encoding:NSUTF8StringEncoding] : nil;
+        if (streamResponseStr) {
+          [self send:[streamResponseStr UTF8String]];
+          return; // Don't forward the original message / 원본 메시지를 전달하지 않음
+        }
+      }
+
+      // Get response body from C++ network hook / C++ network 훅에서 응답 본문 가져오기
+      bool bodyIsBase64 = false;
+      std::string responseBody = chrome_remote_devtools::getNetworkResponseBody(requestIdCpp, bodyIsBase64);
 
       NSString *responseBodyStr = @"";
       BOOL base64Encoded = NO;
 
-      if (!responseBody.empty()) {
+      if (bodyIsBase64) {
+        // Binary body, already base64-encoded by the network hook / 바이너리 본문, 네트워크 훅에서 이미 base64로 인코딩됨
+        responseBodyStr = [[NSString alloc] initWithBytes:responseBody.data()
+                                                   length:responseBody.size()
+                                                 encoding:NSASCIIStringEncoding] ?: @"";
+        base64Encoded = YES;
+      } else if (!responseBody.empty()) {
         // Try to interpret the response body as UTF-8 text first / 먼저 응답 본문을 UTF-8 텍스트로 해석 시도
         NSString *utf8String = [[NSString alloc] initWithBytes:responseBody.data()
                                                         length:responseBody.size()
@@ -330,6 +460,50 @@ NSString *NSStringFromUTF8StringView(std::string_view view)
       return; // Don't forward the original message / 원본 메시지를 전달하지 않음
     }
 
+    // Handle Profiler and HeapProfiler domains in native code (Hermes) / Profiler, HeapProfiler 도메인을 네이티브 코드에서 처리 (Hermes)
+    // Native code sends the response once the JS thread has run the command / JS 스레드에서 명령이 실행되면 네이티브 코드가 응답 전송
+    if (([method hasPrefix:@"Profiler."] || [method hasPrefix:@"HeapProfiler."]) &&
+        [ChromeRemoteDevToolsInspectorModule handleProfilerCommand:message]) {
+      return; // Don't forward the original message / 원본 메시지를 전달하지 않음
+    }
+
+    // Handle Performance domain in native code (process and heap statistics) / Performance 도메인을 네이티브 코드에서 처리 (프로세스, 힙 통계)
+    if ([method hasPrefix:@"Performance."] && [ChromeRemoteDevToolsInspectorModule handlePerformanceCommand:message]) {
+      return; // Don't forward the original message / 원본 메시지를 전달하지 않음
+    }
+
+    // Handle the inspector's own domain in native code (hook metrics) / 인스펙터 자체 도메인을 네이티브 코드에서 처리 (훅 메트릭)
+    if ([method hasPrefix:@"ChromeRemoteDevTools."] && [ChromeRemoteDevToolsInspectorModule handleInspectorCommand:message]) {
+      return; // Don't forward the original message / 원본 메시지를 전달하지 않음
+    }
+
+    // Handle object release requests / 객체 해제 요청 처리
+    // Retained objects live in the C++ handle table / 보유 객체는 C++ 핸들 테이블에 있음
+    if ([method isEqualToString:@"Runtime.releaseObject"] ||
+        [method isEqualToString:@"Runtime.releaseObjectGroup"] ||
+        [method isEqualToString:@"Runtime.discardConsoleEntries"]) {
+      NSNumber *requestId = messageDict[@"id"];
+      NSDictionary *params = messageDict[@"params"];
+      NSString *argument = @"";
+      if ([method isEqualToString:@"Runtime.releaseObject"]) {
+        argument = params[@"objectId"] ?: @"";
+      } else if ([method isEqualToString:@"Runtime.releaseObjectGroup"]) {
+        argument = params[@"objectGroup"] ?: @"";
+      }
+      [ChromeRemoteDevToolsInspectorModule releaseRemoteObjects:method argument:argument];
+
+      NSDictionary *response = @{
+        @"id": requestId ?: @0,
+        @"result": @{}
+      };
+      NSData *responseJsonData = [NSJSONSerialization dataWithJSONObject:response options:0 error:nil];
+      NSString *responseStr = responseJsonData ? [[NSString alloc] initWithData:responseJsonData encoding:NSUTF8StringEncoding] : nil;
+      if (responseStr) {
+        [self send:[responseStr UTF8String]];
+      }
+      return; // Don't forward the original message / 원본 메시지를 전달하지 않음
+    }
+
     // Handle Runtime.getProperties request / Runtime.getProperties 요청 처리
     if ([method isEqualToString:@"Runtime.getProperties"]) {
       NSNumber *requestId = messageDict[@"id"];
@@ -426,6 +600,8 @@ NSString *NSStringFromUTF8StringView(std::string_view view)
 {
   // NOTE: We are on the main queue here, per SRWebSocket's defaults.
   _isConnected = NO;
+  [self wakeSendQueueWaiters];
+  [ChromeRemoteDevToolsInspectorModule setDevToolsConnected:NO];
   if (auto delegate = _delegate.lock()) {
     delegate->didClose();
   }